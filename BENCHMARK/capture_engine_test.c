@@ -0,0 +1,301 @@
+/*
+ * File:   capture_engine_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The input capture measurements test (HOST_SIM) <--
+ *
+ * Drives the CCP1 input (RC2) on an absolute timeline of instruction
+ * cycles, the monotonic clock runs TIMER1 at 1:1 (2 MHz ticks, one tick a
+ * cycle), and checks the measurements of the capture engine :
+ *  - 20 kHz at 30 % (duty mode) : 100 ticks, 30 ticks high, 300 per mille.
+ *  - 25 Hz at 30 % (duty mode), every period spans TMR1 wraps.
+ *  - 25 Hz and 9.09 Hz (period mode).
+ *  - 50 kHz captured every 16th rising edge.
+ *  - CAPTURE_TEST_SILENCE_TICKS without an edge : the frequency reads 0.
+ * Every extended stamp must be the cycle of its edge (one constant offset
+ * from the clock start, 2240 stamps), and no edge may be applied late :
+ * the simulator applies an edge between two routines, a capture routine
+ * longer than the high time delays the falling edge. (An edge held by the
+ * overflow routine of a TMR1 wrap is printed, the CCP captures it in time
+ * on the target.)
+ * It needs CCP1 in capture mode :
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. \
+ *          -DCCP1_CFG_SELECTED_MODE=CCP_CFG_CAPTURE_MODE_SELECTED \
+ *          BENCHMARK/capture_engine_test.c MCAL/CCP/capture_engine.c MCAL/CCP/ccp.c \
+ *          MCAL/TIMER1/monotonic_clock.c MCAL/TIMER1/timer1.c MCAL/TIMER16/timer16.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The exit code is 0 when the test passes, the default configuration
+ *  only prints the build line above)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/CCP/capture_engine.h"
+
+#ifndef HOST_SIM
+#error "The input capture measurements test runs on the HOST_SIM backend only"
+#endif
+
+#if CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED
+/* --------------- Section: Macro Declarations --------------- */
+/* The timeout of the channels, 1 s at 2 MHz ticks */
+#define CAPTURE_TEST_TIMEOUT_TICKS      2000000UL
+/* The silence of the last run, 2 s */
+#define CAPTURE_TEST_SILENCE_TICKS      4000000UL
+/* The cycles from the start of a run to its first edge */
+#define CAPTURE_TEST_LEAD_TICKS         1000UL
+/* The cycles left to the ISR of the last edge of a run */
+#define CAPTURE_TEST_TAIL_TICKS         200UL
+/* The delay steps of the timeline end one by one cycle (longer than an ISR) */
+#define CAPTURE_TEST_STEP_TICKS         256UL
+/* TMR1, read without the access cycles */
+#define CAPTURE_TEST_TMR1               ((uint16_t)(SIM_SFR_DIRECT(0xFCE) | (SIM_SFR_DIRECT(0xFCF) << 8)))
+/* The stamps of all the runs */
+#define CAPTURE_TEST_STAMPS             2240UL
+/* No high time (period mode) */
+#define CAPTURE_TEST_NO_HIGH            0UL
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef struct {
+    const char *name;
+    capture_engine_mode_t mode;
+    uint8_t capture_config;
+    uint32_t period_ticks;
+    uint32_t high_ticks;
+    uint32_t periods;
+    /* The expected measurements */
+    uint32_t frequency_mhz;
+    uint16_t duty_permille;
+} capture_test_run_t;
+
+/* --------------- Section : Global Variables --------------- */
+static const capture_test_run_t capture_test_runs[] = {
+    {"20 kHz 30 %",       CAPTURE_ENGINE_MODE_DUTY,   CCP_CAPTURE_EVERY_RISING_EDGE, 100UL,    30UL,    1000UL, 20000000UL, 300U},
+    {"25 Hz 30 % wraps",  CAPTURE_ENGINE_MODE_DUTY,   CCP_CAPTURE_EVERY_RISING_EDGE, 80000UL,  24000UL, 64UL,   25000UL,    300U},
+    {"25 Hz period",      CAPTURE_ENGINE_MODE_PERIOD, CCP_CAPTURE_EVERY_RISING_EDGE, 80000UL,  CAPTURE_TEST_NO_HIGH, 64UL, 25000UL, 0U},
+    {"9.09 Hz period",    CAPTURE_ENGINE_MODE_PERIOD, CCP_CAPTURE_EVERY_RISING_EDGE, 220000UL, CAPTURE_TEST_NO_HIGH, 16UL, 9090UL,  0U},
+    {"50 kHz every 16th", CAPTURE_ENGINE_MODE_PERIOD, CCP_CAPTURE_16TH_RISING_EDGE,  40UL,     CAPTURE_TEST_NO_HIGH, 512UL, 50000000UL, 0U}
+};
+
+static capture_channel_t capture_test_channel;
+/* The stamp checks */
+static unsigned long long capture_test_edge_cycles = ZERO_INIT;
+static uint32_t capture_test_seen_edges = ZERO_INIT;
+static uint32_t capture_test_offset = ZERO_INIT;
+static uint8_t capture_test_offset_set = STD_FALSE;
+static uint32_t capture_test_matched = ZERO_INIT;
+static uint32_t capture_test_mismatched = ZERO_INIT;
+static uint32_t capture_test_late = ZERO_INIT;
+static uint32_t capture_test_held = ZERO_INIT;
+
+static const Timer1_t capture_test_timer = {
+    .TMR1_INTERRUPT_HANDLER = NULL,
+    .priority = PRIORITY_LOW,
+    .prescaler_value = TMR1_PRESCALAR_RATIO_1,
+    .timer1_mode = TMR1_TIMER_MODE,
+    .timer1_counter_synch_mode = TMR1_COUNTER_SYNCH,
+    .timer1_OSC_cfg = TMR1_OSC_DISABLE,
+    .timer1_rw_mode = TMR1_RW_REG_MODE_16BIT
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static Std_ReturnType capture_test_run(const capture_test_run_t *_run);
+static void capture_test_edge(unsigned long long at_cycles, uint8_t rising);
+static void capture_test_check_stamp(void);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_run = ZERO_INIT;
+    uint32_t l_frequency = ZERO_INIT;
+    uint32_t l_period = ZERO_INIT;
+    uint8_t l_silent = STD_FALSE;
+    uint8_t l_passed = STD_TRUE;
+
+    ret = monotonic_clock_init(&capture_test_timer);
+    for(l_run = ZERO_INIT; l_run < (sizeof(capture_test_runs) / sizeof(capture_test_runs[0])); l_run++)
+    {
+        if(E_OK != capture_test_run(&capture_test_runs[l_run]))
+        {
+            l_passed = STD_FALSE;
+        }
+        else
+            { /* Nothing */ }
+    }
+
+    /* The input stops, the last run times out */
+    sim_delay_cycles(CAPTURE_TEST_SILENCE_TICKS);
+    ret |= capture_engine_get_frequency_mhz(&capture_test_channel, &l_frequency);
+    l_silent = (uint8_t)((ZERO_INIT == l_frequency)
+                         && (E_NOT_OK == capture_engine_get_period(&capture_test_channel, &l_period)));
+    printf("silence : %lu.%03lu Hz, the period %s\n", (unsigned long)(l_frequency / 1000UL),
+           (unsigned long)(l_frequency % 1000UL), (STD_TRUE == l_silent) ? "timed out" : "still read");
+    printf("stamps : %lu matched, %lu mismatched, %lu edges late, %lu held by a wrap\n",
+           (unsigned long)capture_test_matched, (unsigned long)capture_test_mismatched,
+           (unsigned long)capture_test_late, (unsigned long)capture_test_held);
+
+    l_passed = (uint8_t)((STD_TRUE == l_passed) && (E_OK == ret) && (STD_TRUE == l_silent)
+                         && (CAPTURE_TEST_STAMPS == capture_test_matched)
+                         && (ZERO_INIT == capture_test_mismatched) && (ZERO_INIT == capture_test_late));
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Starts a channel, drives the periods of a run and checks its
+ *          measurements.
+ * @return (E_NOT_OK) when a measurement is not the expected one.
+ */
+static Std_ReturnType capture_test_run(const capture_test_run_t *_run)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_t l_ccp = {
+        .ccp_module_select = CCP1_MODULE,
+        .ccp_capture_config = _run->capture_config,
+        .ccp_capture_timer = CCP1_CCP2_TMR1,
+        .ccp_interrupt_priority = PRIORITY_HIGH,
+        .pin = {.port = PORTC_INDEX, .pin = PIN2_INDEX, .direction = GPIO_DIRECTION_INPUT}
+    };
+    unsigned long long l_start = ZERO_INIT;
+    uint32_t l_index = ZERO_INIT;
+    uint32_t l_period = ZERO_INIT, l_average = ZERO_INIT, l_frequency = ZERO_INIT;
+    uint32_t l_high = ZERO_INIT, l_average_high = ZERO_INIT;
+    uint16_t l_duty = ZERO_INIT, l_average_duty = ZERO_INIT;
+    uint32_t l_expected_period = _run->period_ticks;
+
+    capture_test_channel.mode = _run->mode;
+    capture_test_channel.timeout_ticks = CAPTURE_TEST_TIMEOUT_TICKS;
+    ret = capture_engine_init(&capture_test_channel, &l_ccp);
+    capture_test_seen_edges = ZERO_INIT;
+
+    /* 1. The input, from a low level */
+    l_start = sim_get_cycles() + CAPTURE_TEST_LEAD_TICKS;
+    for(l_index = ZERO_INIT; l_index < _run->periods; l_index++)
+    {
+        capture_test_edge(l_start + ((unsigned long long)l_index * _run->period_ticks), STD_TRUE);
+        capture_test_edge(l_start + ((unsigned long long)l_index * _run->period_ticks) + _run->high_ticks, STD_FALSE);
+    }
+    sim_delay_cycles(CAPTURE_TEST_TAIL_TICKS);
+    capture_test_check_stamp();
+
+    /* 2. The measurements */
+    ret |= capture_engine_get_period(&capture_test_channel, &l_period);
+    ret |= capture_engine_get_average_period(&capture_test_channel, &l_average);
+    ret |= capture_engine_get_frequency_mhz(&capture_test_channel, &l_frequency);
+    printf("%-18s: period %lu, average %lu ticks, %lu.%03lu Hz", _run->name, (unsigned long)l_period,
+           (unsigned long)l_average, (unsigned long)(l_frequency / 1000UL), (unsigned long)(l_frequency % 1000UL));
+    if((l_expected_period != l_period) || (l_expected_period != l_average) || (_run->frequency_mhz != l_frequency))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+        { /* Nothing */ }
+    if(CAPTURE_ENGINE_MODE_DUTY == _run->mode)
+    {
+        ret |= capture_engine_get_high_time(&capture_test_channel, &l_high, &l_duty);
+        ret |= capture_engine_get_average_high_time(&capture_test_channel, &l_average_high, &l_average_duty);
+        printf(", high %lu (%u per mille), average %lu (%u per mille)", (unsigned long)l_high, l_duty,
+               (unsigned long)l_average_high, l_average_duty);
+        if((_run->high_ticks != l_high) || (_run->high_ticks != l_average_high)
+        || (_run->duty_permille != l_duty) || (_run->duty_permille != l_average_duty))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+            { /* Nothing */ }
+    }
+    else
+        { /* Nothing */ }
+    printf("\n");
+    return ret;
+}
+
+/**
+ * @brief : Applies an edge on the CCP1 input at its cycle, after checking
+ *          the stamp of the edge before.
+ * @param at_cycles : The simulated cycle of the edge.
+ * @param rising : STD_TRUE for a rising edge.
+ */
+static void capture_test_edge(unsigned long long at_cycles, uint8_t rising)
+{
+    unsigned long long l_left = ZERO_INIT;
+    /* An ISR adds its cycles to the delay it runs in, the last cycles one by one */
+    while(sim_get_cycles() < at_cycles)
+    {
+        l_left = at_cycles - sim_get_cycles();
+        sim_delay_cycles((l_left > CAPTURE_TEST_STEP_TICKS) ? (unsigned long)(l_left - CAPTURE_TEST_STEP_TICKS) : 1UL);
+    }
+    if(sim_get_cycles() == at_cycles)
+        { /* Nothing */ }
+    else if(CAPTURE_TEST_TMR1 < CAPTURE_TEST_STEP_TICKS)
+    {
+        /* The overflow routine of the wrap held the edge (the CCP would capture it on time) */
+        capture_test_held++;
+    }
+    else
+    {
+        capture_test_late++;
+    }
+    capture_test_check_stamp();
+    capture_test_edge_cycles = sim_get_cycles();
+    sim_pin_input(PORTC_INDEX, PIN2_INDEX, rising);
+    sim_ccp_capture_edge(1U, rising);
+}
+
+/**
+ * @brief : Compares the newest stamp of the channel (if the last edge was
+ *          captured) with the cycle of that edge. The first stamp sets the
+ *          offset of the clock from the simulated time.
+ */
+static void capture_test_check_stamp(void)
+{
+    uint32_t l_edges = capture_test_channel.edges;
+    uint32_t l_offset = ZERO_INIT;
+    if(l_edges == capture_test_seen_edges)
+        { /* Nothing */ }
+    else if(l_edges != (capture_test_seen_edges + 1U))
+    {
+        /* More than the last edge captured */
+        capture_test_mismatched++;
+    }
+    else
+    {
+        l_offset = capture_test_channel.ring[(l_edges - 1U) & (CAPTURE_ENGINE_RING_SIZE - 1U)]
+                 - (uint32_t)capture_test_edge_cycles;
+        if(STD_FALSE == capture_test_offset_set)
+        {
+            capture_test_offset = l_offset;
+            capture_test_offset_set = STD_TRUE;
+        }
+        else
+            { /* Nothing */ }
+        if(l_offset == capture_test_offset)
+        {
+            capture_test_matched++;
+        }
+        else
+        {
+            capture_test_mismatched++;
+        }
+    }
+    capture_test_seen_edges = l_edges;
+}
+
+#else
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    printf("CCP1 is not in capture mode : build with -DCCP1_CFG_SELECTED_MODE=CCP_CFG_CAPTURE_MODE_SELECTED"
+           " (see the file header)\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,320 @@
+/*
+ * File:   compare_scheduler_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The compare scheduler check (HOST_SIM) <--
+ *
+ * Queues timed pin writes and a callback chain on CCP1 compare (the
+ * monotonic clock on TIMER1, 1:1) and samples LATD every instruction
+ * cycle, then prints every edge against its timestamp :
+ *
+ *  1. D0 up then down, added in the reverse order.
+ *  2. D2 up and down on the same timestamp (the add order, no edge),
+ *     then up 40 ticks later.
+ *  3. D3 up and down past three TIMER1 wraps.
+ *  4. D1 toggled by a callback that queues the next one, every 250 us.
+ *  5. An event already late runs at once.
+ *  6. The queue takes COMPARE_SCHEDULER_QUEUE_SIZE events, no more.
+ *
+ * Every edge must come within COMPARE_SCHEDULER_TEST_LATENCY cycles
+ * after its timestamp (the interrupt entry and the pin write).
+ * LATD is sampled between the routines : the events close enough to run
+ * in one routine (COMPARE_SCHEDULER_SPIN_TICKS and the routine itself)
+ * show their last write only, the timed edges are spaced past that.
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. BENCHMARK/compare_scheduler_test.c \
+ *          MCAL/CCP/compare_scheduler.c MCAL/CCP/ccp.c \
+ *          MCAL/TIMER1/monotonic_clock.c MCAL/TIMER1/timer1.c MCAL/TIMER16/timer16.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The exit code is 0 when the test passes)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/CCP/compare_scheduler.h"
+
+#ifndef HOST_SIM
+#error "The compare scheduler check runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The pins D0 --> D3 */
+#define COMPARE_SCHEDULER_TEST_PINS         4U
+/* The most edges recorded on a pin */
+#define COMPARE_SCHEDULER_TEST_EDGES        32U
+/* The most cycles from a timestamp to its edge */
+#define COMPARE_SCHEDULER_TEST_LATENCY      100L
+/* The callback chain : the toggles, their first timestamp and their period (in ticks) */
+#define COMPARE_SCHEDULER_TEST_STEPS        20U
+#define COMPARE_SCHEDULER_TEST_STEP_START   40000UL
+#define COMPARE_SCHEDULER_TEST_STEP_TICKS   500UL
+/* TMR1, read without the access cycles */
+#define COMPARE_SCHEDULER_TEST_TMR1         ((uint16_t)(SIM_SFR_DIRECT(0xFCE) | (SIM_SFR_DIRECT(0xFCF) << 8)))
+/* The length of the timed run, past the far events (in instruction cycles) */
+#define COMPARE_SCHEDULER_TEST_RUN_CYCLES   210000UL
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef struct {
+    uint8_t pin;
+    uint32_t ticks;             /* The timestamp from the origin */
+} scheduler_test_edge_t;
+
+/* --------------- Section : Global Variables --------------- */
+static const scheduler_test_edge_t scheduler_test_expected[] = {
+    {0U, 2000UL}, {0U, 7000UL},
+    {2U, 10040UL},
+    {3U, 200000UL}, {3U, 200500UL}
+};
+static pin_config_t scheduler_test_pins[COMPARE_SCHEDULER_TEST_PINS];
+static long scheduler_test_edges[COMPARE_SCHEDULER_TEST_PINS][COMPARE_SCHEDULER_TEST_EDGES];
+static uint8_t scheduler_test_edges_number[COMPARE_SCHEDULER_TEST_PINS];
+static uint8_t scheduler_test_previous = ZERO_INIT;
+/* The monotonic clock and the cycles of the origin, one tick a cycle */
+static uint32_t scheduler_test_origin = ZERO_INIT;
+static unsigned long long scheduler_test_origin_cycles = ZERO_INIT;
+static uint8_t scheduler_test_steps = ZERO_INIT;
+static uint32_t scheduler_test_step_timestamp = ZERO_INIT;
+
+static const Timer1_t scheduler_test_clock = {
+    .TMR1_INTERRUPT_HANDLER = NULL,
+    .priority = PRIORITY_LOW,
+    .prescaler_value = TMR1_PRESCALAR_RATIO_1,
+    .timer1_mode = TMR1_TIMER_MODE,
+    .timer1_counter_synch_mode = TMR1_COUNTER_SYNCH,
+    .timer1_OSC_cfg = TMR1_OSC_DISABLE,
+    .timer1_rw_mode = TMR1_RW_REG_MODE_16BIT
+};
+
+static const ccp_t scheduler_test_ccp = {
+    .ccp_module_select = CCP1_MODULE,
+    .ccp_interrupt_priority = PRIORITY_HIGH,
+    .ccp_compare_timer = CCP1_CCP2_TMR1
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static Std_ReturnType scheduler_test_write(uint32_t _ticks, uint8_t _pin, logic_t _logic);
+static void scheduler_test_step(void);
+static void scheduler_test_sample(uint32_t _cycles);
+static uint8_t scheduler_test_check_pin(uint8_t _pin);
+static uint8_t scheduler_test_check_steps(void);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    compare_event_t l_event = {ZERO_INIT};
+    uint8_t l_pin = ZERO_INIT;
+    uint8_t l_pending = ZERO_INIT;
+    uint8_t l_queued = ZERO_INIT;
+    uint8_t l_passed = STD_TRUE;
+
+    ret = monotonic_clock_init(&scheduler_test_clock);
+    for(l_pin = ZERO_INIT; l_pin < COMPARE_SCHEDULER_TEST_PINS; l_pin++)
+    {
+        scheduler_test_pins[l_pin].port = PORTD_INDEX;
+        scheduler_test_pins[l_pin].pin = l_pin;
+        scheduler_test_pins[l_pin].direction = GPIO_DIRECTION_OUTPUT;
+        scheduler_test_pins[l_pin].logic = GPIO_LOW;
+        ret |= gpio_pin_initialize(&scheduler_test_pins[l_pin]);
+    }
+    ret |= compare_scheduler_init(&scheduler_test_ccp);
+    scheduler_test_origin = monotonic_clock_get_ticks();
+    /* The cycle TMR1 was read at, not the return of the read (its unmask takes cycles) */
+    scheduler_test_origin_cycles = sim_get_cycles()
+                                 - (uint16_t)(COMPARE_SCHEDULER_TEST_TMR1 - (uint16_t)scheduler_test_origin);
+
+    /* 1. --> 3. The pin writes */
+    ret |= scheduler_test_write(7000UL, 0U, GPIO_LOW);
+    ret |= scheduler_test_write(2000UL, 0U, GPIO_HIGH);
+    ret |= scheduler_test_write(200000UL, 3U, GPIO_HIGH);
+    ret |= scheduler_test_write(200500UL, 3U, GPIO_LOW);
+    ret |= scheduler_test_write(10000UL, 2U, GPIO_HIGH);
+    ret |= scheduler_test_write(10000UL, 2U, GPIO_LOW);
+    ret |= scheduler_test_write(10040UL, 2U, GPIO_HIGH);
+    /* 4. The callback chain */
+    scheduler_test_step_timestamp = scheduler_test_origin + COMPARE_SCHEDULER_TEST_STEP_START;
+    l_event.timestamp = scheduler_test_step_timestamp;
+    l_event.action = COMPARE_EVENT_CALLBACK;
+    l_event.callback = scheduler_test_step;
+    ret |= compare_scheduler_add(&l_event);
+
+    scheduler_test_sample(COMPARE_SCHEDULER_TEST_RUN_CYCLES);
+    ret |= compare_scheduler_get_pending(&l_pending);
+    printf("pending after the run : %u\n", l_pending);
+    l_passed &= (uint8_t)(ZERO_INIT == l_pending);
+    for(l_pin = ZERO_INIT; l_pin < COMPARE_SCHEDULER_TEST_PINS; l_pin++)
+    {
+        if(1U == l_pin)
+        {
+            l_passed &= scheduler_test_check_steps();
+        }
+        else
+        {
+            l_passed &= scheduler_test_check_pin(l_pin);
+        }
+    }
+
+    /* 5. A late event */
+    scheduler_test_edges_number[0] = ZERO_INIT;
+    scheduler_test_origin = monotonic_clock_get_ticks();
+    scheduler_test_origin_cycles = sim_get_cycles();
+    ret |= scheduler_test_write((uint32_t)-500L, 0U, GPIO_HIGH);
+    scheduler_test_sample(1000UL);
+    printf("late event : %u edge, %ld cycles after the add\n", scheduler_test_edges_number[0],
+           (ZERO_INIT != scheduler_test_edges_number[0]) ? scheduler_test_edges[0][0] : -1L);
+    l_passed &= (uint8_t)((1U == scheduler_test_edges_number[0])
+                          && (scheduler_test_edges[0][0] <= COMPARE_SCHEDULER_TEST_LATENCY));
+
+    /* 6. The full queue */
+    ret |= compare_scheduler_clear();
+    for(l_pin = ZERO_INIT; l_pin < (COMPARE_SCHEDULER_QUEUE_SIZE + 4U); l_pin++)
+    {
+        if(E_OK == scheduler_test_write(1000000UL, 0U, GPIO_LOW))
+        {
+            l_queued++;
+        }
+        else
+            { /* Nothing */ }
+    }
+    printf("full queue : %u of %u events queued\n", l_queued, COMPARE_SCHEDULER_QUEUE_SIZE + 4U);
+    l_passed &= (uint8_t)(COMPARE_SCHEDULER_QUEUE_SIZE == l_queued);
+    ret |= compare_scheduler_clear();
+
+    l_passed &= (uint8_t)(E_OK == ret);
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Queues a write of (_logic) on the pin (_pin) at (_ticks) from the origin.
+ */
+static Std_ReturnType scheduler_test_write(uint32_t _ticks, uint8_t _pin, logic_t _logic)
+{
+    compare_event_t l_event = {ZERO_INIT};
+    l_event.timestamp = scheduler_test_origin + _ticks;
+    l_event.action = COMPARE_EVENT_PIN_WRITE;
+    l_event.pin = scheduler_test_pins[_pin];
+    l_event.pin.logic = _logic;
+    return compare_scheduler_add(&l_event);
+}
+
+/**
+ * @brief : The callback of the chain (in the ISR), toggles D1 and
+ *          queues the next step.
+ */
+static void scheduler_test_step(void)
+{
+    compare_event_t l_event = {ZERO_INIT};
+    (void)gpio_pin_toggle_logic(&scheduler_test_pins[1]);
+    scheduler_test_steps++;
+    if(scheduler_test_steps < COMPARE_SCHEDULER_TEST_STEPS)
+    {
+        scheduler_test_step_timestamp += COMPARE_SCHEDULER_TEST_STEP_TICKS;
+        l_event.timestamp = scheduler_test_step_timestamp;
+        l_event.action = COMPARE_EVENT_CALLBACK;
+        l_event.callback = scheduler_test_step;
+        (void)compare_scheduler_add(&l_event);
+    }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : Runs (_cycles) instruction cycles and records the edges of
+ *          D0 --> D3 from the origin (LATD is read directly, the sampling
+ *          takes no cycle).
+ */
+static void scheduler_test_sample(uint32_t _cycles)
+{
+    uint32_t l_cycle = ZERO_INIT;
+    uint8_t l_pin = ZERO_INIT;
+    uint8_t l_latd = ZERO_INIT;
+
+    for(l_cycle = ZERO_INIT; l_cycle < _cycles; l_cycle++)
+    {
+        sim_delay_cycles(1UL);
+        l_latd = LATD;
+        for(l_pin = ZERO_INIT; l_pin < COMPARE_SCHEDULER_TEST_PINS; l_pin++)
+        {
+            if(((l_latd ^ scheduler_test_previous) & (1U << l_pin))
+               && (scheduler_test_edges_number[l_pin] < COMPARE_SCHEDULER_TEST_EDGES))
+            {
+                scheduler_test_edges[l_pin][scheduler_test_edges_number[l_pin]++] =
+                    (long)(sim_get_cycles() - scheduler_test_origin_cycles);
+            }
+            else
+                { /* Nothing */ }
+        }
+        scheduler_test_previous = l_latd;
+    }
+}
+
+/**
+ * @brief : Prints the edges of a pin and checks them against their timestamps.
+ * @return STD_TRUE when every expected edge came in time, and no other one.
+ */
+static uint8_t scheduler_test_check_pin(uint8_t _pin)
+{
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_edge = ZERO_INIT;
+    uint8_t l_passed = STD_TRUE;
+    long l_late = ZERO_INIT;
+
+    printf("D%u :", _pin);
+    for(l_index = ZERO_INIT; l_index < (sizeof(scheduler_test_expected) / sizeof(scheduler_test_expected[0])); l_index++)
+    {
+        if(_pin == scheduler_test_expected[l_index].pin)
+        {
+            if(l_edge < scheduler_test_edges_number[_pin])
+            {
+                l_late = scheduler_test_edges[_pin][l_edge] - (long)scheduler_test_expected[l_index].ticks;
+                printf(" %lu (%+ld)", (unsigned long)scheduler_test_expected[l_index].ticks, l_late);
+                l_passed &= (uint8_t)((l_late >= 0L) && (l_late <= COMPARE_SCHEDULER_TEST_LATENCY));
+            }
+            else
+            {
+                printf(" %lu (missed)", (unsigned long)scheduler_test_expected[l_index].ticks);
+                l_passed = STD_FALSE;
+            }
+            l_edge++;
+        }
+        else
+            { /* Nothing */ }
+    }
+    printf(", %u edges\n", scheduler_test_edges_number[_pin]);
+    l_passed &= (uint8_t)(l_edge == scheduler_test_edges_number[_pin]);
+    return l_passed;
+}
+
+/**
+ * @brief : Prints the callback chain toggles of D1 and checks them.
+ * @return STD_TRUE when every toggle came in time.
+ */
+static uint8_t scheduler_test_check_steps(void)
+{
+    uint8_t l_step = ZERO_INIT;
+    long l_late = ZERO_INIT;
+    long l_late_min = 0x7FFFFFFFL;
+    long l_late_max = -1L;
+
+    for(l_step = ZERO_INIT; l_step < scheduler_test_edges_number[1]; l_step++)
+    {
+        l_late = scheduler_test_edges[1][l_step]
+               - (long)(COMPARE_SCHEDULER_TEST_STEP_START + (l_step * COMPARE_SCHEDULER_TEST_STEP_TICKS));
+        if(l_late < l_late_min) { l_late_min = l_late; }
+        else { /* Nothing */ }
+        if(l_late > l_late_max) { l_late_max = l_late; }
+        else { /* Nothing */ }
+    }
+    printf("D1 : %u of %u chained toggles, %ld..%ld cycles late\n", scheduler_test_edges_number[1],
+           COMPARE_SCHEDULER_TEST_STEPS, l_late_min, l_late_max);
+    return (uint8_t)((COMPARE_SCHEDULER_TEST_STEPS == scheduler_test_edges_number[1])
+                     && (l_late_min >= 0L) && (l_late_max <= COMPARE_SCHEDULER_TEST_LATENCY));
+}
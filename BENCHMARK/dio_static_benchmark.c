@@ -0,0 +1,164 @@
+/*
+ * File:   dio_static_benchmark.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The static pin access benchmark (HOST_SIM) <--
+ *
+ * Counts the simulated instruction cycles of the same pin work done through
+ * the DIO functions and through the compile-time resolved macros :
+ *  - DIO_STATIC_BENCHMARK_WRITES writes of the status LED,
+ *    gpio_pin_write_logic() against GPIO_BOARD_PIN_WRITE().
+ *  - DIO_STATIC_BENCHMARK_SCANS keypad scans,
+ *    keypad_get_value() against keypad_static_get_value().
+ * Built with the call cost model of the simulator (the BENCHMARK loops
+ * themselves are not charged) :
+ *
+ *      gcc -std=gnu11 -DHOST_SIM -I. -finstrument-functions \
+ *          -finstrument-functions-exclude-file-list=HOST_SIM,BENCHMARK \
+ *          BENCHMARK/dio_static_benchmark.c ECUAL/Keypad/keypad.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * The pin registers are free in the simulator and so are the function
+ * bodies, the figures are the CALL/RETURN cycles only : a lower bound of the
+ * gain on the target. The two keypad scans must return the same key.
+ * (The exit code is 0 when the test passes)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/DIO/DIO.h"
+#include "../ECUAL/Keypad/keypad.h"
+
+#ifndef HOST_SIM
+#error "The static pin benchmark runs on the HOST_SIM backend only"
+#endif
+
+#if DIO_STATIC_PIN_CONFIGURATION==CONFIG_DISABLE
+#error "The static pin benchmark needs DIO_STATIC_PIN_CONFIGURATION"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The status LED writes of every run */
+#define DIO_STATIC_BENCHMARK_WRITES     1000U
+/* The keypad scans of every run */
+#define DIO_STATIC_BENCHMARK_SCANS      100U
+/* The key read with column 1 held HIGH (the last row wins --> '0') */
+#define DIO_STATIC_BENCHMARK_KEY        '0'
+
+/* --------------- Section : Global Variables --------------- */
+static const pin_config_t benchmark_led =
+        GPIO_BOARD_PIN_CONFIG(BOARD_PIN_STATUS_LED, GPIO_DIRECTION_OUTPUT, GPIO_LOW);
+
+static keypad_t benchmark_keypad = {
+    .keypad_row_pins[0] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_ROW0, GPIO_DIRECTION_OUTPUT, GPIO_LOW),
+    .keypad_row_pins[1] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_ROW1, GPIO_DIRECTION_OUTPUT, GPIO_LOW),
+    .keypad_row_pins[2] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_ROW2, GPIO_DIRECTION_OUTPUT, GPIO_LOW),
+    .keypad_row_pins[3] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_ROW3, GPIO_DIRECTION_OUTPUT, GPIO_LOW),
+    .keypad_columns_pins[0] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_COL0, GPIO_DIRECTION_INPUT, GPIO_LOW),
+    .keypad_columns_pins[1] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_COL1, GPIO_DIRECTION_INPUT, GPIO_LOW),
+    .keypad_columns_pins[2] = GPIO_BOARD_PIN_CONFIG(BOARD_PIN_KEYPAD_COL2, GPIO_DIRECTION_INPUT, GPIO_LOW),
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void benchmark_print(const char *_name, unsigned long long _cycles,
+                            unsigned long _calls, unsigned int _runs);
+static void benchmark_press_key(void);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    unsigned long long l_start = 0;
+    unsigned long l_calls = 0;
+    unsigned long long l_write_function = 0, l_write_static = 0;
+    unsigned long long l_scan_function = 0, l_scan_static = 0;
+    unsigned int l_run = 0;
+    uint8_t l_key_function = ZERO_INIT, l_key_static = ZERO_INIT;
+    uint8_t l_passed = STD_FALSE;
+
+    /* 1. The status LED */
+    sim_reset();
+    ret |= gpio_pin_initialize(&benchmark_led);
+    l_start = sim_get_cycles();
+    l_calls = sim_get_calls();
+    for(l_run = 0; l_run < DIO_STATIC_BENCHMARK_WRITES; l_run++)
+    {
+        ret |= gpio_pin_write_logic(&benchmark_led, (logic_t)(l_run & 1U));
+    }
+    l_write_function = sim_get_cycles() - l_start;
+    benchmark_print("gpio_pin_write_logic()", l_write_function,
+                    sim_get_calls() - l_calls, DIO_STATIC_BENCHMARK_WRITES);
+    if(ZERO_INIT == sim_get_calls())
+    {
+        printf("Built without -finstrument-functions, the calls are free\n");
+    }
+    else
+        { /* Nothing */ }
+    l_start = sim_get_cycles();
+    l_calls = sim_get_calls();
+    for(l_run = 0; l_run < DIO_STATIC_BENCHMARK_WRITES; l_run++)
+    {
+        GPIO_BOARD_PIN_WRITE(BOARD_PIN_STATUS_LED, (l_run & 1U));
+    }
+    l_write_static = sim_get_cycles() - l_start;
+    benchmark_print("GPIO_BOARD_PIN_WRITE()", l_write_static,
+                    sim_get_calls() - l_calls, DIO_STATIC_BENCHMARK_WRITES);
+
+    /* 2. The keypad */
+    sim_reset();
+    ret |= keypad_initialize(&benchmark_keypad);
+    benchmark_press_key();
+    l_start = sim_get_cycles();
+    l_calls = sim_get_calls();
+    for(l_run = 0; l_run < DIO_STATIC_BENCHMARK_SCANS; l_run++)
+    {
+        ret |= keypad_get_value(&benchmark_keypad, &l_key_function);
+    }
+    l_scan_function = sim_get_cycles() - l_start;
+    benchmark_print("keypad_get_value()", l_scan_function,
+                    sim_get_calls() - l_calls, DIO_STATIC_BENCHMARK_SCANS);
+
+    sim_reset();
+    ret |= keypad_static_initialize();
+    benchmark_press_key();
+    l_start = sim_get_cycles();
+    l_calls = sim_get_calls();
+    for(l_run = 0; l_run < DIO_STATIC_BENCHMARK_SCANS; l_run++)
+    {
+        ret |= keypad_static_get_value(&l_key_static);
+    }
+    l_scan_static = sim_get_cycles() - l_start;
+    benchmark_print("keypad_static_get_value()", l_scan_static,
+                    sim_get_calls() - l_calls, DIO_STATIC_BENCHMARK_SCANS);
+    printf("Keys : function '%c', static '%c'\n", l_key_function, l_key_static);
+
+    l_passed = (uint8_t)((E_OK == ret) && (l_write_static < l_write_function) &&
+                         (l_scan_static < l_scan_function) &&
+                         (DIO_STATIC_BENCHMARK_KEY == l_key_function) &&
+                         (l_key_static == l_key_function));
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Prints the cycles and the calls of one measured loop.
+ */
+static void benchmark_print(const char *_name, unsigned long long _cycles,
+                            unsigned long _calls, unsigned int _runs)
+{
+    printf("%-26s: %7llu cycles, %5lu calls, %5.1f cycles per run\n",
+           _name, _cycles, _calls, (double)_cycles / (double)_runs);
+}
+
+/**
+ * @brief : Holds column 1 HIGH. The simulator does not wire the rows to the
+ *          columns, so every row sees the column HIGH and the last scanned
+ *          row sets the key, the same for both scans.
+ */
+static void benchmark_press_key(void)
+{
+    sim_pin_input(PORTB_INDEX, PIN5_INDEX, GPIO_HIGH);
+}
@@ -0,0 +1,229 @@
+/*
+ * File:   driver_benchmark.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The drivers benchmark <--
+ *
+ * Times the main calls of the DIO, LCD, USART, SPI, I2C, ADC and EEPROM
+ * drivers with the bench module and writes the results over the EUSART
+ * (9600 baud), compare the dumps of two releases to catch regressions.
+ *
+ * Wiring : LCD RS RD0, EN RD1, D4..D7 RD2..RD5 | DIO pin RD6, port PORTB |
+ *          EUSART RC6/RC7 | SPI then I2C on the MSSP (RC3/RC4/RC5) | ADC AN0.
+ * (TIMER1 is the bench clock, EEPROM bytes 0x00 --> 0x1F are overwritten)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include "../MCAL/BENCH/bench.h"
+#include "../MCAL/DIO/DIO.h"
+#include "../MCAL/USART/usart.h"
+#include "../MCAL/SPI/spi.h"
+#include "../MCAL/I2C/i2c.h"
+#include "../MCAL/ADC/hal_adc.h"
+#include "../MCAL/EEPROM/hal_eeprom.h"
+#include "../ECUAL/LCD/lcd.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The runs of every timed call */
+#define DRIVER_BENCHMARK_RUNS           32U
+/* The address written on the I2C bus (no device has to answer) */
+#define DRIVER_BENCHMARK_I2C_ADDRESS    0xA0U
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef enum
+{
+    BENCH_REGION_DIO_PIN_WRITE = 0,
+    BENCH_REGION_DIO_PORT_WRITE,
+    BENCH_REGION_LCD_CHAR,
+    BENCH_REGION_LCD_STRING,
+    BENCH_REGION_USART_BYTE,
+    BENCH_REGION_SPI_BYTE,
+    BENCH_REGION_I2C_FRAME,
+    BENCH_REGION_ADC_CONVERSION,
+    BENCH_REGION_EEPROM_WRITE,
+    BENCH_REGION_EEPROM_READ,
+    BENCH_REGIONS_USED
+} driver_benchmark_region_t;
+
+/* --------------- Section : Global Variables --------------- */
+static const uint8_t *const driver_benchmark_names[BENCH_REGIONS_USED] = {
+    (const uint8_t *)"DIO_PIN",     (const uint8_t *)"DIO_PORT",
+    (const uint8_t *)"LCD_CHAR",    (const uint8_t *)"LCD_STRING",
+    (const uint8_t *)"USART_BYTE",  (const uint8_t *)"SPI_BYTE",
+    (const uint8_t *)"I2C_FRAME",   (const uint8_t *)"ADC",
+    (const uint8_t *)"EEPROM_WR",   (const uint8_t *)"EEPROM_RD"
+};
+
+static pin_config_t bench_pin = {
+    .port = PORTD_INDEX, .pin = PIN6_INDEX,
+    .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW
+};
+
+static lcd_4bit_t bench_lcd = {
+    .lcd_rs_pin = {.port = PORTD_INDEX, .pin = PIN0_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    .lcd_en_pin = {.port = PORTD_INDEX, .pin = PIN1_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    .lcd_data_pins[0] = {.port = PORTD_INDEX, .pin = PIN2_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    .lcd_data_pins[1] = {.port = PORTD_INDEX, .pin = PIN3_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    .lcd_data_pins[2] = {.port = PORTD_INDEX, .pin = PIN4_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    .lcd_data_pins[3] = {.port = PORTD_INDEX, .pin = PIN5_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW}
+};
+
+static const usart_t bench_usart = {
+    .baudrate = 9600,
+    .baudrate_generator_gonfigs = BAUDRATE_ASYN_16BIT_HIGH_SPEED,
+    .usart_tx_cfgs.usart_tx_enable = EUSART_ASYNC_TX_ENABLE,
+#if EUSART_TX_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+    /* The blocking writes enable TXIE, the TX routine must be there to clear it
+     * or the pending TXIF starves the low priority TIMER1 overflow of the bench */
+    .usart_tx_cfgs.usart_tx_interrupt_enable = EUSART_ASYNC_INTERRUPT_TX_ENABLE,
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    .usart_tx_cfgs.usart_tx_interrupt_priority = PRIORITY_LOW,
+#endif
+#endif
+    .usart_rx_cfgs.usart_rx_enable = EUSART_ASYNC_RX_DISABLE
+};
+
+static const SPI_Master_t bench_spi = {
+    .Clock_Idle_State_Mode = SPI_CLOCK_IDLE_LOW_LEVEL_CFG,
+    .Clock_Phase_Mode = SPI_CLOCK_PHASE_TRANSMIT_AT_TRAILING_EDGE,
+    .sample_data = SPI_MASTER_SAMPLED_AT_MIDDLE_OF_DATA_OUTPUT_TIME,
+    .master_clk_rate = SPI_MASTER_MODE_CLOCK_FOSC_DEV_4
+};
+
+static const i2c_t bench_i2c = {
+    .i2c_master_clock_freq = 100000UL,
+    .i2c_cfg.i2c_mode = I2C_MASTER_MODE,
+    .i2c_cfg.i2c_mode_config = I2C_MASTER_MODE_SSPADD_CLOCK,
+    .i2c_cfg.i2c_slew_rate_stat = I2C_SLEW_RATE_DISABLE,
+    .i2c_cfg.i2c_SMBus_stat = I2C_SMBUS_DISABLE
+};
+
+static const adc_cfg_t bench_adc = {
+    .acquisition_time = ADC_12_ATD,
+    .conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_16,
+    .adc_channel = ADC_CHANNEL_AN0,
+    .voltage_reference = ADC_VOLTAGE_REFERENCE_DISABLED,
+    .result_format = ADC_RESULT_RIGHT
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static Std_ReturnType driver_benchmark_run(void);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+
+    ret |= bench_init();
+    for(l_index = ZERO_INIT; l_index < BENCH_REGIONS_USED; l_index++)
+    {
+        ret |= bench_set_name(l_index, driver_benchmark_names[l_index]);
+    }
+    ret |= USART_ASYNC_Init(&bench_usart);
+    ret |= driver_benchmark_run();
+
+    ret |= USART_ASYNC_Write_String_With_Blocking((const uint8_t *)"BENCH overhead ");
+    ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)bench_get_overhead());
+    ret |= USART_ASYNC_Write_String_With_Blocking((E_OK == ret) ? (const uint8_t *)" OK\r\n"
+                                                                : (const uint8_t *)" ERROR\r\n");
+    ret |= bench_dump();
+    while(1)
+    {
+        /* Nothing, reset the board to run the benchmark again */
+    }
+    return 0;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Initializes every driver and times its calls
+ *          (DRIVER_BENCHMARK_RUNS) times.
+ */
+static Std_ReturnType driver_benchmark_run(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_run = ZERO_INIT;
+    uint8_t l_data = ZERO_INIT;
+    uint8_t l_ack = ZERO_INIT;
+    adc_result_t l_conversion = ZERO_INIT;
+
+    /* 1. DIO */
+    ret |= gpio_pin_initialize(&bench_pin);
+    ret |= gpio_port_direction_init(PORTB_INDEX, 0x00);
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_DIO_PIN_WRITE);
+        ret |= gpio_pin_write_logic(&bench_pin, (logic_t)(l_run & 0x01));
+        BENCH_END(BENCH_REGION_DIO_PIN_WRITE);
+        BENCH_BEGIN(BENCH_REGION_DIO_PORT_WRITE);
+        ret |= gpio_port_write_logic(PORTB_INDEX, (logic_t)l_run);
+        BENCH_END(BENCH_REGION_DIO_PORT_WRITE);
+    }
+
+    /* 2. LCD */
+    ret |= lcd_4bit_initialize(&bench_lcd);
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_LCD_CHAR);
+        ret |= lcd_4bit_send_char_data(&bench_lcd, (uint8_t)('A' + (l_run & 0x0F)));
+        BENCH_END(BENCH_REGION_LCD_CHAR);
+        BENCH_BEGIN(BENCH_REGION_LCD_STRING);
+        ret |= lcd_4bit_send_string(&bench_lcd, (uint8_t *)"BENCH");
+        BENCH_END(BENCH_REGION_LCD_STRING);
+    }
+
+    /* 3. USART (one byte at 9600 baud is 1042 us) */
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_USART_BYTE);
+        ret |= USART_ASYNC_Write_Byte_With_Blocking('.');
+        BENCH_END(BENCH_REGION_USART_BYTE);
+    }
+    ret |= USART_ASYNC_Write_String_With_Blocking((const uint8_t *)"\r\n");
+
+    /* 4. SPI, the MSSP is released for the I2C */
+    ret |= SPI_Init_Master(&bench_spi);
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_SPI_BYTE);
+        ret |= SPI_Write_Byte_Blocking(l_run);
+        BENCH_END(BENCH_REGION_SPI_BYTE);
+    }
+    ret |= SPI_DeInit_Master(&bench_spi);
+
+    /* 5. I2C, one address frame : start, address, stop */
+    ret |= I2C_Init(&bench_i2c);
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_I2C_FRAME);
+        ret |= I2C_Master_Send_Start(&bench_i2c);
+        ret |= I2C_Write_Byte_Blocking(&bench_i2c, DRIVER_BENCHMARK_I2C_ADDRESS, &l_ack);
+        ret |= I2C_Master_Send_Stop(&bench_i2c);
+        BENCH_END(BENCH_REGION_I2C_FRAME);
+    }
+    ret |= I2C_DeInit(&bench_i2c);
+
+    /* 6. ADC */
+    ret |= ADC_init(&bench_adc);
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_ADC_CONVERSION);
+        ret |= ADC_get_conversion_blocking(&bench_adc, &l_conversion);
+        BENCH_END(BENCH_REGION_ADC_CONVERSION);
+    }
+
+    /* 7. EEPROM */
+    for(l_run = ZERO_INIT; l_run < DRIVER_BENCHMARK_RUNS; l_run++)
+    {
+        BENCH_BEGIN(BENCH_REGION_EEPROM_WRITE);
+        ret |= EEPROM_write_byte((uint16_t)l_run, l_run);
+        BENCH_END(BENCH_REGION_EEPROM_WRITE);
+        BENCH_BEGIN(BENCH_REGION_EEPROM_READ);
+        ret |= EEPROM_read_byte((uint16_t)l_run, &l_data);
+        BENCH_END(BENCH_REGION_EEPROM_READ);
+    }
+    return ret;
+}
@@ -0,0 +1,326 @@
+/*
+ * File:   interrupt_dispatch_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The interrupt dispatch test (HOST_SIM) <--
+ *
+ * Counts the cycles from the flag of every interrupt source to the first
+ * instruction of its routine on the high vector :
+ *  - one : the 16 sources are registered, only this one is enabled.
+ *  - all : the 16 sources are registered and enabled.
+ * (only the flag of the measured source is set)
+ * Then sets the 16 flags at once, on the high vector then on the low one
+ * (INT0 stays high), every routine must run once in the rank order.
+ *
+ * Built twice with the call cost model of the simulator, the direct chain
+ * (default) then the table walk (the baseline) :
+ *
+ *      gcc -std=gnu11 -DHOST_SIM -I. -finstrument-functions \
+ *          -finstrument-functions-exclude-file-list=HOST_SIM,BENCHMARK \
+ *          BENCHMARK/interrupt_dispatch_test.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ *      (same line with -DINTERRUPT_DISPATCH_CHAIN_FEATURE=INTERRUPT_DISABLE)
+ *
+ * The cycles include SIM_INTERRUPT_LATENCY_CYCLES and the CALL of the vector,
+ * the register reads (the table walk also loads the register pointers) and
+ * the CALL/RETURN are charged, the loop and the C code around them are not.
+ * (The exit code is 0 when the test passes)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/Interrupt/MCAL_interrupt_manager.h"
+
+#ifndef HOST_SIM
+#error "The dispatch test runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The cycles given to every interrupt to be served */
+#define INTERRUPT_DISPATCH_TEST_WAIT    400UL
+
+/* --------------- Section: Data Type Declarations --------------- */
+/* The flag bit of a source (the same bits as the manager) */
+typedef struct {
+    unsigned int flag_address;
+    uint8_t flag_bit;
+    uint8_t rank;
+} dispatch_test_source_t;
+
+/* --------------- Section : Global Variables --------------- */
+static const dispatch_test_source_t dispatch_test_sources[INTERRUPT_SOURCES_NUMBER] = {
+    {0xFF2, 1, INTERRUPT_DISPATCH_RANK_INT0},           /* INTCON<1> */
+    {0xFF0, 0, INTERRUPT_DISPATCH_RANK_INT1},           /* INTCON3<0> */
+    {0xFF0, 1, INTERRUPT_DISPATCH_RANK_INT2},           /* INTCON3<1> */
+    {0xFF2, 0, INTERRUPT_DISPATCH_RANK_RBx},            /* INTCON<0> */
+    {0xFF2, 2, INTERRUPT_DISPATCH_RANK_TMR0},           /* INTCON<2> */
+    {0xF9E, 0, INTERRUPT_DISPATCH_RANK_TMR1},           /* PIR1<0> */
+    {0xF9E, 1, INTERRUPT_DISPATCH_RANK_TMR2},           /* PIR1<1> */
+    {0xFA1, 1, INTERRUPT_DISPATCH_RANK_TMR3},           /* PIR2<1> */
+    {0xF9E, 2, INTERRUPT_DISPATCH_RANK_CCP1},           /* PIR1<2> */
+    {0xFA1, 0, INTERRUPT_DISPATCH_RANK_CCP2},           /* PIR2<0> */
+    {0xF9E, 6, INTERRUPT_DISPATCH_RANK_ADC},            /* PIR1<6> */
+    {0xF9E, 4, INTERRUPT_DISPATCH_RANK_EUSART_TX},      /* PIR1<4> */
+    {0xF9E, 5, INTERRUPT_DISPATCH_RANK_EUSART_RX},      /* PIR1<5> */
+    {0xF9E, 3, INTERRUPT_DISPATCH_RANK_MSSP},           /* PIR1<3> */
+    {0xFA1, 3, INTERRUPT_DISPATCH_RANK_BUS_COLLISION},  /* PIR2<3> */
+    {0xFA1, 4, INTERRUPT_DISPATCH_RANK_EEPROM}          /* PIR2<4> */
+};
+
+static const char *const dispatch_test_names[INTERRUPT_SOURCES_NUMBER] = {
+    "INT0", "INT1", "INT2", "RBx", "TMR0", "TMR1", "TMR2", "TMR3",
+    "CCP1", "CCP2", "ADC", "EUSART_TX", "EUSART_RX", "MSSP", "BCL", "EEPROM"
+};
+
+/* The routines record their call time and their call order */
+static unsigned long long dispatch_test_called_at[INTERRUPT_SOURCES_NUMBER];
+static uint8_t dispatch_test_calls[INTERRUPT_SOURCES_NUMBER];
+static uint8_t dispatch_test_order[INTERRUPT_SOURCES_NUMBER];
+static uint8_t dispatch_test_order_size = ZERO_INIT;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void dispatch_test_handle(interrupt_source_t source);
+static void dispatch_test_setup(uint8_t _all, interrupt_source_t source, interrupt_priority_t priority);
+static void dispatch_test_source_enable(interrupt_source_t source, uint8_t _enable);
+static void dispatch_test_flag_set(interrupt_source_t source);
+static unsigned long dispatch_test_latency(uint8_t _all, interrupt_source_t source);
+static uint8_t dispatch_test_all_flags(interrupt_priority_t priority);
+
+/* One routine per source (the handler type has no argument) */
+#define DISPATCH_TEST_HANDLER(_SOURCE_) \
+    static void dispatch_test_handler_##_SOURCE_(void) { dispatch_test_handle(INTERRUPT_SOURCE_##_SOURCE_); }
+DISPATCH_TEST_HANDLER(INT0)
+DISPATCH_TEST_HANDLER(INT1)
+DISPATCH_TEST_HANDLER(INT2)
+DISPATCH_TEST_HANDLER(RBx)
+DISPATCH_TEST_HANDLER(TMR0)
+DISPATCH_TEST_HANDLER(TMR1)
+DISPATCH_TEST_HANDLER(TMR2)
+DISPATCH_TEST_HANDLER(TMR3)
+DISPATCH_TEST_HANDLER(CCP1)
+DISPATCH_TEST_HANDLER(CCP2)
+DISPATCH_TEST_HANDLER(ADC)
+DISPATCH_TEST_HANDLER(EUSART_TX)
+DISPATCH_TEST_HANDLER(EUSART_RX)
+DISPATCH_TEST_HANDLER(MSSP)
+DISPATCH_TEST_HANDLER(BUS_COLLISION)
+DISPATCH_TEST_HANDLER(EEPROM)
+
+static const interrupt_handler_t dispatch_test_handlers[INTERRUPT_SOURCES_NUMBER] = {
+    dispatch_test_handler_INT0,      dispatch_test_handler_INT1,      dispatch_test_handler_INT2,
+    dispatch_test_handler_RBx,       dispatch_test_handler_TMR0,      dispatch_test_handler_TMR1,
+    dispatch_test_handler_TMR2,      dispatch_test_handler_TMR3,      dispatch_test_handler_CCP1,
+    dispatch_test_handler_CCP2,      dispatch_test_handler_ADC,       dispatch_test_handler_EUSART_TX,
+    dispatch_test_handler_EUSART_RX, dispatch_test_handler_MSSP,      dispatch_test_handler_BUS_COLLISION,
+    dispatch_test_handler_EEPROM
+};
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    uint8_t l_source = ZERO_INIT;
+    unsigned long l_alone = 0, l_all = 0;
+    unsigned long l_alone_sum = 0, l_all_sum = 0;
+    unsigned long l_alone_max = 0, l_all_max = 0;
+    uint8_t l_order_high = STD_FALSE, l_order_low = STD_FALSE;
+    uint8_t l_passed = STD_TRUE;
+
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+    printf("Dispatch : direct chain\n");
+#else
+    printf("Dispatch : table walk\n");
+#endif
+    if(ZERO_INIT == sim_get_calls())
+    {
+        (void)Interrupt_Manager_Register(INTERRUPT_SOURCE_INT0, dispatch_test_handlers[INTERRUPT_SOURCE_INT0]);
+        if(ZERO_INIT == sim_get_calls())
+        {
+            printf("Built without -finstrument-functions, the calls are free\n");
+        }
+        else
+            { /* Nothing */ }
+    }
+    else
+        { /* Nothing */ }
+    printf("source     rank     one     all (cycles from the flag to the routine)\n");
+    for(l_source = ZERO_INIT; l_source < INTERRUPT_SOURCES_NUMBER; l_source++)
+    {
+        l_alone = dispatch_test_latency(STD_FALSE, (interrupt_source_t)l_source);
+        l_all = dispatch_test_latency(STD_TRUE, (interrupt_source_t)l_source);
+        printf("%-10s %4u %7lu %7lu\n", dispatch_test_names[l_source],
+               dispatch_test_sources[l_source].rank, l_alone, l_all);
+        if((ZERO_INIT == l_alone) || (ZERO_INIT == l_all))
+            { l_passed = STD_FALSE; }
+        else
+            { /* Nothing */ }
+        l_alone_sum += l_alone;
+        l_all_sum += l_all;
+        l_alone_max = (l_alone > l_alone_max) ? l_alone : l_alone_max;
+        l_all_max = (l_all > l_all_max) ? l_all : l_all_max;
+    }
+    printf("average         %7.1f %7.1f\n", (double)l_alone_sum / INTERRUPT_SOURCES_NUMBER,
+           (double)l_all_sum / INTERRUPT_SOURCES_NUMBER);
+    printf("worst           %7lu %7lu\n", l_alone_max, l_all_max);
+
+    l_order_high = dispatch_test_all_flags(PRIORITY_HIGH);
+    l_order_low = dispatch_test_all_flags(PRIORITY_LOW);
+    printf("16 flags at once : high vector %s, low vector %s\n",
+           (STD_TRUE == l_order_high) ? "in rank order" : "WRONG",
+           (STD_TRUE == l_order_low) ? "in rank order" : "WRONG");
+
+    l_passed = (uint8_t)((STD_TRUE == l_passed) && (STD_TRUE == l_order_high) && (STD_TRUE == l_order_low));
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : The routine of every source, records the call then disables the
+ *          source (some flags, TXIF, can't be cleared by the program).
+ */
+static void dispatch_test_handle(interrupt_source_t source)
+{
+    dispatch_test_called_at[source] = sim_get_cycles();
+    dispatch_test_calls[source]++;
+    if(dispatch_test_order_size < INTERRUPT_SOURCES_NUMBER)
+    {
+        dispatch_test_order[dispatch_test_order_size++] = (uint8_t)source;
+    }
+    else
+        { /* Nothing */ }
+    dispatch_test_source_enable(source, STD_FALSE);
+}
+
+/**
+ * @brief : Resets the simulator, registers the 16 sources at the given
+ *          priority (the registrations outlive the reset), enables one source
+ *          (or all of them) and the interrupts.
+ */
+static void dispatch_test_setup(uint8_t _all, interrupt_source_t source, interrupt_priority_t priority)
+{
+    uint8_t l_source = ZERO_INIT;
+    sim_reset();
+    for(l_source = ZERO_INIT; l_source < INTERRUPT_SOURCES_NUMBER; l_source++)
+    {
+        dispatch_test_called_at[l_source] = 0;
+        dispatch_test_calls[l_source] = ZERO_INIT;
+        (void)Interrupt_Manager_Set_Priority((interrupt_source_t)l_source, priority);
+        (void)Interrupt_Manager_Register((interrupt_source_t)l_source, dispatch_test_handlers[l_source]);
+        if((STD_TRUE == _all) || (l_source == (uint8_t)source))
+        {
+            dispatch_test_source_enable((interrupt_source_t)l_source, STD_TRUE);
+        }
+        else
+            { /* Nothing */ }
+    }
+    dispatch_test_order_size = ZERO_INIT;
+    INTERRUPT_PRIORITY_ENABLE();
+    INTERRUPT_GIEH_ENABLE();
+    INTERRUPT_GIEL_ENABLE();
+    sim_sync();
+}
+
+/**
+ * @brief : Sets or clears the enable bit of a source.
+ */
+static void dispatch_test_source_enable(interrupt_source_t source, uint8_t _enable)
+{
+    volatile uint8_t *l_enable_register = NULL;
+    uint8_t l_enable_mask = ZERO_INIT;
+    if(E_OK == Interrupt_Manager_Get_Enable(source, &l_enable_register, &l_enable_mask))
+    {
+        if(STD_TRUE == _enable)
+            { *l_enable_register |= l_enable_mask; }
+        else
+            { *l_enable_register &= (uint8_t)~l_enable_mask; }
+    }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : Sets the flag of a source, TXIF is set by the transmitter itself
+ *          (enabled with an empty TXREG).
+ */
+static void dispatch_test_flag_set(interrupt_source_t source)
+{
+    if(INTERRUPT_SOURCE_EUSART_TX == source)
+    {
+        RCSTAbits.SPEN = STD_ENABLE;
+        TXSTAbits.TXEN = STD_ENABLE;
+    }
+    else
+    {
+        SFR_AT(dispatch_test_sources[source].flag_address) |=
+                (uint8_t)(1U << dispatch_test_sources[source].flag_bit);
+    }
+}
+
+/**
+ * @brief : Sets the flag of one source on the high vector.
+ * @return The cycles from the flag to the routine, 0 if it did not run.
+ */
+static unsigned long dispatch_test_latency(uint8_t _all, interrupt_source_t source)
+{
+    unsigned long long l_flag_time = 0;
+    unsigned long l_latency = 0;
+    dispatch_test_setup(_all, source, PRIORITY_HIGH);
+    dispatch_test_flag_set(source);
+    l_flag_time = sim_get_cycles();
+    sim_delay_cycles(INTERRUPT_DISPATCH_TEST_WAIT);
+    if(1U == dispatch_test_calls[source])
+    {
+        l_latency = (unsigned long)(dispatch_test_called_at[source] - l_flag_time);
+    }
+    else
+        { /* Nothing */ }
+    return l_latency;
+}
+
+/**
+ * @brief : Sets the 16 flags at once with all the sources at one priority.
+ * @return (STD_TRUE) if every routine ran once, in the rank order.
+ */
+static uint8_t dispatch_test_all_flags(interrupt_priority_t priority)
+{
+    uint8_t l_source = ZERO_INIT;
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_in_order = STD_TRUE;
+    dispatch_test_setup(STD_TRUE, INTERRUPT_SOURCE_INT0, priority);
+    /* The flags are set with the interrupts off, so they are seen at once */
+    INTERRUPT_GIEH_DISABLE();
+    for(l_source = ZERO_INIT; l_source < INTERRUPT_SOURCES_NUMBER; l_source++)
+    {
+        dispatch_test_flag_set((interrupt_source_t)l_source);
+    }
+    INTERRUPT_GIEH_ENABLE();
+    sim_delay_cycles(INTERRUPT_DISPATCH_TEST_WAIT);
+    for(l_index = ZERO_INIT; l_index < INTERRUPT_SOURCES_NUMBER; l_index++)
+    {
+        if(1U != dispatch_test_calls[l_index])
+            { l_in_order = STD_FALSE; }
+        else
+            { /* Nothing */ }
+    }
+    /* INT0 can't move to the low vector, it runs first on the high one */
+    for(l_index = 1U; (STD_TRUE == l_in_order) && (l_index < dispatch_test_order_size); l_index++)
+    {
+        if((PRIORITY_HIGH == priority) || (INTERRUPT_SOURCE_INT0 != dispatch_test_order[l_index - 1U]))
+        {
+            if(dispatch_test_sources[dispatch_test_order[l_index]].rank <
+               dispatch_test_sources[dispatch_test_order[l_index - 1U]].rank)
+                { l_in_order = STD_FALSE; }
+            else
+                { /* Nothing */ }
+        }
+        else
+            { /* Nothing */ }
+    }
+    return l_in_order;
+}
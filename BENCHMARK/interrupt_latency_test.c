@@ -0,0 +1,168 @@
+/*
+ * File:   interrupt_latency_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The high priority latency test (HOST_SIM) <--
+ *
+ * TIMER0 overflows every INTERRUPT_LATENCY_TEST_PERIOD cycles on the
+ * high vector and its routine reads how many ticks passed since the
+ * overflow. The run is done twice : TIMER0 alone, then with the TIMER1
+ * overflow on the low vector running a routine of
+ * INTERRUPT_LATENCY_TEST_LOW_CYCLES cycles. The worst latency must not
+ * change, must not pass INTERRUPT_LATENCY_TEST_MAX_TICKS and TIMER0 must
+ * preempt the long low routine.
+ *
+ *      gcc -std=gnu11 -DHOST_SIM -I. BENCHMARK/interrupt_latency_test.c \
+ *          MCAL/TIMER0/timer0.c MCAL/TIMER1/timer1.c MCAL/TIMER16/timer16.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The exit code is 0 when the test passes)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/TIMER0/timer0.h"
+#include "../MCAL/TIMER1/timer1.h"
+
+#ifndef HOST_SIM
+#error "The latency test runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The TIMER0 period (in instruction cycles) */
+#define INTERRUPT_LATENCY_TEST_PERIOD       1000U
+/* The length of the TIMER1 routine (in instruction cycles) */
+#define INTERRUPT_LATENCY_TEST_LOW_CYCLES   5000UL
+/* 
+ * The worst latency of this tree (in ticks, 1 tick per cycle), a change of
+ * the dispatch or of the TIMER0 routine moves it and fails the test :
+ *   3 (flag to vector) + 11 (the dispatch chain tests the 8 sources ranked
+ *   before TMR0, then TMR0IE/TMR0IF/TMR0IP) + 12 (INTI_TMR0_ISR clears the
+ *   flag and reloads, then timer0_read_value() up to its TMR0L read) + 1
+ *   (the TMR0L read)
+ */
+#define INTERRUPT_LATENCY_TEST_MAX_TICKS    27U
+/* The length of one run (in instruction cycles) */
+#define INTERRUPT_LATENCY_TEST_RUN_CYCLES   400000UL
+
+/* --------------- Section : Global Variables --------------- */
+static volatile uint16_t latency_max = ZERO_INIT;
+static volatile uint16_t high_hits = ZERO_INIT;
+static volatile uint16_t high_hits_in_low = ZERO_INIT;
+static volatile uint16_t low_hits = ZERO_INIT;
+static volatile uint8_t low_running = STD_FALSE;
+
+static void latency_test_high_handler(void);
+static void latency_test_low_handler(void);
+
+static const Timer0_t latency_timer0 = {
+    .TMR0_INTERRUPT_HANDLER = latency_test_high_handler,
+    .priority = PRIORITY_HIGH,
+    .timer0_preloaded_value = (uint16_t)(65536UL - INTERRUPT_LATENCY_TEST_PERIOD),
+    .timer0_mode = TMR0_TIMER_MODE,
+    .prescaler_enable = TMR0_PRESCALER_DISABLE,
+    .tmr0_register_size = TMR0_16_BIT_MODE
+};
+
+static const Timer1_t latency_timer1 = {
+    .TMR1_INTERRUPT_HANDLER = latency_test_low_handler,
+    .priority = PRIORITY_LOW,
+    .timer1_preloaded_value = ZERO_INIT,
+    .timer1_mode = TMR1_TIMER_MODE,
+    .timer1_rw_mode = TMR1_RW_REG_MODE_16BIT
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static uint16_t latency_test_run(uint8_t _with_low);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    uint16_t l_alone = ZERO_INIT;
+    uint16_t l_loaded = ZERO_INIT;
+    uint8_t l_passed = STD_FALSE;
+
+    l_alone = latency_test_run(STD_FALSE);
+    printf("TIMER0 alone       : %5u hits, worst latency %u ticks (max %u)\n", high_hits, l_alone,
+           INTERRUPT_LATENCY_TEST_MAX_TICKS);
+    l_loaded = latency_test_run(STD_TRUE);
+    printf("TIMER0 + low TIMER1: %5u hits, worst latency %u ticks (max %u)\n", high_hits, l_loaded,
+           INTERRUPT_LATENCY_TEST_MAX_TICKS);
+    printf("TIMER1 routines    : %5u, TIMER0 hits inside them %u\n", low_hits, high_hits_in_low);
+
+    l_passed = (uint8_t)((l_loaded == l_alone) && (l_alone <= INTERRUPT_LATENCY_TEST_MAX_TICKS) &&
+                         (low_hits > ZERO_INIT) && (high_hits_in_low > ZERO_INIT));
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Runs TIMER0 (and TIMER1 when _with_low is STD_TRUE)
+ *          for INTERRUPT_LATENCY_TEST_RUN_CYCLES.
+ * @return The worst TIMER0 latency (in ticks).
+ */
+static uint16_t latency_test_run(uint8_t _with_low)
+{
+    sim_reset();
+    latency_max = ZERO_INIT;
+    high_hits = ZERO_INIT;
+    high_hits_in_low = ZERO_INIT;
+    low_hits = ZERO_INIT;
+    (void)timer0_init(&latency_timer0);
+    if(STD_TRUE == _with_low)
+    {
+        (void)timer1_init(&latency_timer1);
+    }
+    else
+        { /* Nothing */ }
+    sim_delay_cycles(INTERRUPT_LATENCY_TEST_RUN_CYCLES);
+    (void)timer0_deInit(&latency_timer0);
+    if(STD_TRUE == _with_low)
+    {
+        (void)timer1_deInit(&latency_timer1);
+    }
+    else
+        { /* Nothing */ }
+    return latency_max;
+}
+
+/**
+ * @brief : The TIMER0 routine (high vector), the reload added the ticks
+ *          counted since the overflow to the preloaded value.
+ */
+static void latency_test_high_handler(void)
+{
+    uint16_t l_count = ZERO_INIT;
+    (void)timer0_read_value(&latency_timer0, &l_count);
+    l_count = (uint16_t)(l_count - latency_timer0.timer0_preloaded_value);
+    if(l_count > latency_max)
+    {
+        latency_max = l_count;
+    }
+    else
+        { /* Nothing */ }
+    high_hits++;
+    if(STD_TRUE == low_running)
+    {
+        high_hits_in_low++;
+    }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : The TIMER1 routine (low vector), a long housekeeping job.
+ */
+static void latency_test_low_handler(void)
+{
+    low_running = STD_TRUE;
+    low_hits++;
+    sim_delay_cycles(INTERRUPT_LATENCY_TEST_LOW_CYCLES);
+    low_running = STD_FALSE;
+}
@@ -0,0 +1,169 @@
+/*
+ * File:   monotonic_clock_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The monotonic clock wrap check (HOST_SIM) <--
+ *
+ * Reads the monotonic clock (TIMER1, 1:1, low priority) from a compare
+ * scheduler callback (CCP1, high priority) queued 0, 1, 2 ... ticks past
+ * the next TIMER1 wrap, MONOTONIC_CLOCK_TEST_WRAPS times : the CCP1
+ * routine preempts the overflow routine at every step of it. Every reading
+ * must come after its timestamp and within MONOTONIC_CLOCK_TEST_LATENCY
+ * ticks (not a wrap back nor a wrap late), monotonic_clock_extend() must
+ * give the timestamp back from its 16 bits, and the microseconds read
+ * from the main loop must follow the ticks across the wraps.
+ * Built with the call cost model of the simulator, the calls of the
+ * overflow routine give the preemption its room :
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. -finstrument-functions \
+ *          -finstrument-functions-exclude-file-list=HOST_SIM,BENCHMARK \
+ *          BENCHMARK/monotonic_clock_test.c \
+ *          MCAL/CCP/compare_scheduler.c MCAL/CCP/ccp.c \
+ *          MCAL/TIMER1/monotonic_clock.c MCAL/TIMER1/timer1.c MCAL/TIMER16/timer16.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The exit code is 0 when the test passes)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/CCP/compare_scheduler.h"
+
+#ifndef HOST_SIM
+#error "The monotonic clock check runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The wrap readings, one a wrap from 0 ticks past it */
+#define MONOTONIC_CLOCK_TEST_WRAPS          48U
+#define MONOTONIC_CLOCK_TEST_WRAP_TICKS     0x10000UL
+/* The most ticks from a timestamp to its reading (the calls are charged) */
+#define MONOTONIC_CLOCK_TEST_LATENCY        1000L
+
+/* --------------- Section : Global Variables --------------- */
+static uint8_t clock_test_wraps = ZERO_INIT;
+static uint32_t clock_test_timestamp = ZERO_INIT;
+/* The readings minus their timestamps */
+static long clock_test_past_min = 0x7FFFFFFFL;
+static long clock_test_past_max = -0x7FFFFFFFL;
+static uint8_t clock_test_extend_errors = ZERO_INIT;
+
+static const Timer1_t clock_test_timer = {
+    .TMR1_INTERRUPT_HANDLER = NULL,
+    .priority = PRIORITY_LOW,
+    .prescaler_value = TMR1_PRESCALAR_RATIO_1,
+    .timer1_mode = TMR1_TIMER_MODE,
+    .timer1_counter_synch_mode = TMR1_COUNTER_SYNCH,
+    .timer1_OSC_cfg = TMR1_OSC_DISABLE,
+    .timer1_rw_mode = TMR1_RW_REG_MODE_16BIT
+};
+
+static const ccp_t clock_test_ccp = {
+    .ccp_module_select = CCP1_MODULE,
+    .ccp_interrupt_priority = PRIORITY_HIGH,
+    .ccp_compare_timer = CCP1_CCP2_TMR1
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static Std_ReturnType clock_test_add_reading(void);
+static void clock_test_reading(void);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_wrap = ZERO_INIT;
+    uint32_t l_ticks_origin = ZERO_INIT, l_us_origin = ZERO_INIT;
+    uint32_t l_us = ZERO_INIT, l_us_before = ZERO_INIT, l_us_after = ZERO_INIT;
+    uint8_t l_us_errors = ZERO_INIT;
+    uint8_t l_passed = STD_TRUE;
+
+    ret = monotonic_clock_init(&clock_test_timer);
+    ret |= compare_scheduler_init(&clock_test_ccp);
+    if(ZERO_INIT == sim_get_calls())
+    {
+        printf("Built without -finstrument-functions, the calls are free\n");
+    }
+    else
+        { /* Nothing */ }
+
+    /* 1. The readings from the high priority routine */
+    clock_test_timestamp = monotonic_clock_get_ticks();
+    ret |= clock_test_add_reading();
+    /* 2. The microseconds between two tick readings, once a wrap meanwhile */
+    l_ticks_origin = monotonic_clock_get_ticks();
+    l_us_origin = monotonic_clock_get_us();
+    for(l_wrap = ZERO_INIT; l_wrap <= MONOTONIC_CLOCK_TEST_WRAPS; l_wrap++)
+    {
+        sim_delay_cycles(MONOTONIC_CLOCK_TEST_WRAP_TICKS);
+        l_us_before = monotonic_clock_ticks_to_us(monotonic_clock_get_ticks() - l_ticks_origin);
+        l_us = monotonic_clock_get_us() - l_us_origin;
+        l_us_after = monotonic_clock_ticks_to_us(monotonic_clock_get_ticks() - l_ticks_origin);
+        /* One microsecond for the rounding of the origin */
+        if(((l_us + 1UL) < l_us_before) || (l_us > (l_us_after + 1UL)))
+        {
+            l_us_errors++;
+        }
+        else
+            { /* Nothing */ }
+    }
+
+    printf("wrap readings : %u of %u, %ld..%ld ticks past the timestamp\n", clock_test_wraps,
+           MONOTONIC_CLOCK_TEST_WRAPS, clock_test_past_min, clock_test_past_max);
+    printf("extended stamps : %u wrong\n", clock_test_extend_errors);
+    printf("microseconds : %u of %u readings off the ticks\n", l_us_errors, MONOTONIC_CLOCK_TEST_WRAPS + 1U);
+    l_passed = (uint8_t)((E_OK == ret) && (MONOTONIC_CLOCK_TEST_WRAPS == clock_test_wraps)
+                         && (clock_test_past_min >= 0L)
+                         && (clock_test_past_max <= MONOTONIC_CLOCK_TEST_LATENCY)
+                         && (ZERO_INIT == clock_test_extend_errors)
+                         && (ZERO_INIT == l_us_errors));
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Queues the next reading, (clock_test_wraps) ticks past the
+ *          next TIMER1 wrap.
+ */
+static Std_ReturnType clock_test_add_reading(void)
+{
+    compare_event_t l_event = {ZERO_INIT};
+    clock_test_timestamp = (clock_test_timestamp & 0xFFFF0000UL)
+                         + MONOTONIC_CLOCK_TEST_WRAP_TICKS + clock_test_wraps;
+    l_event.timestamp = clock_test_timestamp;
+    l_event.action = COMPARE_EVENT_CALLBACK;
+    l_event.callback = clock_test_reading;
+    return compare_scheduler_add(&l_event);
+}
+
+/**
+ * @brief : The callback of the readings (in the ISR), reads the clock
+ *          against the timestamp and queues the next reading.
+ */
+static void clock_test_reading(void)
+{
+    long l_past = (long)(int32_t)(monotonic_clock_get_ticks() - clock_test_timestamp);
+    if(l_past < clock_test_past_min) { clock_test_past_min = l_past; }
+    else { /* Nothing */ }
+    if(l_past > clock_test_past_max) { clock_test_past_max = l_past; }
+    else { /* Nothing */ }
+    if(monotonic_clock_extend((uint16_t)clock_test_timestamp) != clock_test_timestamp)
+    {
+        clock_test_extend_errors++;
+    }
+    else
+        { /* Nothing */ }
+    clock_test_wraps++;
+    if(clock_test_wraps < MONOTONIC_CLOCK_TEST_WRAPS)
+    {
+        (void)clock_test_add_reading();
+    }
+    else
+        { /* Nothing */ }
+}
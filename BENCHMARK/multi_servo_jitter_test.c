@@ -0,0 +1,301 @@
+/*
+ * File:   multi_servo_jitter_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The multi-servo pulse jitter test (HOST_SIM) <--
+ *
+ * Drives MULTI_SERVO_JITTER_TEST_SERVOS servos on PORTD from CCP1
+ * compare on a free running TIMER3 (1:1) and samples LATD after every
+ * instruction cycle (the tick hook of the simulator, inside the ISR too),
+ * then prints the frame period, the skew of the rising edges and the
+ * width of every pulse :
+ *
+ *  1. The pulses don't change : every width is its pulse, every frame
+ *     is MULTI_SERVO_FRAME_TICKS, all the pins rise together.
+ *  2. D3 and D5 end 10 and 19 us after D0 : the three ends share one
+ *     interrupt, every width is still its pulse.
+ *  3. The main loop re-aims D0 and D4 at random points of the frames :
+ *     the frame period must not move, the other widths stay their pulses
+ *     (an end merged with a moved one too).
+ * A servo with a pulse shorter than MULTI_SERVO_MIN_GAP_US is rejected.
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. BENCHMARK/multi_servo_jitter_test.c \
+ *          ECUAL/Servo_Motor/multi_servo.c MCAL/CCP/ccp.c \
+ *          MCAL/TIMER3/timer3.c MCAL/TIMER16/timer16.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The exit code is 0 when the test passes)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../ECUAL/Servo_Motor/multi_servo.h"
+#include "../MCAL/TIMER3/timer3.h"
+
+#ifndef HOST_SIM
+#error "The multi-servo jitter test runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The servos on RD0 --> RD5 */
+#define MULTI_SERVO_JITTER_TEST_SERVOS      6U
+/* The frames of every run */
+#define MULTI_SERVO_JITTER_TEST_FRAMES      50U
+/* The re-aimed servos of the second run */
+#define MULTI_SERVO_JITTER_TEST_MOVED_A     0U
+#define MULTI_SERVO_JITTER_TEST_MOVED_B     4U
+/* The merged ends of the second run : D3 and D5 right after D0 */
+#define MULTI_SERVO_JITTER_TEST_MERGED_D3   1510U
+#define MULTI_SERVO_JITTER_TEST_MERGED_D5   1519U
+/* The compare timer ticks in instruction cycles */
+#define MULTI_SERVO_JITTER_TEST_FRAME_CYCLES (MULTI_SERVO_FRAME_TICKS * MULTI_SERVO_TIMER_PRESCALER)
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef struct {
+    unsigned long long last_rise;   /* The cycle of the last rising edge (0 : none yet) */
+    uint32_t width_min;
+    uint32_t width_max;
+    uint32_t pulses;
+} servo_jitter_pin_t;
+
+/* --------------- Section : Global Variables --------------- */
+static uint16_t servo_jitter_pulses_us[MULTI_SERVO_JITTER_TEST_SERVOS] = {
+    1500U, 1000U, 2000U, 1600U, 1250U, 1750U
+};
+static multi_servo_t servo_jitter_servos[MULTI_SERVO_JITTER_TEST_SERVOS];
+static servo_jitter_pin_t servo_jitter_pins[MULTI_SERVO_JITTER_TEST_SERVOS];
+static uint32_t servo_jitter_frame_min = ZERO_INIT;
+static uint32_t servo_jitter_frame_max = ZERO_INIT;
+static uint32_t servo_jitter_skew_max = ZERO_INIT;
+static uint8_t servo_jitter_previous = ZERO_INIT;
+
+static const Timer3_t servo_jitter_timer3 = {
+    .TMR3_INTERRUPT_HANDLER = NULL,
+    .priority = PRIORITY_LOW,
+    .timer3_preloaded_value = ZERO_INIT,
+    .prescaler_value = TMR3_PRESCALAR_RATIO_1,
+    .timer3_mode = TMR3_TIMER_MODE,
+    .timer3_counter_synch_mode = TMR3_COUNTER_SYNCH,
+    .timer3_rw_mode = TMR3_RW_REG_MODE_16BIT
+};
+
+static const ccp_t servo_jitter_ccp = {
+    .ccp_module_select = CCP1_MODULE,
+    .ccp_interrupt_priority = PRIORITY_HIGH,
+    .ccp_compare_timer = CCP1_CCP2_TMR3
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void servo_jitter_clear(void);
+static void servo_jitter_tick(void);
+static Std_ReturnType servo_jitter_set_us(uint8_t _servo, uint16_t _pulse_us);
+static uint8_t servo_jitter_report(const char *_title, uint8_t _moved);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_servo = ZERO_INIT;
+    uint16_t l_frame = ZERO_INIT;
+    uint8_t l_passed = STD_TRUE;
+    multi_servo_t l_short = {
+        .pin = {.port = PORTD_INDEX, .pin = PIN7_INDEX, .direction = GPIO_DIRECTION_OUTPUT},
+        .min_pulse_us = MULTI_SERVO_MIN_GAP_US - 1U, .max_pulse_us = 2000U
+    };
+
+    sim_set_tick_hook(servo_jitter_tick);
+    ret = timer3_init(&servo_jitter_timer3);
+    ret |= multi_servo_init(&servo_jitter_ccp);
+    for(l_servo = ZERO_INIT; l_servo < MULTI_SERVO_JITTER_TEST_SERVOS; l_servo++)
+    {
+        servo_jitter_servos[l_servo].pin.port = PORTD_INDEX;
+        servo_jitter_servos[l_servo].pin.pin = l_servo;
+        servo_jitter_servos[l_servo].pin.direction = GPIO_DIRECTION_OUTPUT;
+        servo_jitter_servos[l_servo].min_pulse_us = 1000U;
+        servo_jitter_servos[l_servo].max_pulse_us = 2000U;
+        ret |= multi_servo_add(&servo_jitter_servos[l_servo]);
+        ret |= multi_servo_set_us(&servo_jitter_servos[l_servo], servo_jitter_pulses_us[l_servo]);
+    }
+    if(E_NOT_OK != multi_servo_add(&l_short))
+    {
+        printf("multi_servo_add() took a %u us pulse\n", l_short.min_pulse_us);
+        ret = E_NOT_OK;
+    }
+    else
+        { /* Nothing */ }
+    if(E_OK != ret)
+    {
+        printf("multi_servo setup failed\n");
+        return 1;
+    }
+    else
+        { /* Nothing */ }
+
+    /* The first frame takes the pulses */
+    sim_delay_cycles(2UL * MULTI_SERVO_JITTER_TEST_FRAME_CYCLES);
+    servo_jitter_clear();
+
+    /* 1. Static pulses */
+    sim_delay_cycles(MULTI_SERVO_JITTER_TEST_FRAMES * MULTI_SERVO_JITTER_TEST_FRAME_CYCLES);
+    l_passed &= servo_jitter_report("static pulses", STD_FALSE);
+
+    /* 2. Three ends merged (the widths of the frame of the change are mixed) */
+    ret |= servo_jitter_set_us(3U, MULTI_SERVO_JITTER_TEST_MERGED_D3);
+    ret |= servo_jitter_set_us(5U, MULTI_SERVO_JITTER_TEST_MERGED_D5);
+    sim_delay_cycles(2UL * MULTI_SERVO_JITTER_TEST_FRAME_CYCLES);
+    servo_jitter_clear();
+    sim_delay_cycles(MULTI_SERVO_JITTER_TEST_FRAMES * MULTI_SERVO_JITTER_TEST_FRAME_CYCLES);
+    l_passed &= servo_jitter_report("merged ends", STD_FALSE);
+
+    /* 3. Two servos re-aimed at random points of the frames */
+    srand(1U);
+    for(l_frame = ZERO_INIT; l_frame < MULTI_SERVO_JITTER_TEST_FRAMES; l_frame++)
+    {
+        ret |= multi_servo_set_angle(&servo_jitter_servos[MULTI_SERVO_JITTER_TEST_MOVED_A], (uint8_t)(rand() % 181));
+        ret |= multi_servo_set_angle(&servo_jitter_servos[MULTI_SERVO_JITTER_TEST_MOVED_B], (uint8_t)(rand() % 181));
+        sim_delay_cycles((uint32_t)(MULTI_SERVO_JITTER_TEST_FRAME_CYCLES / 2UL)
+                         + ((uint32_t)rand() % MULTI_SERVO_JITTER_TEST_FRAME_CYCLES));
+    }
+    l_passed &= servo_jitter_report("D0/D4 re-aimed", STD_TRUE);
+
+    sim_set_tick_hook(NULL);
+    l_passed &= (uint8_t)(E_OK == ret);
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Clears the statistics, the last edges are kept.
+ */
+static void servo_jitter_clear(void)
+{
+    uint8_t l_servo = ZERO_INIT;
+    for(l_servo = ZERO_INIT; l_servo < MULTI_SERVO_JITTER_TEST_SERVOS; l_servo++)
+    {
+        servo_jitter_pins[l_servo].width_min = 0xFFFFFFFFUL;
+        servo_jitter_pins[l_servo].width_max = ZERO_INIT;
+        servo_jitter_pins[l_servo].pulses = ZERO_INIT;
+    }
+    servo_jitter_frame_min = 0xFFFFFFFFUL;
+    servo_jitter_frame_max = ZERO_INIT;
+    servo_jitter_skew_max = ZERO_INIT;
+}
+
+/**
+ * @brief : Sets the pulse of a servo and keeps it as its expected width.
+ */
+static Std_ReturnType servo_jitter_set_us(uint8_t _servo, uint16_t _pulse_us)
+{
+    servo_jitter_pulses_us[_servo] = _pulse_us;
+    return multi_servo_set_us(&servo_jitter_servos[_servo], _pulse_us);
+}
+
+/**
+ * @brief : The tick hook, samples LATD after every instruction cycle
+ *          (LATD is read directly, the sampling takes no cycle).
+ */
+static void servo_jitter_tick(void)
+{
+    uint8_t l_servo = ZERO_INIT;
+    uint8_t l_latd = LATD;
+    uint8_t l_mask = ZERO_INIT;
+    unsigned long long l_now = sim_get_cycles();
+    uint32_t l_length = ZERO_INIT;
+    servo_jitter_pin_t *l_pin = NULL;
+
+    if(l_latd != servo_jitter_previous)
+    {
+        for(l_servo = ZERO_INIT; l_servo < MULTI_SERVO_JITTER_TEST_SERVOS; l_servo++)
+        {
+            l_mask = (uint8_t)(1U << l_servo);
+            l_pin = &servo_jitter_pins[l_servo];
+            if((l_latd & l_mask) && !(servo_jitter_previous & l_mask))
+            {
+                /* The frame period on the first servo, the skew against it */
+                if((ZERO_INIT == l_servo) && (ZERO_INIT != l_pin->last_rise))
+                {
+                    l_length = (uint32_t)(l_now - l_pin->last_rise);
+                    if(l_length < servo_jitter_frame_min) { servo_jitter_frame_min = l_length; }
+                    else { /* Nothing */ }
+                    if(l_length > servo_jitter_frame_max) { servo_jitter_frame_max = l_length; }
+                    else { /* Nothing */ }
+                }
+                else if(ZERO_INIT != l_servo)
+                {
+                    l_length = (uint32_t)(l_now - servo_jitter_pins[0].last_rise);
+                    if(l_length > servo_jitter_skew_max) { servo_jitter_skew_max = l_length; }
+                    else { /* Nothing */ }
+                }
+                else
+                    { /* Nothing */ }
+                l_pin->last_rise = l_now;
+            }
+            else if(!(l_latd & l_mask) && (servo_jitter_previous & l_mask))
+            {
+                l_length = (uint32_t)(l_now - l_pin->last_rise);
+                if(l_length < l_pin->width_min) { l_pin->width_min = l_length; }
+                else { /* Nothing */ }
+                if(l_length > l_pin->width_max) { l_pin->width_max = l_length; }
+                else { /* Nothing */ }
+                l_pin->pulses++;
+            }
+            else
+                { /* Nothing */ }
+        }
+        servo_jitter_previous = l_latd;
+    }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : Prints the run and checks it, the widths of the re-aimed
+ *          servos are only checked against their pulse range and the
+ *          other ones may end with a re-aimed one.
+ * @return STD_TRUE when the run passes.
+ */
+static uint8_t servo_jitter_report(const char *_title, uint8_t _moved)
+{
+    uint8_t l_servo = ZERO_INIT;
+    uint8_t l_passed = STD_TRUE;
+    uint32_t l_expected_min = ZERO_INIT;
+    uint32_t l_expected_max = ZERO_INIT;
+    const servo_jitter_pin_t *l_pin = NULL;
+
+    printf("%s : frame %lu..%lu cycles (expected %lu), rise skew %lu cycles\n", _title,
+           (unsigned long)servo_jitter_frame_min, (unsigned long)servo_jitter_frame_max,
+           (unsigned long)MULTI_SERVO_JITTER_TEST_FRAME_CYCLES, (unsigned long)servo_jitter_skew_max);
+    l_passed &= (uint8_t)((MULTI_SERVO_JITTER_TEST_FRAME_CYCLES == servo_jitter_frame_min)
+                          && (MULTI_SERVO_JITTER_TEST_FRAME_CYCLES == servo_jitter_frame_max)
+                          && (ZERO_INIT == servo_jitter_skew_max));
+
+    for(l_servo = ZERO_INIT; l_servo < MULTI_SERVO_JITTER_TEST_SERVOS; l_servo++)
+    {
+        l_pin = &servo_jitter_pins[l_servo];
+        if((STD_TRUE == _moved)
+           && ((MULTI_SERVO_JITTER_TEST_MOVED_A == l_servo) || (MULTI_SERVO_JITTER_TEST_MOVED_B == l_servo)))
+        {
+            l_expected_min = (uint32_t)MULTI_SERVO_US_TO_TICKS(servo_jitter_servos[l_servo].min_pulse_us) * MULTI_SERVO_TIMER_PRESCALER;
+            l_expected_max = (uint32_t)MULTI_SERVO_US_TO_TICKS(servo_jitter_servos[l_servo].max_pulse_us) * MULTI_SERVO_TIMER_PRESCALER;
+        }
+        else
+        {
+            l_expected_min = (uint32_t)MULTI_SERVO_US_TO_TICKS(servo_jitter_pulses_us[l_servo]) * MULTI_SERVO_TIMER_PRESCALER;
+            l_expected_max = l_expected_min;
+        }
+        printf("  D%u : %3lu pulses, width %lu..%lu cycles (expected %lu..%lu)\n", l_servo,
+               (unsigned long)l_pin->pulses, (unsigned long)l_pin->width_min, (unsigned long)l_pin->width_max,
+               (unsigned long)l_expected_min, (unsigned long)l_expected_max);
+        l_passed &= (uint8_t)((l_pin->pulses > ZERO_INIT) && (l_pin->width_min >= l_expected_min)
+                              && (l_pin->width_max <= l_expected_max));
+    }
+    servo_jitter_clear();
+    return l_passed;
+}
@@ -0,0 +1,290 @@
+/*
+ * File:   pwm_sync_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The buffered PWM updates test (HOST_SIM) <--
+ *
+ * CCP1 and CCP2 run complementary duty cycles at PWM_SYNC_TEST_FREQUENCY,
+ * their sum is always one period. The latched duty cycles (CCPR1H and
+ * CCPR2H) are sampled every instruction cycle and a period whose pair
+ * doesn't sum up to the period is counted as mismatched :
+ *
+ *  1. Direct writes, one module after the other : the period start can
+ *     latch a half update (printed, not checked).
+ *  2. Staged writes (CCP_PWM_Sync_SetDutyRaw()) at random points : no
+ *     mismatched period.
+ *  3. Two stages before every period : only the last one is applied.
+ *  4. A stage at every TMR2 count of the period, the TIMER2 interrupt
+ *     pending from the idle periods comes right away : the writes close
+ *     to the PR2 match wait for the next one, no mismatched period.
+ *  5. No stage : the TIMER2 interrupt stays off.
+ *
+ * It needs the two modules in pwm mode and CCP_PWM_SYNC_FEATURE :
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. \
+ *          -DCCP1_CFG_SELECTED_MODE=CCP_CFG_PWM_MODE_SELECTED -DCCP_PWM_SYNC_FEATURE=CONFIG_ENABLE \
+ *          BENCHMARK/pwm_sync_test.c MCAL/CCP/ccp.c MCAL/TIMER2/timer2.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The exit code is 0 when the test passes, the default configuration
+ *  only prints the build line above)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include "../MCAL/CCP/ccp.h"
+#include "../MCAL/TIMER2/timer2.h"
+#include "../MCAL/TIMER_SOLVER/timer_solver.h"
+
+#ifndef HOST_SIM
+#error "The buffered PWM updates test runs on the HOST_SIM backend only"
+#endif
+
+#ifdef CCP_PWM_SYNC_SELECTED
+/* --------------- Section: Macro Declarations --------------- */
+#define PWM_SYNC_TEST_FREQUENCY         20000UL
+/* The updates of the runs 1. and 2. */
+#define PWM_SYNC_TEST_UPDATES           2000U
+/* The double stages of the run 3. */
+#define PWM_SYNC_TEST_BURSTS            50U
+/* The most cycles between two updates */
+#define PWM_SYNC_TEST_MAX_GAP           250U
+/* The latched duty cycles (in instruction cycles, 1:1 prescaler) */
+#define PWM_SYNC_TEST_CCPR1H            SIM_SFR_DIRECT(0xFBF)
+#define PWM_SYNC_TEST_CCPR2H            SIM_SFR_DIRECT(0xFBC)
+#define PWM_SYNC_TEST_TMR2              SIM_SFR_DIRECT(0xFCC)
+/* The idle periods of the run 5. */
+#define PWM_SYNC_TEST_IDLE_PERIODS      100U
+
+/* --------------- Section : Global Variables --------------- */
+static uint8_t pwm_sync_test_last_ccp1 = ZERO_INIT;
+static uint8_t pwm_sync_test_last_ccp2 = ZERO_INIT;
+static uint16_t pwm_sync_test_period = ZERO_INIT;
+static uint32_t pwm_sync_test_latched = ZERO_INIT;
+static uint32_t pwm_sync_test_mismatched = ZERO_INIT;
+static uint32_t pwm_sync_test_random = 12345UL;
+static uint32_t pwm_sync_test_handler_runs = ZERO_INIT;
+
+/* The TIMER2 handler of the timer object below */
+static void pwm_sync_test_handler(void);
+
+static const Timer2_t pwm_sync_test_timer2 = {
+    .TMR2_INTERRUPT_HANDLER = pwm_sync_test_handler,
+    .priority = PRIORITY_HIGH,
+    .timer2_preloaded_value = ZERO_INIT,
+    .postscaler_value = TMR2_POSTSCALAR_RATIO_1,
+    .prescaler_value = TMR2_PWM_SOLVER_PRESCALER(PWM_SYNC_TEST_FREQUENCY)
+};
+
+static const ccp_t pwm_sync_test_ccp1 = {
+    .ccp_module_select = CCP1_MODULE,
+    .ccp_mode = CCP_MODE_PWM,
+    .ccp_pwm_pr2 = TMR2_PWM_SOLVER_PR2(PWM_SYNC_TEST_FREQUENCY),
+    .pin = {.port = PORTC_INDEX, .pin = PIN2_INDEX, .direction = GPIO_DIRECTION_OUTPUT}
+};
+
+static const ccp_t pwm_sync_test_ccp2 = {
+    .ccp_module_select = CCP2_MODULE,
+    .ccp_mode = CCP_MODE_PWM,
+    .ccp_pwm_pr2 = TMR2_PWM_SOLVER_PR2(PWM_SYNC_TEST_FREQUENCY),
+    .pin = {.port = PORTC_INDEX, .pin = PIN1_INDEX, .direction = GPIO_DIRECTION_OUTPUT}
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void pwm_sync_test_observe(void);
+static void pwm_sync_test_wait(uint32_t _cycles);
+static void pwm_sync_test_clear(void);
+static uint16_t pwm_sync_test_rand(void);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint16_t l_full = ZERO_INIT;
+    uint16_t l_update = ZERO_INIT;
+    uint16_t l_duty = ZERO_INIT;
+    uint8_t l_count = ZERO_INIT;
+    uint32_t l_applied_start = ZERO_INIT;
+    uint32_t l_applied_end = ZERO_INIT;
+    uint8_t l_passed = STD_TRUE;
+
+    ret = timer2_init(&pwm_sync_test_timer2);
+    ret |= CCP_Init(&pwm_sync_test_ccp1);
+    ret |= CCP_Init(&pwm_sync_test_ccp2);
+    ret |= CCP_PWM_GetDutyRawMax(&pwm_sync_test_ccp1, &l_full);
+    pwm_sync_test_period = (uint16_t)(l_full >> 2);
+    printf("PR2 %u, period %u cycles\n", (unsigned)TMR2_PWM_SOLVER_PR2(PWM_SYNC_TEST_FREQUENCY), pwm_sync_test_period);
+    ret |= CCP_PWM_Sync_SetDutyRaw((uint16_t)(l_full >> 1), (uint16_t)(l_full >> 1));
+    pwm_sync_test_wait(3UL * pwm_sync_test_period);
+
+    /* 1. Direct writes */
+    pwm_sync_test_clear();
+    for(l_update = ZERO_INIT; l_update < PWM_SYNC_TEST_UPDATES; l_update++)
+    {
+        l_duty = (uint16_t)((1U + (pwm_sync_test_rand() % (pwm_sync_test_period - 1U))) << 2);
+        ret |= CCP_PWM_SetDutyRaw(&pwm_sync_test_ccp1, l_duty);
+        pwm_sync_test_observe();
+        ret |= CCP_PWM_SetDutyRaw(&pwm_sync_test_ccp2, (uint16_t)(l_full - l_duty));
+        pwm_sync_test_observe();
+        pwm_sync_test_wait(pwm_sync_test_rand() % PWM_SYNC_TEST_MAX_GAP);
+    }
+    printf("direct : %u updates, %lu latched pairs, %lu mismatched periods\n", PWM_SYNC_TEST_UPDATES,
+           (unsigned long)pwm_sync_test_latched, (unsigned long)pwm_sync_test_mismatched);
+
+    /* 2. Staged writes */
+    pwm_sync_test_clear();
+    ret |= CCP_PWM_Sync_GetApplied(&l_applied_start);
+    for(l_update = ZERO_INIT; l_update < PWM_SYNC_TEST_UPDATES; l_update++)
+    {
+        l_duty = (uint16_t)((1U + (pwm_sync_test_rand() % (pwm_sync_test_period - 1U))) << 2);
+        ret |= CCP_PWM_Sync_SetDutyRaw(l_duty, (uint16_t)(l_full - l_duty));
+        pwm_sync_test_observe();
+        pwm_sync_test_wait(pwm_sync_test_rand() % PWM_SYNC_TEST_MAX_GAP);
+    }
+    pwm_sync_test_wait(3UL * pwm_sync_test_period);
+    ret |= CCP_PWM_Sync_GetApplied(&l_applied_end);
+    printf("staged : %u updates, %lu applied, %lu latched pairs, %lu mismatched periods\n", PWM_SYNC_TEST_UPDATES,
+           (unsigned long)(l_applied_end - l_applied_start), (unsigned long)pwm_sync_test_latched,
+           (unsigned long)pwm_sync_test_mismatched);
+    l_passed &= (uint8_t)((ZERO_INIT == pwm_sync_test_mismatched) && (pwm_sync_test_latched > ZERO_INIT));
+
+    /* 3. Two stages a period, the last one is applied */
+    pwm_sync_test_clear();
+    ret |= CCP_PWM_Sync_GetApplied(&l_applied_start);
+    for(l_update = ZERO_INIT; l_update < PWM_SYNC_TEST_BURSTS; l_update++)
+    {
+        ret |= CCP_PWM_Sync_SetDutyRaw(40U, (uint16_t)(l_full - 40U));
+        ret |= CCP_PWM_Sync_SetDutyRaw(80U, (uint16_t)(l_full - 80U));
+        pwm_sync_test_wait(10UL * pwm_sync_test_period);
+    }
+    ret |= CCP_PWM_Sync_GetApplied(&l_applied_end);
+    printf("burst  : %u stages, %lu applied, CCPR1H %u CCPR2H %u, %lu mismatched periods\n", 2U * PWM_SYNC_TEST_BURSTS,
+           (unsigned long)(l_applied_end - l_applied_start), PWM_SYNC_TEST_CCPR1H, PWM_SYNC_TEST_CCPR2H,
+           (unsigned long)pwm_sync_test_mismatched);
+    l_passed &= (uint8_t)((ZERO_INIT == pwm_sync_test_mismatched)
+                          && ((l_applied_end - l_applied_start) < (2UL * PWM_SYNC_TEST_BURSTS))
+                          && ((80U >> 2) == PWM_SYNC_TEST_CCPR1H)
+                          && (((l_full - 80U) >> 2) == PWM_SYNC_TEST_CCPR2H));
+
+    /* 4. A stage at every TMR2 count */
+    pwm_sync_test_clear();
+    ret |= CCP_PWM_Sync_GetApplied(&l_applied_start);
+    for(l_count = ZERO_INIT; l_count < pwm_sync_test_period; l_count++)
+    {
+        while(l_count != PWM_SYNC_TEST_TMR2)
+        {
+            pwm_sync_test_wait(1UL);
+        }
+        l_duty = (uint16_t)((1U + (pwm_sync_test_rand() % (pwm_sync_test_period - 1U))) << 2);
+        ret |= CCP_PWM_Sync_SetDutyRaw(l_duty, (uint16_t)(l_full - l_duty));
+        pwm_sync_test_observe();
+        pwm_sync_test_wait(3UL * pwm_sync_test_period);
+    }
+    ret |= CCP_PWM_Sync_GetApplied(&l_applied_end);
+    printf("late   : %u stages, %lu applied, %lu handler runs, %lu mismatched periods\n", pwm_sync_test_period,
+           (unsigned long)(l_applied_end - l_applied_start), (unsigned long)pwm_sync_test_handler_runs,
+           (unsigned long)pwm_sync_test_mismatched);
+    l_passed &= (uint8_t)((ZERO_INIT == pwm_sync_test_mismatched)
+                          && ((l_applied_end - l_applied_start) == pwm_sync_test_period)
+                          && (pwm_sync_test_handler_runs > pwm_sync_test_period));
+
+    /* 5. No stage */
+    pwm_sync_test_clear();
+    pwm_sync_test_wait((uint32_t)PWM_SYNC_TEST_IDLE_PERIODS * pwm_sync_test_period);
+    printf("idle   : %u periods, %lu handler runs\n", PWM_SYNC_TEST_IDLE_PERIODS,
+           (unsigned long)pwm_sync_test_handler_runs);
+    l_passed &= (uint8_t)(ZERO_INIT == pwm_sync_test_handler_runs);
+
+    /* The bad arguments */
+    l_passed &= (uint8_t)((E_NOT_OK == CCP_PWM_Sync_SetDutyRaw((uint16_t)(l_full + 1U), ZERO_INIT))
+                          && (E_NOT_OK == CCP_PWM_Sync_SetDutyPermille(ZERO_INIT, (uint16_t)(CCP_PWM_DUTY_PERMILLE_MAX + 1U)))
+                          && (E_NOT_OK == CCP_PWM_Sync_GetApplied(NULL)));
+
+    l_passed &= (uint8_t)(E_OK == ret);
+    printf("%s\n", (STD_TRUE == l_passed) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_passed) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : The TIMER2 handler, counts the runs of CCP_PWM_Sync_Handler().
+ */
+static void pwm_sync_test_handler(void)
+{
+    pwm_sync_test_handler_runs++;
+    CCP_PWM_Sync_Handler();
+}
+
+/**
+ * @brief : Counts a new latched pair, and a mismatched one when it
+ *          doesn't sum up to the period.
+ */
+static void pwm_sync_test_observe(void)
+{
+    uint8_t l_ccp1 = PWM_SYNC_TEST_CCPR1H;
+    uint8_t l_ccp2 = PWM_SYNC_TEST_CCPR2H;
+    if((l_ccp1 != pwm_sync_test_last_ccp1) || (l_ccp2 != pwm_sync_test_last_ccp2))
+    {
+        pwm_sync_test_latched++;
+        if(pwm_sync_test_period != (uint16_t)(l_ccp1 + l_ccp2))
+        {
+            pwm_sync_test_mismatched++;
+        }
+        else
+            { /* Nothing */ }
+        pwm_sync_test_last_ccp1 = l_ccp1;
+        pwm_sync_test_last_ccp2 = l_ccp2;
+    }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : Runs (_cycles) instruction cycles and observes the latched
+ *          pair after every one.
+ */
+static void pwm_sync_test_wait(uint32_t _cycles)
+{
+    uint32_t l_cycle = ZERO_INIT;
+    for(l_cycle = ZERO_INIT; l_cycle < _cycles; l_cycle++)
+    {
+        sim_delay_cycles(1UL);
+        pwm_sync_test_observe();
+    }
+}
+
+/**
+ * @brief : Clears the counters, the current pair is the reference.
+ */
+static void pwm_sync_test_clear(void)
+{
+    pwm_sync_test_handler_runs = ZERO_INIT;
+    pwm_sync_test_last_ccp1 = PWM_SYNC_TEST_CCPR1H;
+    pwm_sync_test_last_ccp2 = PWM_SYNC_TEST_CCPR2H;
+    pwm_sync_test_latched = ZERO_INIT;
+    pwm_sync_test_mismatched = ZERO_INIT;
+}
+
+/**
+ * @brief : A repeatable pseudo random number (0 --> 32767).
+ */
+static uint16_t pwm_sync_test_rand(void)
+{
+    pwm_sync_test_random = (pwm_sync_test_random * 1103515245UL) + 12345UL;
+    return (uint16_t)((pwm_sync_test_random >> 16) & 0x7FFFUL);
+}
+
+#else
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    printf("CCP_PWM_SYNC_FEATURE is off : build with -DCCP1_CFG_SELECTED_MODE=CCP_CFG_PWM_MODE_SELECTED"
+           " -DCCP_PWM_SYNC_FEATURE=CONFIG_ENABLE (see the file header)\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,151 @@
+/*
+ * File:   sw_timer_benchmark.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The software timers tick cost benchmark (HOST_SIM) <--
+ *
+ * Calls the TIMER0 routine (the wheel tick) SW_TIMER_BENCHMARK_TICKS
+ * times by hand with 0, 1, 16, 128 and 1024 active periodic timers of
+ * random delays and periods, and prints the simulated cycles of one tick
+ * (average and worst) and the expiries per tick. The tick cost must stay
+ * flat in the number of active timers, only the callbacks of the expired
+ * timers add to it (the worst tick is a crowded slot cascaded down a
+ * level). Built with the call cost model of the simulator :
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. -finstrument-functions \
+ *          -finstrument-functions-exclude-file-list=HOST_SIM \
+ *          BENCHMARK/sw_timer_benchmark.c \
+ *          MCAL/SW_TIMER/sw_timer.c MCAL/TIMER0/timer0.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * (The cycles are the SFR accesses and the CALL/RETURN of INTI_TMR0_ISR,
+ *  the wheel functions and the callbacks, the C code in between is free :
+ *  a lower bound of the target cost, good to compare the runs)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../MCAL/SW_TIMER/sw_timer.h"
+#include "../MCAL/Interrupt/MCAL_interrupt_manager.h"
+
+#ifndef HOST_SIM
+#error "The software timers benchmark runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The ticks of every run (1M) */
+#define SW_TIMER_BENCHMARK_TICKS        (1UL << 20)
+/* The most active timers of a run */
+#define SW_TIMER_BENCHMARK_MAX_TIMERS   1024U
+/* The runs and their active timers */
+#define SW_TIMER_BENCHMARK_RUNS         5U
+
+/* --------------- Section : Global Variables --------------- */
+static const uint16_t sw_timer_benchmark_active[SW_TIMER_BENCHMARK_RUNS] = {
+    0U, 1U, 16U, 128U, SW_TIMER_BENCHMARK_MAX_TIMERS
+};
+static sw_timer_t sw_timer_benchmark_timers[SW_TIMER_BENCHMARK_MAX_TIMERS];
+static volatile uint32_t sw_timer_benchmark_expiries = ZERO_INIT;
+
+static const Timer0_t sw_timer_benchmark_timer0 = {
+    .priority = PRIORITY_HIGH,
+    .timer0_preloaded_value = ZERO_INIT,
+    .timer0_mode = TMR0_TIMER_MODE,
+    .prescaler_enable = TMR0_PRESCALER_DISABLE,
+    .tmr0_register_size = TMR0_8_BIT_MODE
+};
+
+/* The cycles of the ticks of the last run */
+static unsigned long long sw_timer_benchmark_cycles = 0;
+static unsigned long sw_timer_benchmark_worst = 0;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void sw_timer_benchmark_callback(void);
+static void sw_timer_benchmark_run(uint16_t _active);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    uint8_t l_run = ZERO_INIT;
+
+    if(E_OK != sw_timer_init(&sw_timer_benchmark_timer0))
+    {
+        printf("sw_timer_init failed\n");
+        return 1;
+    }
+    else
+        { /* Nothing */ }
+    /* The ticks are called by hand, the vectors stay off */
+    INTERRUPT_GIEH_DISABLE();
+    srand(1U);
+
+    if(ZERO_INIT == sim_get_calls())
+    {
+        printf("Built without -finstrument-functions, the calls are free\n");
+    }
+    else
+        { /* Nothing */ }
+
+    printf("active timers   cycles per tick   worst tick   expiries per tick\n");
+    for(l_run = ZERO_INIT; l_run < SW_TIMER_BENCHMARK_RUNS; l_run++)
+    {
+        sw_timer_benchmark_run(sw_timer_benchmark_active[l_run]);
+        printf("%13u   %15.2f   %10lu   %17.4f\n", sw_timer_benchmark_active[l_run],
+               (double)sw_timer_benchmark_cycles / (double)SW_TIMER_BENCHMARK_TICKS,
+               sw_timer_benchmark_worst,
+               (double)sw_timer_benchmark_expiries / (double)SW_TIMER_BENCHMARK_TICKS);
+    }
+    return 0;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+static void sw_timer_benchmark_callback(void)
+{
+    sw_timer_benchmark_expiries++;
+}
+
+/**
+ * @brief : Starts (_active) periodic timers of random delays (1 --> 65000)
+ *          and periods (1000 --> 65000), then counts the cycles of the ticks
+ *          (sw_timer_benchmark_cycles, sw_timer_benchmark_worst).
+ */
+static void sw_timer_benchmark_run(uint16_t _active)
+{
+    uint32_t l_tick = ZERO_INIT;
+    uint16_t l_index = ZERO_INIT;
+    unsigned long long l_start = 0;
+    unsigned long l_cycles = 0;
+
+    for(l_index = ZERO_INIT; l_index < SW_TIMER_BENCHMARK_MAX_TIMERS; l_index++)
+    {
+        (void)sw_timer_stop(&sw_timer_benchmark_timers[l_index]);
+    }
+    for(l_index = ZERO_INIT; l_index < _active; l_index++)
+    {
+        sw_timer_benchmark_timers[l_index].callback = sw_timer_benchmark_callback;
+        sw_timer_benchmark_timers[l_index].context = SW_TIMER_CONTEXT_ISR;
+        (void)sw_timer_start(&sw_timer_benchmark_timers[l_index], (uint16_t)(1 + (rand() % 65000)),
+                             (uint16_t)(1000 + (rand() % 64000)));
+    }
+    sw_timer_benchmark_expiries = ZERO_INIT;
+    sw_timer_benchmark_cycles = 0;
+    sw_timer_benchmark_worst = 0;
+
+    for(l_tick = ZERO_INIT; l_tick < SW_TIMER_BENCHMARK_TICKS; l_tick++)
+    {
+        l_start = sim_get_cycles();
+        INTI_TMR0_ISR();
+        l_cycles = (unsigned long)(sim_get_cycles() - l_start);
+        sw_timer_benchmark_cycles += l_cycles;
+        if(l_cycles > sw_timer_benchmark_worst)
+            { sw_timer_benchmark_worst = l_cycles; }
+        else
+            { /* Nothing */ }
+    }
+}
@@ -0,0 +1,330 @@
+/*
+ * File:   timer_drift_test.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The timers period drift test (HOST_SIM) <--
+ *
+ * Runs the four timers for TIMER_DRIFT_TEST_SECONDS of simulated time
+ * (Fosc 8 MHz) while the main loop takes short critical sections, which
+ * jitter the interrupt latency, then prints the mean period of every
+ * timer and its drift :
+ *
+ *  0. The baseline : the old routines, they clear the flag and write the
+ *     preloaded value back, the ticks counted since the overflow (the
+ *     interrupt latency) are lost every period.
+ *  1. The ISR reload without a prescaler : the ticks counted since the
+ *     overflow are kept, the drift must be zero.
+ *  2. The ISR reload with a prescaler : the TMRx write clears the
+ *     prescaler counter, the part of a tick counted before the write is
+ *     lost (0 --> prescaler - 1 cycles per period). This is the residual.
+ *  3. The hardware periods with a prescaler : TIMER2 on PR2 and TIMER3
+ *     on the CCP1 special event trigger, nothing is written, the drift
+ *     must be zero.
+ *
+ *      gcc -std=gnu11 -O2 -DHOST_SIM -I. BENCHMARK/timer_drift_test.c \
+ *          MCAL/TIMER0/timer0.c MCAL/TIMER1/timer1.c MCAL/TIMER2/timer2.c \
+ *          MCAL/TIMER3/timer3.c MCAL/TIMER16/timer16.c MCAL/CCP/ccp.c \
+ *          MCAL/Interrupt/MCAL_interrupt_manager.c MCAL/Interrupt/INT_interrupts/MCAL_INTI.c \
+ *          MCAL/Interrupt/EXT_interrupts/MCAL_EXTI.c MCAL/Interrupt/EVENT_queue/MCAL_event_queue.c \
+ *          MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.c MCAL/DIO/DIO.c \
+ *          MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * The seconds per hour are extrapolated from the mean period of the run,
+ * -DTIMER_DRIFT_TEST_SECONDS=3600UL runs a full simulated hour (about
+ * 45 minutes on the host).
+ * (The exit code is 0 when the rows 1 and 3 don't drift)
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../MCAL/TIMER0/timer0.h"
+#include "../MCAL/TIMER1/timer1.h"
+#include "../MCAL/TIMER2/timer2.h"
+#include "../MCAL/TIMER3/timer3.h"
+#include "../MCAL/CCP/ccp.h"
+#include "../MCAL/Interrupt/MCAL_interrupt_manager.h"
+
+#ifndef HOST_SIM
+#error "The drift test runs on the HOST_SIM backend only"
+#endif
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The simulated time of every run */
+#ifndef TIMER_DRIFT_TEST_SECONDS
+#define TIMER_DRIFT_TEST_SECONDS        60UL
+#endif
+#define TIMER_DRIFT_TEST_CYCLES         (TIMER_DRIFT_TEST_SECONDS * (_XTAL_FREQ / 4UL))
+/* The most drift of an exact period (in ppm) */
+#define TIMER_DRIFT_TEST_LIMIT_PPM      1.0
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef enum
+{
+    DRIFT_TIMER0 = 0,
+    DRIFT_TIMER1,
+    DRIFT_TIMER2,
+    DRIFT_TIMER3,
+    DRIFT_TIMERS_NUMBER
+} drift_timer_t;
+
+/* The interrupts of one timer */
+typedef struct
+{
+    unsigned long long first;
+    unsigned long long last;
+    uint32_t hits;
+} drift_record_t;
+
+/* --------------- Section : Global Variables --------------- */
+static drift_record_t drift_records[DRIFT_TIMERS_NUMBER];
+
+static void drift_timer0_handler(void);
+static void drift_timer1_handler(void);
+static void drift_timer2_handler(void);
+static void drift_timer3_handler(void);
+
+/* 1 ms : 2000 ticks, or 250 ticks at 1:8 */
+static Timer0_t drift_timer0 = {
+    .TMR0_INTERRUPT_HANDLER = drift_timer0_handler,
+    .priority = PRIORITY_HIGH,
+    .timer0_mode = TMR0_TIMER_MODE,
+    .tmr0_register_size = TMR0_16_BIT_MODE
+};
+
+/* 10 ms : 20000 ticks, or 2500 ticks at 1:8 */
+static Timer1_t drift_timer1 = {
+    .TMR1_INTERRUPT_HANDLER = drift_timer1_handler,
+    .priority = PRIORITY_LOW,
+    .timer1_mode = TMR1_TIMER_MODE,
+    .timer1_rw_mode = TMR1_RW_REG_MODE_16BIT
+};
+
+/* 100 us : 200 ticks, or 50 ticks at 1:4 */
+static Timer2_t drift_timer2 = {
+    .TMR2_INTERRUPT_HANDLER = drift_timer2_handler,
+    .priority = PRIORITY_LOW,
+    .postscaler_value = TMR2_POSTSCALAR_RATIO_1
+};
+
+/* 20 ms : 40000 ticks, or 100 ms : 25000 ticks at 1:8 */
+static Timer3_t drift_timer3 = {
+    .TMR3_INTERRUPT_HANDLER = drift_timer3_handler,
+    .priority = PRIORITY_LOW,
+    .timer3_mode = TMR3_TIMER_MODE,
+    .timer3_rw_mode = TMR1_RW_REG_MODE_16BIT
+};
+
+/* The TIMER3 period of the run 3, reset on the CCPR1 match */
+static const ccp_t drift_ccp1 = {
+    .ccp_interrupt_handler = drift_timer3_handler,
+    .ccp_interrupt_priority = PRIORITY_LOW,
+    .ccp_compare_config = CCP_COMPARE_GEN_EVENT,
+    .ccp_compare_timer = CCP1_CCP2_TMR3,
+    .ccp_module_select = CCP1_MODULE,
+    .ccp_mode = CCP_MODE_COMPARE,
+    .pin = {.port = PORTC_INDEX, .pin = PIN2_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW}
+};
+
+static const uint8_t *const drift_names[DRIFT_TIMERS_NUMBER] = {
+    (const uint8_t *)"TIMER0", (const uint8_t *)"TIMER1",
+    (const uint8_t *)"TIMER2", (const uint8_t *)"TIMER3"
+};
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void drift_rewrite_timer0_isr(void);
+static void drift_rewrite_timer1_isr(void);
+static void drift_rewrite_timer2_isr(void);
+static void drift_rewrite_timer3_isr(void);
+static void drift_record(drift_timer_t _timer);
+static void drift_run(void);
+static uint8_t drift_report(drift_timer_t _timer, const char *_mode, uint32_t _period_cycles);
+
+/*---------------  Section: Function Definitions --------------- */
+int main(void)
+{
+    uint8_t l_exact = STD_TRUE;
+
+    printf("%lu s of simulated time per run, drift of the mean period%s\n", TIMER_DRIFT_TEST_SECONDS,
+           (TIMER_DRIFT_TEST_SECONDS < 3600UL) ? " (s/h extrapolated from the run)" : "");
+
+    /* 0. The old preload rewrite, no prescaler */
+    sim_reset();
+    drift_timer0.timer0_preloaded_value = (uint16_t)(65536UL - 2000UL);
+    drift_timer0.prescaler_enable = TMR0_PRESCALER_DISABLE;
+    drift_timer1.timer1_preloaded_value = (uint16_t)(65536UL - 20000UL);
+    drift_timer1.prescaler_value = TMR1_PRESCALAR_RATIO_1;
+    drift_timer2.timer2_preloaded_value = (uint8_t)(256U - 200U);
+    drift_timer2.prescaler_value = TMR2_PRESCALER_RATIO_1;
+    drift_timer3.timer3_preloaded_value = (uint16_t)(65536UL - 40000UL);
+    drift_timer3.prescaler_value = TMR3_PRESCALAR_RATIO_1;
+    (void)timer0_init(&drift_timer0);
+    (void)timer1_init(&drift_timer1);
+    (void)timer2_init(&drift_timer2);
+    (void)timer3_init(&drift_timer3);
+    (void)Interrupt_Manager_Register(INTERRUPT_SOURCE_TMR0, drift_rewrite_timer0_isr);
+    (void)Interrupt_Manager_Register(INTERRUPT_SOURCE_TMR1, drift_rewrite_timer1_isr);
+    (void)Interrupt_Manager_Register(INTERRUPT_SOURCE_TMR2, drift_rewrite_timer2_isr);
+    (void)Interrupt_Manager_Register(INTERRUPT_SOURCE_TMR3, drift_rewrite_timer3_isr);
+    drift_run();
+    printf("0. Old preload rewrite, no prescaler (the baseline)\n");
+    (void)drift_report(DRIFT_TIMER0, "rewrite 1:1", 2000UL);
+    (void)drift_report(DRIFT_TIMER1, "rewrite 1:1", 20000UL);
+    (void)drift_report(DRIFT_TIMER2, "rewrite 1:1", 200UL);
+    (void)drift_report(DRIFT_TIMER3, "rewrite 1:1", 40000UL);
+
+    /* 1. The ISR reload without a prescaler */
+    sim_reset();
+    (void)timer0_init(&drift_timer0);
+    (void)timer1_init(&drift_timer1);
+    (void)timer2_init(&drift_timer2);
+    (void)timer3_init(&drift_timer3);
+    drift_run();
+    printf("1. ISR reload, no prescaler\n");
+    l_exact &= drift_report(DRIFT_TIMER0, "reload 1:1 ", 2000UL);
+    l_exact &= drift_report(DRIFT_TIMER1, "reload 1:1 ", 20000UL);
+    l_exact &= drift_report(DRIFT_TIMER2, "reload 1:1 ", 200UL);
+    l_exact &= drift_report(DRIFT_TIMER3, "reload 1:1 ", 40000UL);
+
+    /* 2. The ISR reload with a prescaler */
+    sim_reset();
+    drift_timer0.timer0_preloaded_value = (uint16_t)(65536UL - 250UL);
+    drift_timer0.prescaler_enable = TMR0_PRESCALER_ENABLE;
+    drift_timer0.prescaler_value = TMR0_PRESCALAR_RATIO_8;
+    drift_timer1.timer1_preloaded_value = (uint16_t)(65536UL - 2500UL);
+    drift_timer1.prescaler_value = TMR1_PRESCALAR_RATIO_8;
+    drift_timer2.timer2_preloaded_value = (uint8_t)(256U - 50U);
+    drift_timer2.prescaler_value = TMR2_PRESCALER_RATIO_4;
+    drift_timer3.timer3_preloaded_value = (uint16_t)(65536UL - 25000UL);
+    drift_timer3.prescaler_value = TMR3_PRESCALAR_RATIO_8;
+    (void)timer0_init(&drift_timer0);
+    (void)timer1_init(&drift_timer1);
+    (void)timer2_init(&drift_timer2);
+    (void)timer3_init(&drift_timer3);
+    drift_run();
+    printf("2. ISR reload, prescaler (the residual)\n");
+    (void)drift_report(DRIFT_TIMER0, "reload 1:8 ", 2000UL);
+    (void)drift_report(DRIFT_TIMER1, "reload 1:8 ", 20000UL);
+    (void)drift_report(DRIFT_TIMER2, "reload 1:4 ", 200UL);
+    (void)drift_report(DRIFT_TIMER3, "reload 1:8 ", 200000UL);
+
+    /* 3. The hardware periods with a prescaler, nothing is written */
+    sim_reset();
+    drift_timer2.timer2_preloaded_value = ZERO_INIT;
+    drift_timer2.prescaler_value = TMR2_PRESCALER_RATIO_4;
+    (void)timer2_init(&drift_timer2);
+    (void)timer2_set_period(&drift_timer2, 49U);
+    drift_timer3.TMR3_INTERRUPT_HANDLER = NULL;
+    drift_timer3.timer3_preloaded_value = ZERO_INIT;
+    drift_timer3.prescaler_value = TMR3_PRESCALAR_RATIO_8;
+    (void)timer3_init(&drift_timer3);
+    (void)CCP_Init(&drift_ccp1);
+    (void)CCP_Compare_SetValue(&drift_ccp1, 25000U);
+    drift_run();
+    printf("3. Hardware period, prescaler\n");
+    l_exact &= drift_report(DRIFT_TIMER2, "PR2 1:4    ", 200UL);
+    l_exact &= drift_report(DRIFT_TIMER3, "CCP1 1:8   ", 200000UL);
+
+    printf("%s\n", (STD_TRUE == l_exact) ? "PASS" : "FAIL");
+    return (STD_TRUE == l_exact) ? 0 : 1;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+static void drift_timer0_handler(void) { drift_record(DRIFT_TIMER0); }
+static void drift_timer1_handler(void) { drift_record(DRIFT_TIMER1); }
+static void drift_timer2_handler(void) { drift_record(DRIFT_TIMER2); }
+static void drift_timer3_handler(void) { drift_record(DRIFT_TIMER3); }
+
+/**
+ * @brief : The old timer routines of the baseline : clear the flag, write
+ *          the preloaded value back, then call the handler.
+ */
+static void drift_rewrite_timer0_isr(void)
+{
+    INTI_TMR0_CLR_FLAG();
+    TMR0_WRITE_HIGH_BYTE((drift_timer0.timer0_preloaded_value) >> 8);
+    TMR0_WRITE_LOW_BYTE((uint8_t)(drift_timer0.timer0_preloaded_value));
+    drift_timer0_handler();
+}
+
+static void drift_rewrite_timer1_isr(void)
+{
+    INTI_TMR1_CLR_FLAG();
+    TMR1_WRITE(drift_timer1.timer1_preloaded_value);
+    drift_timer1_handler();
+}
+
+static void drift_rewrite_timer2_isr(void)
+{
+    INTI_TMR2_CLR_FLAG();
+    TMR2_WRITE(drift_timer2.timer2_preloaded_value);
+    drift_timer2_handler();
+}
+
+static void drift_rewrite_timer3_isr(void)
+{
+    INTI_TMR3_CLR_FLAG();
+    TMR3_WRITE(drift_timer3.timer3_preloaded_value);
+    drift_timer3_handler();
+}
+
+static void drift_record(drift_timer_t _timer)
+{
+    unsigned long long l_now = sim_get_cycles();
+    if(ZERO_INIT == drift_records[_timer].hits)
+    {
+        drift_records[_timer].first = l_now;
+    }
+    else
+        { /* Nothing */ }
+    drift_records[_timer].last = l_now;
+    drift_records[_timer].hits++;
+}
+
+/**
+ * @brief : Runs the started timers for TIMER_DRIFT_TEST_CYCLES, the main
+ *          loop takes a 0 --> 39 cycles critical section every 50 --> 449 cycles.
+ */
+static void drift_run(void)
+{
+    unsigned long long l_start = sim_get_cycles();
+    uint8_t l_timer = ZERO_INIT;
+    for(l_timer = ZERO_INIT; l_timer < DRIFT_TIMERS_NUMBER; l_timer++)
+    {
+        drift_records[l_timer].hits = ZERO_INIT;
+    }
+    srand(1U);
+    while((sim_get_cycles() - l_start) < TIMER_DRIFT_TEST_CYCLES)
+    {
+        sim_delay_cycles(50UL + (unsigned long)(rand() % 400));
+        INTERRUPT_GIEH_DISABLE();
+        sim_delay_cycles((unsigned long)(rand() % 40));
+        INTERRUPT_GIEH_ENABLE();
+    }
+}
+
+/**
+ * @brief : Prints the mean period of a timer and its drift.
+ * @return STD_TRUE : The drift is within TIMER_DRIFT_TEST_LIMIT_PPM.
+ */
+static uint8_t drift_report(drift_timer_t _timer, const char *_mode, uint32_t _period_cycles)
+{
+    const drift_record_t *l_record = &drift_records[_timer];
+    double l_mean = 0.0;
+    double l_ppm = 0.0;
+    if(l_record->hits > 1U)
+    {
+        l_mean = (double)(l_record->last - l_record->first) / (double)(l_record->hits - 1U);
+        l_ppm = (((double)_period_cycles - l_mean) / (double)_period_cycles) * 1e6;
+    }
+    else
+    {
+        l_ppm = -1e6;
+    }
+    printf("   %s %s : %8lu ISRs, mean period %12.4f cycles (ideal %6lu), drift %+8.1f ppm = %+.3f s/h\n",
+           (const char *)drift_names[_timer], _mode, (unsigned long)l_record->hits, l_mean,
+           (unsigned long)_period_cycles, l_ppm, l_ppm * 3600e-6);
+    return ((l_ppm < TIMER_DRIFT_TEST_LIMIT_PPM) && (l_ppm > -TIMER_DRIFT_TEST_LIMIT_PPM)) ? STD_TRUE : STD_FALSE;
+}
@@ -18,7 +18,7 @@
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if SEVEN_SEGMENT_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType seven_segment_initialize(const seven_segment_t * segment){
+Std_ReturnType seven_segment_initialize(seven_segment_t * segment){
     Std_ReturnType ret = E_OK;
     if (NULL == segment)
     {
@@ -26,11 +26,9 @@ Std_ReturnType seven_segment_initialize(const seven_segment_t * segment){
     }
     else
     {
-        uint8_t l_counter = ZERO_INIT;
-        for (; l_counter < SEGMENT_PINS_MAX; ++l_counter)
-        {
-            ret = gpio_pin_initialize(&(segment->segment_pins[l_counter]));
-        }
+        ret = gpio_init_table(segment->segment_pins, SEGMENT_PINS_MAX);
+        ret = gpio_group_init(&(segment->segment_group), segment->segment_pins, 
+                              SEGMENT_PINS_MAX);
     }
     return ret;
 }
@@ -55,12 +53,7 @@ Std_ReturnType seven_segment_write_num(const seven_segment_t * segment,
     }
     else
     {        
-        uint8_t l_counter = ZERO_INIT;
-        for (; l_counter < SEGMENT_PINS_MAX; ++l_counter)
-        {
-            ret = gpio_pin_write_logic(&(segment -> segment_pins[l_counter]),  
-                                    (number >> l_counter) & 0X01);
-        }
+        ret = gpio_group_write(&(segment->segment_group), number);
     }
     return ret;
 }
@@ -32,11 +32,11 @@ typedef enum{
 typedef struct{
     pin_config_t segment_pins[4];
     segment_type_t segment_type;
-    
+    gpio_group_t segment_group;     /* Filled by seven_segment_initialize() */
 }seven_segment_t;
 
 /* Section: Function Declarations */
-Std_ReturnType seven_segment_initialize(const seven_segment_t * segment);
+Std_ReturnType seven_segment_initialize(seven_segment_t * segment);
 Std_ReturnType seven_segment_write_num(const seven_segment_t * segment, uint8_t num);
 
 #endif	/* SEVEN_SEGMENT_H */
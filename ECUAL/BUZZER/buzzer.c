@@ -49,7 +49,11 @@ Std_ReturnType buzzer_turn_on(const Buzzer_t *_buzzer)
     }
     else
     {
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        ret = gpio_shadow_pin_write_logic(&(_buzzer->buzzer_pin), STD_HIGH);
+#else
         ret = gpio_pin_write_logic(&(_buzzer->buzzer_pin), STD_HIGH);
+#endif
     }
     return ret;
 }
@@ -71,7 +75,11 @@ Std_ReturnType buzzer_turn_off(const Buzzer_t *_buzzer)
     }
     else
     {
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        ret = gpio_shadow_pin_write_logic(&(_buzzer->buzzer_pin), STD_LOW);
+#else
         ret = gpio_pin_write_logic(&(_buzzer->buzzer_pin), STD_LOW);
+#endif
     }
     return ret;
 }
\ No newline at end of file
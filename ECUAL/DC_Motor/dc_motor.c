@@ -7,14 +7,14 @@
 
 #include "dc_motor.h"
 
-Std_ReturnType dc_motor_init(const dc_motor_t *_dc_motor){
+Std_ReturnType dc_motor_init(dc_motor_t *_dc_motor){
     Std_ReturnType ret = E_OK;
     if((NULL == _dc_motor) || ((_dc_motor->button_pin)->pin) > PIN_MAX_NUMBER - 1
                            || ((_dc_motor->button_pin)->port) > PORT_MAX_NUMBER - 1){
         ret = E_NOT_OK;
     }else{
-        ret = gpio_pin_initialize(&(_dc_motor->button_pin[DC_MOTOR_PIN1]));
-        ret = gpio_pin_initialize(&(_dc_motor->button_pin[DC_MOTOR_PIN2]));
+        ret = gpio_init_table(_dc_motor->button_pin, 2);
+        ret = gpio_group_init(&(_dc_motor->dc_motor_group), _dc_motor->button_pin, 2);
     }
     return ret;
 }
@@ -23,8 +23,7 @@ Std_ReturnType dc_motor_move_CW(const dc_motor_t *_dc_motor){
     if(NULL == _dc_motor){
         ret = E_NOT_OK;
     }else{
-        ret = gpio_pin_write_logic(&(_dc_motor->button_pin[DC_MOTOR_PIN1]), GPIO_HIGH);
-        ret = gpio_pin_write_logic(&(_dc_motor->button_pin[DC_MOTOR_PIN2]), GPIO_LOW);
+        ret = gpio_group_write(&(_dc_motor->dc_motor_group), DC_MOTOR_CW_VALUE);
     }
     return ret;
 }
@@ -33,8 +32,7 @@ Std_ReturnType dc_motor_move_CCW(const dc_motor_t *_dc_motor){
     if(NULL == _dc_motor){
         ret = E_NOT_OK;
     }else{
-        ret = gpio_pin_write_logic(&(_dc_motor->button_pin[DC_MOTOR_PIN1]), GPIO_LOW);
-        ret = gpio_pin_write_logic(&(_dc_motor->button_pin[DC_MOTOR_PIN2]), GPIO_HIGH);
+        ret = gpio_group_write(&(_dc_motor->dc_motor_group), DC_MOTOR_CCW_VALUE);
     }
     return ret;
 }
@@ -43,8 +41,7 @@ Std_ReturnType dc_motor_stop(const dc_motor_t *_dc_motor){
     if(NULL == _dc_motor){
         ret = E_NOT_OK;
     }else{
-        ret = gpio_pin_write_logic(&(_dc_motor->button_pin[DC_MOTOR_PIN1]), GPIO_LOW);
-        ret = gpio_pin_write_logic(&(_dc_motor->button_pin[DC_MOTOR_PIN2]), GPIO_LOW);
+        ret = gpio_group_write(&(_dc_motor->dc_motor_group), DC_MOTOR_STOP_VALUE);
     }
     return ret;
 }
\ No newline at end of file
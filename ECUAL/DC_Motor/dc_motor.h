@@ -19,14 +19,20 @@
 #define DC_MOTOR_PIN1   0x00U
 #define DC_MOTOR_PIN2   0x01U
 
+/* The group value of each motion, bit (n) drives button_pin[n] */
+#define DC_MOTOR_CW_VALUE       0x01U
+#define DC_MOTOR_CCW_VALUE      0x02U
+#define DC_MOTOR_STOP_VALUE     0x00U
+
 /* ----------------- Data Type Declarations -----------------*/
 typedef struct {
     pin_config_t button_pin[2];
+    gpio_group_t dc_motor_group;    /* Filled by dc_motor_init() */
 } dc_motor_t;
 
 
 /* ----------------- Software Interfaces Declarations -----------------*/
-Std_ReturnType dc_motor_init(const dc_motor_t *_dc_motor);
+Std_ReturnType dc_motor_init(dc_motor_t *_dc_motor);
 Std_ReturnType dc_motor_move_CW(const dc_motor_t *_dc_motor);
 Std_ReturnType dc_motor_move_CCW(const dc_motor_t *_dc_motor);
 Std_ReturnType dc_motor_stop(const dc_motor_t *_dc_motor);
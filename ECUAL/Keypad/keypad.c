@@ -43,15 +43,13 @@ Std_ReturnType keypad_initialize(keypad_t* _keypad)
         ret = E_NOT_OK;
     }
     else{
-        uint8_t l_rows_counter = ZERO_INIT, l_columns_counter = ZERO_INIT;
-        for (l_rows_counter = ZERO_INIT; l_rows_counter < KEYPAD_ROWS; ++l_rows_counter)
-        {
-            ret = gpio_pin_initialize(&(_keypad->keypad_row_pins[l_rows_counter]));
-        }
-        for (l_columns_counter = ZERO_INIT; l_columns_counter < KEYPAD_COLUMNS; ++l_columns_counter)
-        {
-            ret = gpio_pin_direction_init(&(_keypad->keypad_columns_pins[l_columns_counter]));
-        }
+        ret = gpio_init_table(_keypad->keypad_row_pins, KEYPAD_ROWS);
+        /* The columns are inputs, their latch bits have no effect on the pins */
+        ret |= gpio_init_table(_keypad->keypad_columns_pins, KEYPAD_COLUMNS);
+        ret = gpio_group_init(&(_keypad->keypad_rows_group), 
+                              _keypad->keypad_row_pins, KEYPAD_ROWS);
+        ret = gpio_group_init(&(_keypad->keypad_columns_group), 
+                              _keypad->keypad_columns_pins, KEYPAD_COLUMNS);
     }
     return ret;
 }
@@ -73,27 +71,93 @@ Std_ReturnType keypad_get_value(keypad_t* _keypad, uint8_t* value)
     }
     else
     {
-        uint8_t l_rows_counter = ZERO_INIT, l_columns_counter = ZERO_INIT, l_counter = ZERO_INIT;
-        uint8_t columns_logic = GPIO_LOW;
+        uint8_t l_rows_counter = ZERO_INIT, l_columns_counter = ZERO_INIT;
+        uint8_t columns_logic = ZERO_INIT;
         for(l_rows_counter = ZERO_INIT;l_rows_counter < KEYPAD_ROWS; l_rows_counter++)
         {
-            
-            /* First : make sure all rows are LOW */
-            for(l_counter = ZERO_INIT;l_counter < KEYPAD_ROWS; ++l_counter)
-            {
-                ret = gpio_pin_write_logic(&(_keypad->keypad_row_pins[l_counter]), GPIO_LOW);
-            }
-            
-            /* Then write HIGH on the current row */
-            ret = gpio_pin_write_logic(&(_keypad->keypad_row_pins[l_rows_counter]), GPIO_HIGH);
+            /* Only the current row is HIGH, all the rows in one group write */
+            ret = gpio_group_write(&(_keypad->keypad_rows_group), 
+                                   (uint8_t)(BIT_MASK << l_rows_counter));
+            /* All the columns in one group read */
+            ret = gpio_group_read(&(_keypad->keypad_columns_group), &columns_logic);
             for (l_columns_counter = ZERO_INIT; l_columns_counter  < KEYPAD_COLUMNS; l_columns_counter++)
             {
-                ret = gpio_pin_read_logic(&(_keypad->keypad_columns_pins[l_columns_counter]), &columns_logic);
-                if(GPIO_HIGH == columns_logic){
+                if(READ_BIT(columns_logic, l_columns_counter)){
                     *value = buttons_values[l_rows_counter][l_columns_counter];
                 }
             }
         }
     }
     return ret;
-}
\ No newline at end of file
+}
+
+#if DIO_STATIC_PIN_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief : A software interface initializes the keypad wired on the board 
+ *          pins (BOARD_PIN_KEYPAD_ROWx outputs LOW, BOARD_PIN_KEYPAD_COLx inputs)
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ */
+Std_ReturnType keypad_static_initialize(void)
+{
+    GPIO_BOARD_PIN_LOW(BOARD_PIN_KEYPAD_ROW0);
+    GPIO_BOARD_PIN_LOW(BOARD_PIN_KEYPAD_ROW1);
+    GPIO_BOARD_PIN_LOW(BOARD_PIN_KEYPAD_ROW2);
+    GPIO_BOARD_PIN_LOW(BOARD_PIN_KEYPAD_ROW3);
+    GPIO_BOARD_PIN_OUTPUT(BOARD_PIN_KEYPAD_ROW0);
+    GPIO_BOARD_PIN_OUTPUT(BOARD_PIN_KEYPAD_ROW1);
+    GPIO_BOARD_PIN_OUTPUT(BOARD_PIN_KEYPAD_ROW2);
+    GPIO_BOARD_PIN_OUTPUT(BOARD_PIN_KEYPAD_ROW3);
+    GPIO_BOARD_PIN_INPUT(BOARD_PIN_KEYPAD_COL0);
+    GPIO_BOARD_PIN_INPUT(BOARD_PIN_KEYPAD_COL1);
+    GPIO_BOARD_PIN_INPUT(BOARD_PIN_KEYPAD_COL2);
+#if KEYPAD_COLUMNS==4
+    GPIO_BOARD_PIN_INPUT(BOARD_PIN_KEYPAD_COL3);
+#endif
+    return E_OK;
+}
+
+/**
+ * @param value : The variable in which the value will be stored.
+ * @brief : A software interface gets the clicked button on the keypad wired 
+ *          on the board pins, same scan as keypad_get_value() with the pins 
+ *          resolved at compile time (no call in the scan loop).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType keypad_static_get_value(uint8_t* value)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == value){
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        uint8_t l_rows_counter = ZERO_INIT;
+        for(l_rows_counter = ZERO_INIT;l_rows_counter < KEYPAD_ROWS; l_rows_counter++)
+        {
+            /* Only the current row is HIGH */
+            GPIO_BOARD_PIN_WRITE(BOARD_PIN_KEYPAD_ROW0, (0 == l_rows_counter));
+            GPIO_BOARD_PIN_WRITE(BOARD_PIN_KEYPAD_ROW1, (1 == l_rows_counter));
+            GPIO_BOARD_PIN_WRITE(BOARD_PIN_KEYPAD_ROW2, (2 == l_rows_counter));
+            GPIO_BOARD_PIN_WRITE(BOARD_PIN_KEYPAD_ROW3, (3 == l_rows_counter));
+            if(GPIO_BOARD_PIN_READ(BOARD_PIN_KEYPAD_COL0)){
+                *value = buttons_values[l_rows_counter][0];
+            }
+            if(GPIO_BOARD_PIN_READ(BOARD_PIN_KEYPAD_COL1)){
+                *value = buttons_values[l_rows_counter][1];
+            }
+            if(GPIO_BOARD_PIN_READ(BOARD_PIN_KEYPAD_COL2)){
+                *value = buttons_values[l_rows_counter][2];
+            }
+#if KEYPAD_COLUMNS==4
+            if(GPIO_BOARD_PIN_READ(BOARD_PIN_KEYPAD_COL3)){
+                *value = buttons_values[l_rows_counter][3];
+            }
+#endif
+        }
+    }
+    return ret;
+}
+#endif
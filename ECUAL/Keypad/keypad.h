@@ -34,11 +34,18 @@
 typedef struct {
     pin_config_t keypad_row_pins[KEYPAD_ROWS];
     pin_config_t keypad_columns_pins[KEYPAD_COLUMNS];
+    gpio_group_t keypad_rows_group;         /* Filled by keypad_initialize() */
+    gpio_group_t keypad_columns_group;      /* Filled by keypad_initialize() */
 } keypad_t;
 
 /* Section: Function Declarations */
 Std_ReturnType keypad_initialize(keypad_t* _keypad);
 Std_ReturnType keypad_get_value(keypad_t* _keypad, uint8_t* value);
+#if DIO_STATIC_PIN_CONFIGURATION==CONFIG_ENABLE
+/* The keypad wired on the BOARD_PIN_KEYPAD_xxx pins of "dio_cfg.h" */
+Std_ReturnType keypad_static_initialize(void);
+Std_ReturnType keypad_static_get_value(uint8_t* value);
+#endif
 
 #endif	/* KEYPAD_H */
 
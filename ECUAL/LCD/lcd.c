@@ -12,6 +12,22 @@
 static Std_ReturnType lcd_send_4bits(const lcd_4bit_t* _lcd, uint8_t data_command);
 static Std_ReturnType lcd_4bit_send_enable_signal(const lcd_4bit_t* _lcd);
 static Std_ReturnType lcd_8bit_send_enable_signal(const lcd_8bit_t* _lcd);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+static uint8_t lcd_4bit_initialize_steps(lcd_4bit_t* _lcd, Std_ReturnType *ret);
+static uint8_t lcd_8bit_initialize_steps(lcd_8bit_t* _lcd, Std_ReturnType *ret);
+static void lcd_set_busy(deadline_t *busy, uint8_t command);
+
+/* Section : Global Variables */
+/* The init commands sent after the three function set commands */
+static const uint8_t lcd_4bit_init_commands[] = {
+    LCD_CLEAR, LCD_RETURN_HOME, LCD_ENTRY_MODE,
+    LCD_CURSOR_OFF_DISPLAY_ON, LCD_4BIT_MODE_2_LINE, LCD_DDRAM_START
+};
+static const uint8_t lcd_8bit_init_commands[] = {
+    LCD_CLEAR, LCD_RETURN_HOME, LCD_ENTRY_MODE,
+    LCD_CURSOR_OFF_DISPLAY_ON, LCD_8BIT_MODE_2_LINE, LCD_DDRAM_START
+};
+#endif
 
 #if LCD_CONFIGURATION==CONFIG_ENABLE
 /**
@@ -21,18 +37,27 @@ static Std_ReturnType lcd_8bit_send_enable_signal(const lcd_8bit_t* _lcd);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_initialize(const lcd_4bit_t* _lcd){
+Std_ReturnType lcd_4bit_initialize(lcd_4bit_t* _lcd){
     Std_ReturnType ret = E_OK;
-    uint8_t l_data_pins_counter = ZERO_INIT;
     if(NULL == _lcd){
         ret = E_NOT_OK;
     }
     else {
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        /* The same steps as the task, the waits spin here
+         * (on a stopped clock they would never end) */
+        if(STD_FALSE == monotonic_clock_is_running()){
+            ret = E_NOT_OK;
+        }
+        else {
+            DEADLINE_TASK_RESTART(&(_lcd->lcd_init_task));
+            while(DEADLINE_TASK_PENDING == lcd_4bit_initialize_steps(_lcd, &ret));
+        }
+#else
         ret = gpio_pin_initialize(&(_lcd->lcd_rs_pin));
         ret = gpio_pin_initialize(&(_lcd->lcd_en_pin));
-        for( ;l_data_pins_counter < LCD_4BITS; ++l_data_pins_counter){
-            ret = gpio_pin_initialize(&(_lcd -> lcd_data_pins[l_data_pins_counter]));
-        }
+        ret = gpio_init_table(_lcd->lcd_data_pins, LCD_4BITS);
+        ret = gpio_group_init(&(_lcd->lcd_data_group), _lcd->lcd_data_pins, LCD_4BITS);
         __delay_ms(20);
         ret = lcd_4bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
         __delay_ms(5);
@@ -45,6 +70,52 @@ Std_ReturnType lcd_4bit_initialize(const lcd_4bit_t* _lcd){
         ret = lcd_4bit_send_command(_lcd, LCD_CURSOR_OFF_DISPLAY_ON);
         ret = lcd_4bit_send_command(_lcd, LCD_4BIT_MODE_2_LINE);
         ret = lcd_4bit_send_command(_lcd, 0x80);
+#endif
+    }
+   return ret;
+}
+#endif
+
+/**
+ * @brief : A software interface runs one step of the initialization of an LCD
+ *          connected in 4-Bit mode, call it from the main loop until (done),
+ *          the waits return instead of spinning.
+ * @param _lcd : A pointer to an LCD object
+ * @param done : (STD_TRUE) once the LCD is initialized, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+Std_ReturnType lcd_4bit_initialize_task(lcd_4bit_t* _lcd, uint8_t *done){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _lcd) || (NULL == done) || (STD_FALSE == monotonic_clock_is_running())){
+        ret = E_NOT_OK;
+    }
+    else {
+        *done = (DEADLINE_TASK_DONE == lcd_4bit_initialize_steps(_lcd, &ret)) ? STD_TRUE : STD_FALSE;
+    }
+   return ret;
+}
+#endif
+
+/**
+ * @brief : A software interface checks an LCD connected in 4-Bit mode
+ *          executed the last byte sent, the next send doesn't wait then.
+ * @param _lcd : A pointer to an LCD object
+ * @param ready : (STD_TRUE) when the LCD takes a byte now, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+Std_ReturnType lcd_4bit_is_ready(const lcd_4bit_t* _lcd, uint8_t *ready){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _lcd) || (NULL == ready)){
+        ret = E_NOT_OK;
+    }
+    else {
+        *ready = deadline_expired(&(_lcd->lcd_busy_deadline));
     }
    return ret;
 }
@@ -60,17 +131,23 @@ Std_ReturnType lcd_4bit_initialize(const lcd_4bit_t* _lcd){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_send_command(const lcd_4bit_t* _lcd, uint8_t command){
+Std_ReturnType lcd_4bit_send_command(lcd_4bit_t* _lcd, uint8_t command){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
         ret = E_NOT_OK;
     }
     else {
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        ret = deadline_wait(&(_lcd->lcd_busy_deadline));     // The last byte is executed
+#endif
         ret = gpio_pin_write_logic(&(_lcd->lcd_rs_pin), GPIO_LOW); // To send command
         ret = lcd_send_4bits(_lcd, command >> 4);
         ret = lcd_4bit_send_enable_signal(_lcd);
         ret = lcd_send_4bits(_lcd, command);
         ret = lcd_4bit_send_enable_signal(_lcd);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        lcd_set_busy(&(_lcd->lcd_busy_deadline), command);
+#endif
     }
    return ret; 
 }
@@ -86,17 +163,23 @@ Std_ReturnType lcd_4bit_send_command(const lcd_4bit_t* _lcd, uint8_t command){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data){
+Std_ReturnType lcd_4bit_send_char_data(lcd_4bit_t* _lcd, uint8_t data){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
         ret = E_NOT_OK;
     }
     else {
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        ret = deadline_wait(&(_lcd->lcd_busy_deadline));     // The last byte is executed
+#endif
         ret = gpio_pin_write_logic(&(_lcd->lcd_rs_pin), GPIO_HIGH); //To send Data
         ret = lcd_send_4bits(_lcd, data >> 4);
         ret = lcd_4bit_send_enable_signal(_lcd);
         ret = lcd_send_4bits(_lcd, data);
         ret = lcd_4bit_send_enable_signal(_lcd);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        lcd_set_busy(&(_lcd->lcd_busy_deadline), LCD_DDRAM_START);
+#endif
     }
    return ret;
 }
@@ -114,7 +197,7 @@ Std_ReturnType lcd_4bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_send_char_data_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_4bit_send_char_data_pos(lcd_4bit_t* _lcd, 
                                            uint8_t row, uint8_t column, uint8_t data){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
@@ -138,7 +221,7 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const lcd_4bit_t* _lcd,
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str){
+Std_ReturnType lcd_4bit_send_string(lcd_4bit_t* _lcd, uint8_t* str){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
         ret = E_NOT_OK;
@@ -164,7 +247,7 @@ Std_ReturnType lcd_4bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_send_string_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_4bit_send_string_pos(lcd_4bit_t* _lcd, 
                                         uint8_t row, uint8_t column, uint8_t* str){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
@@ -191,7 +274,7 @@ Std_ReturnType lcd_4bit_send_string_pos(const lcd_4bit_t* _lcd,
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_send_custom_char(const lcd_4bit_t* _lcd,
+Std_ReturnType lcd_4bit_send_custom_char(lcd_4bit_t* _lcd,
                                          uint8_t row, uint8_t column, 
                                          const uint8_t _char[], uint8_t memory_pos){
         Std_ReturnType ret = E_OK;
@@ -217,7 +300,7 @@ Std_ReturnType lcd_4bit_send_custom_char(const lcd_4bit_t* _lcd,
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t* _lcd, uint8_t row, uint8_t column){
+Std_ReturnType lcd_4bit_set_cursor(lcd_4bit_t* _lcd, uint8_t row, uint8_t column){
     Std_ReturnType ret = E_OK;
     if(NULL == _lcd){
         ret = E_NOT_OK;
@@ -254,18 +337,27 @@ Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t* _lcd, uint8_t row, uint8_t
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_initialize(const lcd_4bit_t* _lcd){
+Std_ReturnType lcd_8bit_initialize(lcd_8bit_t* _lcd){
     Std_ReturnType ret = E_OK;
-    uint8_t l_data_pins_counter = ZERO_INIT;
     if(NULL == _lcd){
         ret = E_NOT_OK;
     }
     else {
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        /* The same steps as the task, the waits spin here
+         * (on a stopped clock they would never end) */
+        if(STD_FALSE == monotonic_clock_is_running()){
+            ret = E_NOT_OK;
+        }
+        else {
+            DEADLINE_TASK_RESTART(&(_lcd->lcd_init_task));
+            while(DEADLINE_TASK_PENDING == lcd_8bit_initialize_steps(_lcd, &ret));
+        }
+#else
         ret = gpio_pin_initialize(&(_lcd->lcd_rs_pin));
         ret = gpio_pin_initialize(&(_lcd->lcd_en_pin));
-        for( ;l_data_pins_counter < LCD_8BITS; ++l_data_pins_counter){
-            ret = gpio_pin_initialize(&(_lcd->lcd_data_pins[l_data_pins_counter]));
-        }
+        ret = gpio_init_table(_lcd->lcd_data_pins, LCD_8BITS);
+        ret = gpio_group_init(&(_lcd->lcd_data_group), _lcd->lcd_data_pins, LCD_8BITS);
         __delay_ms(20);
         ret = lcd_8bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
         __delay_ms(5);
@@ -278,7 +370,52 @@ Std_ReturnType lcd_8bit_initialize(const lcd_4bit_t* _lcd){
         ret = lcd_8bit_send_command(_lcd, LCD_CURSOR_OFF_DISPLAY_ON);
         ret = lcd_8bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
         ret = lcd_8bit_send_command(_lcd, 0x80);
-        
+#endif
+    }
+   return ret;
+}
+#endif
+
+/**
+ * @brief : A software interface runs one step of the initialization of an LCD
+ *          connected in 8-Bit mode, call it from the main loop until (done),
+ *          the waits return instead of spinning.
+ * @param _lcd : A pointer to an LCD object
+ * @param done : (STD_TRUE) once the LCD is initialized, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+Std_ReturnType lcd_8bit_initialize_task(lcd_8bit_t* _lcd, uint8_t *done){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _lcd) || (NULL == done) || (STD_FALSE == monotonic_clock_is_running())){
+        ret = E_NOT_OK;
+    }
+    else {
+        *done = (DEADLINE_TASK_DONE == lcd_8bit_initialize_steps(_lcd, &ret)) ? STD_TRUE : STD_FALSE;
+    }
+   return ret;
+}
+#endif
+
+/**
+ * @brief : A software interface checks an LCD connected in 8-Bit mode
+ *          executed the last byte sent, the next send doesn't wait then.
+ * @param _lcd : A pointer to an LCD object
+ * @param ready : (STD_TRUE) when the LCD takes a byte now, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+Std_ReturnType lcd_8bit_is_ready(const lcd_8bit_t* _lcd, uint8_t *ready){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _lcd) || (NULL == ready)){
+        ret = E_NOT_OK;
+    }
+    else {
+        *ready = deadline_expired(&(_lcd->lcd_busy_deadline));
     }
    return ret;
 }
@@ -294,19 +431,21 @@ Std_ReturnType lcd_8bit_initialize(const lcd_4bit_t* _lcd){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_send_command(const lcd_4bit_t* _lcd, uint8_t command){
+Std_ReturnType lcd_8bit_send_command(lcd_8bit_t* _lcd, uint8_t command){
     Std_ReturnType ret =E_OK;
-    uint8_t l_pin_counter = ZERO_INIT;
     if(NULL == _lcd){
         ret = E_NOT_OK;
     }
     else {
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        ret = deadline_wait(&(_lcd->lcd_busy_deadline));     // The last byte is executed
+#endif
         ret = gpio_pin_write_logic(&(_lcd->lcd_rs_pin), GPIO_LOW); // To send command
-        for( ; l_pin_counter < LCD_8BITS; ++l_pin_counter){
-            ret = gpio_pin_write_logic(&(_lcd->lcd_data_pins[l_pin_counter]), 
-                                                 (command >> l_pin_counter) & BIT_MASK);
-        }
+        ret = gpio_group_write(&(_lcd->lcd_data_group), command);
         ret = lcd_8bit_send_enable_signal(_lcd);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        lcd_set_busy(&(_lcd->lcd_busy_deadline), command);
+#endif
     }
    return ret;
 }
@@ -322,20 +461,21 @@ Std_ReturnType lcd_8bit_send_command(const lcd_4bit_t* _lcd, uint8_t command){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data){
+Std_ReturnType lcd_8bit_send_char_data(lcd_8bit_t* _lcd, uint8_t data){
     Std_ReturnType ret =E_OK;
-    uint8_t l_pin_counter = ZERO_INIT;
     if(NULL == _lcd){
         ret = E_NOT_OK;
     }
     else {
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        ret = deadline_wait(&(_lcd->lcd_busy_deadline));     // The last byte is executed
+#endif
         ret = gpio_pin_write_logic(&(_lcd->lcd_rs_pin), GPIO_HIGH); // To send Data
-        for( ; l_pin_counter < LCD_8BITS; ++l_pin_counter){
-            ret = gpio_pin_write_logic(&(_lcd->lcd_data_pins[l_pin_counter]), 
-                                                 (data >> l_pin_counter) & BIT_MASK);
-        }
+        ret = gpio_group_write(&(_lcd->lcd_data_group), data);
         ret = lcd_8bit_send_enable_signal(_lcd);
-        
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+        lcd_set_busy(&(_lcd->lcd_busy_deadline), LCD_DDRAM_START);
+#endif
     }
    return ret;
 }
@@ -353,7 +493,7 @@ Std_ReturnType lcd_8bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_send_char_data_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_8bit_send_char_data_pos(lcd_8bit_t* _lcd, 
                                            uint8_t row, uint8_t column, uint8_t data){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
@@ -377,7 +517,7 @@ Std_ReturnType lcd_8bit_send_char_data_pos(const lcd_4bit_t* _lcd,
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str){
+Std_ReturnType lcd_8bit_send_string(lcd_8bit_t* _lcd, uint8_t* str){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
         ret = E_NOT_OK;
@@ -403,7 +543,7 @@ Std_ReturnType lcd_8bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str){
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_send_string_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_8bit_send_string_pos(lcd_8bit_t* _lcd, 
                                         uint8_t row, uint8_t column, uint8_t* str){
         Std_ReturnType ret =E_OK;
     if(NULL == _lcd){
@@ -430,7 +570,7 @@ Std_ReturnType lcd_8bit_send_string_pos(const lcd_4bit_t* _lcd,
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_send_custom_char(const lcd_4bit_t* _lcd,
+Std_ReturnType lcd_8bit_send_custom_char(lcd_8bit_t* _lcd,
                                          uint8_t row, uint8_t column, 
                                          const uint8_t _char[], uint8_t memory_pos){
         Std_ReturnType ret =E_OK;
@@ -456,7 +596,7 @@ Std_ReturnType lcd_8bit_send_custom_char(const lcd_4bit_t* _lcd,
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 #if LCD_CONFIGURATION==CONFIG_ENABLE
-Std_ReturnType lcd_8bit_set_cursor(const lcd_8bit_t* _lcd, uint8_t row, uint8_t column){
+Std_ReturnType lcd_8bit_set_cursor(lcd_8bit_t* _lcd, uint8_t row, uint8_t column){
     Std_ReturnType ret = E_OK;
     if (NULL == _lcd){
         ret = E_NOT_OK;
@@ -545,7 +685,8 @@ Std_ReturnType convert_uint32_to_string(uint32_t value, uint8_t* str){
 #endif
 
 /**
- * @brief
+ * @brief : Writes the low nibble of (data_command) on the data pins,
+ *          a single masked LATx write when the pins share one port.
  * @param _lcd
  * @param data_command
  * @return 
@@ -553,17 +694,7 @@ Std_ReturnType convert_uint32_to_string(uint32_t value, uint8_t* str){
 #if LCD_CONFIGURATION==CONFIG_ENABLE
 static Std_ReturnType lcd_send_4bits(const lcd_4bit_t* _lcd, uint8_t data_command) {
     Std_ReturnType ret = E_OK;
-    Std_ReturnType ret_0 = gpio_pin_write_logic(&(_lcd->lcd_data_pins[0]), 
-                                                 (data_command >> 0) & BIT_MASK);
-    Std_ReturnType ret_1 = gpio_pin_write_logic(&(_lcd->lcd_data_pins[1]), 
-                                                 (data_command >> 1) & BIT_MASK);
-    
-    Std_ReturnType ret_2 = gpio_pin_write_logic(&(_lcd->lcd_data_pins[2]), 
-                                                 (data_command >> 2) & BIT_MASK);
-    
-    Std_ReturnType ret_3 = gpio_pin_write_logic(&(_lcd->lcd_data_pins[3]), 
-                                                 (data_command >> 3) & BIT_MASK);
-    ret = ((ret_0) & (ret_1) & (ret_2) & (ret_3));
+    ret = gpio_group_write(&(_lcd->lcd_data_group), data_command & 0x0F);
     return ret;
 }
 #endif
@@ -577,7 +708,12 @@ static Std_ReturnType lcd_send_4bits(const lcd_4bit_t* _lcd, uint8_t data_comman
 static Std_ReturnType lcd_4bit_send_enable_signal(const lcd_4bit_t* _lcd){
     Std_ReturnType ret = E_OK;
     ret = gpio_pin_write_logic(&(_lcd->lcd_en_pin), GPIO_HIGH);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+    /* The execution wait is on the busy deadline. The pulse needs 450 ns,
+     * the return of this write and the call of the next one take longer */
+#else
     __delay_us(5);
+#endif
     ret = gpio_pin_write_logic(&(_lcd->lcd_en_pin), GPIO_LOW);
     
     return ret;
@@ -593,9 +729,93 @@ static Std_ReturnType lcd_4bit_send_enable_signal(const lcd_4bit_t* _lcd){
 static Std_ReturnType lcd_8bit_send_enable_signal(const lcd_8bit_t* _lcd){
     Std_ReturnType ret = E_OK;
     ret = gpio_pin_write_logic(&(_lcd->lcd_en_pin), GPIO_HIGH);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+    /* The execution wait is on the busy deadline. The pulse needs 450 ns,
+     * the return of this write and the call of the next one take longer */
+#else
     __delay_us(5);
+#endif
     ret = gpio_pin_write_logic(&(_lcd->lcd_en_pin), GPIO_LOW);
     
     return ret;
 }
-#endif
\ No newline at end of file
+#endif
+
+/**
+ * @brief : The initialization steps of an LCD connected in 4-Bit mode,
+ *          returns (DEADLINE_TASK_PENDING) at every wait.
+ * @param _lcd : A pointer to an LCD object
+ * @param ret : Collects the status of the steps run.
+ * @return (DEADLINE_TASK_DONE) once the LCD is initialized.
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+static uint8_t lcd_4bit_initialize_steps(lcd_4bit_t* _lcd, Std_ReturnType *ret){
+    deadline_task_t *l_task = &(_lcd->lcd_init_task);
+    DEADLINE_TASK_BEGIN(l_task);
+    *ret |= deadline_start_us(&(_lcd->lcd_busy_deadline), 0UL);
+    *ret |= gpio_pin_initialize(&(_lcd->lcd_rs_pin));
+    *ret |= gpio_pin_initialize(&(_lcd->lcd_en_pin));
+    *ret |= gpio_init_table(_lcd->lcd_data_pins, LCD_4BITS);
+    *ret |= gpio_group_init(&(_lcd->lcd_data_group), _lcd->lcd_data_pins, LCD_4BITS);
+    DEADLINE_TASK_DELAY_US(l_task, LCD_POWER_ON_US);
+    *ret |= lcd_4bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
+    DEADLINE_TASK_DELAY_US(l_task, LCD_INIT_SECOND_US);
+    *ret |= lcd_4bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
+    DEADLINE_TASK_DELAY_US(l_task, LCD_INIT_THIRD_US);
+    *ret |= lcd_4bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
+    for(l_task->index = ZERO_INIT; l_task->index < sizeof(lcd_4bit_init_commands); l_task->index++){
+        /* The clear and the return home take 1.52 ms, yield meanwhile */
+        DEADLINE_TASK_WAIT_UNTIL(l_task, deadline_expired(&(_lcd->lcd_busy_deadline)));
+        *ret |= lcd_4bit_send_command(_lcd, lcd_4bit_init_commands[l_task->index]);
+    }
+    DEADLINE_TASK_END(l_task);
+}
+#endif
+
+/**
+ * @brief : The initialization steps of an LCD connected in 8-Bit mode,
+ *          returns (DEADLINE_TASK_PENDING) at every wait.
+ * @param _lcd : A pointer to an LCD object
+ * @param ret : Collects the status of the steps run.
+ * @return (DEADLINE_TASK_DONE) once the LCD is initialized.
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+static uint8_t lcd_8bit_initialize_steps(lcd_8bit_t* _lcd, Std_ReturnType *ret){
+    deadline_task_t *l_task = &(_lcd->lcd_init_task);
+    DEADLINE_TASK_BEGIN(l_task);
+    *ret |= deadline_start_us(&(_lcd->lcd_busy_deadline), 0UL);
+    *ret |= gpio_pin_initialize(&(_lcd->lcd_rs_pin));
+    *ret |= gpio_pin_initialize(&(_lcd->lcd_en_pin));
+    *ret |= gpio_init_table(_lcd->lcd_data_pins, LCD_8BITS);
+    *ret |= gpio_group_init(&(_lcd->lcd_data_group), _lcd->lcd_data_pins, LCD_8BITS);
+    DEADLINE_TASK_DELAY_US(l_task, LCD_POWER_ON_US);
+    *ret |= lcd_8bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
+    DEADLINE_TASK_DELAY_US(l_task, LCD_INIT_SECOND_US);
+    *ret |= lcd_8bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
+    DEADLINE_TASK_DELAY_US(l_task, LCD_INIT_THIRD_US);
+    *ret |= lcd_8bit_send_command(_lcd, LCD_8BIT_MODE_2_LINE);
+    for(l_task->index = ZERO_INIT; l_task->index < sizeof(lcd_8bit_init_commands); l_task->index++){
+        /* The clear and the return home take 1.52 ms, yield meanwhile */
+        DEADLINE_TASK_WAIT_UNTIL(l_task, deadline_expired(&(_lcd->lcd_busy_deadline)));
+        *ret |= lcd_8bit_send_command(_lcd, lcd_8bit_init_commands[l_task->index]);
+    }
+    DEADLINE_TASK_END(l_task);
+}
+#endif
+
+/**
+ * @brief : Starts the execution time of the byte just sent,
+ *          the clear display and the return home are the long ones.
+ * @param busy : The busy deadline of the LCD.
+ * @param command : The command sent (LCD_DDRAM_START for a data byte).
+ */
+#if (LCD_CONFIGURATION==CONFIG_ENABLE) && (LCD_DEADLINE_FEATURE==CONFIG_ENABLE)
+static void lcd_set_busy(deadline_t *busy, uint8_t command){
+    if(command <= (LCD_RETURN_HOME | LCD_CLEAR)){
+        (void)deadline_start_us(busy, LCD_CLEAR_HOME_EXECUTION_US);
+    }
+    else {
+        (void)deadline_start_us(busy, LCD_EXECUTION_US);
+    }
+}
+#endif
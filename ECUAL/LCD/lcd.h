@@ -11,6 +11,9 @@
 /* Section : Includes */
 #include "../../MCAL/DIO/DIO.h"
 #include "lcd_cfg.h"
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+#include "../../MCAL/DEADLINE/deadline.h"
+#endif
 
 /* Section: Macro Declarations */
 #define LCD_CLEAR                       0x01
@@ -33,6 +36,16 @@
 #define ROW3                            3
 #define ROW4                            4
 
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+/* The execution times of the HD44780 (37 us, 1.52 ms) with a margin */
+#define LCD_EXECUTION_US                50UL
+#define LCD_CLEAR_HOME_EXECUTION_US     2000UL
+/* The power on wait and the waits of the init sequence */
+#define LCD_POWER_ON_US                 20000UL
+#define LCD_INIT_SECOND_US              5000UL
+#define LCD_INIT_THIRD_US               150UL
+#endif
+
 /* Section: Data Type Declarations */
 
 /*
@@ -59,7 +72,25 @@ typedef struct
      * @ref pin_config_t
      */
     pin_config_t lcd_data_pins[LCD_4BITS];  // Data pins     
-    
+    /*
+     * The data pins as one pin group, filled 
+     * by lcd_4bit_initialize().
+     * @ref gpio_group_t
+     */
+    gpio_group_t lcd_data_group;
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+    /*
+     * The state of lcd_4bit_initialize_task().
+     * @ref deadline_task_t
+     */
+    deadline_task_t lcd_init_task;
+    /*
+     * The end of the execution of the last byte
+     * sent to this LCD.
+     * @ref deadline_t
+     */
+    deadline_t lcd_busy_deadline;
+#endif
 } lcd_4bit_t;
 
 /*
@@ -86,6 +117,25 @@ typedef struct
      * @ref pin_config_t
      */
     pin_config_t lcd_data_pins[LCD_8BITS];  // Data pins      
+    /*
+     * The data pins as one pin group, filled 
+     * by lcd_8bit_initialize().
+     * @ref gpio_group_t
+     */
+    gpio_group_t lcd_data_group;
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+    /*
+     * The state of lcd_8bit_initialize_task().
+     * @ref deadline_task_t
+     */
+    deadline_task_t lcd_init_task;
+    /*
+     * The end of the execution of the last byte
+     * sent to this LCD.
+     * @ref deadline_t
+     */
+    deadline_t lcd_busy_deadline;
+#endif
 } lcd_8bit_t;
 
 /* Section: Function Declarations */
@@ -97,7 +147,30 @@ typedef struct
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_initialize(const lcd_4bit_t* _lcd);
+Std_ReturnType lcd_4bit_initialize(lcd_4bit_t* _lcd);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+/*
+ * @brief : A software interface runs one step of the initialization of an LCD
+ *          connected in 4-Bit mode, call it from the main loop until (done),
+ *          the waits return instead of spinning.
+ * @param _lcd : A pointer to an LCD object
+ * @param done : (STD_TRUE) once the LCD is initialized, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType lcd_4bit_initialize_task(lcd_4bit_t* _lcd, uint8_t *done);
+/*
+ * @brief : A software interface checks an LCD connected in 4-Bit mode
+ *          executed the last byte sent, the next send doesn't wait then.
+ * @param _lcd : A pointer to an LCD object
+ * @param ready : (STD_TRUE) when the LCD takes a byte now, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType lcd_4bit_is_ready(const lcd_4bit_t* _lcd, uint8_t *ready);
+#endif
 /* @brief : A software interface sends command to 
  *          an LCD connected in 4-Bit mode. 
  * @param (_lcd) : A pointer to an LCD object
@@ -106,7 +179,7 @@ Std_ReturnType lcd_4bit_initialize(const lcd_4bit_t* _lcd);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_send_command(const lcd_4bit_t* _lcd, uint8_t command);
+Std_ReturnType lcd_4bit_send_command(lcd_4bit_t* _lcd, uint8_t command);
 /**
  * @brief : A software interface sends one char to
  *          an LCD connected in 4-Bit mode. 
@@ -116,7 +189,7 @@ Std_ReturnType lcd_4bit_send_command(const lcd_4bit_t* _lcd, uint8_t command);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data);
+Std_ReturnType lcd_4bit_send_char_data(lcd_4bit_t* _lcd, uint8_t data);
 /**
  * @brief : A software interface sends one char to a certain position in
  *          an LCD connected in 4-Bit mode. 
@@ -128,7 +201,7 @@ Std_ReturnType lcd_4bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_send_char_data_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_4bit_send_char_data_pos(lcd_4bit_t* _lcd, 
                                            uint8_t row, uint8_t column, uint8_t data);
 /**
  * @brief : A software interface sends a string to
@@ -139,7 +212,7 @@ Std_ReturnType lcd_4bit_send_char_data_pos(const lcd_4bit_t* _lcd,
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str);
+Std_ReturnType lcd_4bit_send_string(lcd_4bit_t* _lcd, uint8_t* str);
 /**
  * @brief : A software interface sends a string to a certain position in
  *          an LCD connected in 4-Bit mode. 
@@ -151,7 +224,7 @@ Std_ReturnType lcd_4bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_send_string_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_4bit_send_string_pos(lcd_4bit_t* _lcd, 
                                         uint8_t row, uint8_t column, uint8_t* str);
 /**
  * @brief : A software interface sends a special character that doesn't have
@@ -165,7 +238,7 @@ Std_ReturnType lcd_4bit_send_string_pos(const lcd_4bit_t* _lcd,
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_send_custom_char(const lcd_4bit_t* _lcd,
+Std_ReturnType lcd_4bit_send_custom_char(lcd_4bit_t* _lcd,
                                          uint8_t row, uint8_t column, 
                                          const uint8_t _char[], uint8_t memory_pos);
 /**
@@ -179,7 +252,7 @@ Std_ReturnType lcd_4bit_send_custom_char(const lcd_4bit_t* _lcd,
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t* _lcd, uint8_t row, uint8_t column);
+Std_ReturnType lcd_4bit_set_cursor(lcd_4bit_t* _lcd, uint8_t row, uint8_t column);
 /**
  * @brief : A software interface initializes an LCD connected in 8-Bit mode.
  * @param _lcd : A pointer to an LCD object
@@ -187,7 +260,30 @@ Std_ReturnType lcd_4bit_set_cursor(const lcd_4bit_t* _lcd, uint8_t row, uint8_t
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_8bit_initialize(const lcd_4bit_t* _lcd);
+Std_ReturnType lcd_8bit_initialize(lcd_8bit_t* _lcd);
+#if LCD_DEADLINE_FEATURE==CONFIG_ENABLE
+/*
+ * @brief : A software interface runs one step of the initialization of an LCD
+ *          connected in 8-Bit mode, call it from the main loop until (done),
+ *          the waits return instead of spinning.
+ * @param _lcd : A pointer to an LCD object
+ * @param done : (STD_TRUE) once the LCD is initialized, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType lcd_8bit_initialize_task(lcd_8bit_t* _lcd, uint8_t *done);
+/*
+ * @brief : A software interface checks an LCD connected in 8-Bit mode
+ *          executed the last byte sent, the next send doesn't wait then.
+ * @param _lcd : A pointer to an LCD object
+ * @param ready : (STD_TRUE) when the LCD takes a byte now, (STD_FALSE) meanwhile.
+ * @return : Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType lcd_8bit_is_ready(const lcd_8bit_t* _lcd, uint8_t *ready);
+#endif
 /**
  * @brief : A software interface sends command to 
  *          an LCD connected in 8-Bit mode. 
@@ -197,7 +293,7 @@ Std_ReturnType lcd_8bit_initialize(const lcd_4bit_t* _lcd);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_8bit_send_command(const lcd_4bit_t* _lcd, uint8_t command);
+Std_ReturnType lcd_8bit_send_command(lcd_8bit_t* _lcd, uint8_t command);
 /**
  * @brief : A software interface sends one char to
  *          an LCD connected in 8-Bit mode.
@@ -207,17 +303,17 @@ Std_ReturnType lcd_8bit_send_command(const lcd_4bit_t* _lcd, uint8_t command);
  *          (E_OK) : The function done successfully
  *          (E_NOT_OK) : The function has issue to perform this action
  */
-Std_ReturnType lcd_8bit_send_char_data(const lcd_4bit_t* _lcd, uint8_t data);
+Std_ReturnType lcd_8bit_send_char_data(lcd_8bit_t* _lcd, uint8_t data);
 
-Std_ReturnType lcd_8bit_send_char_data_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_8bit_send_char_data_pos(lcd_8bit_t* _lcd, 
                                            uint8_t row, uint8_t column, uint8_t data);
-Std_ReturnType lcd_8bit_send_string(const lcd_4bit_t* _lcd, uint8_t* str);
-Std_ReturnType lcd_8bit_send_string_pos(const lcd_4bit_t* _lcd, 
+Std_ReturnType lcd_8bit_send_string(lcd_8bit_t* _lcd, uint8_t* str);
+Std_ReturnType lcd_8bit_send_string_pos(lcd_8bit_t* _lcd, 
                                         uint8_t row, uint8_t column, uint8_t* str);
-Std_ReturnType lcd_8bit_send_custom_char(const lcd_4bit_t* _lcd,
+Std_ReturnType lcd_8bit_send_custom_char(lcd_8bit_t* _lcd,
                                          uint8_t row, uint8_t column, 
                                          const uint8_t _char[], uint8_t memory_pos);
-Std_ReturnType lcd_8bit_set_cursor(const lcd_8bit_t* _lcd, uint8_t row, uint8_t column);
+Std_ReturnType lcd_8bit_set_cursor(lcd_8bit_t* _lcd, uint8_t row, uint8_t column);
 
 Std_ReturnType convert_uint8_to_string(uint8_t value, uint8_t* str);
 Std_ReturnType convert_uint16_to_string(uint16_t value, uint8_t* str);
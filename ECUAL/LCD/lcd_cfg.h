@@ -13,4 +13,16 @@
 
 #define LCD_CONFIGURATION       CONFIG_ENABLE
 
+/*
+ * The LCD waits on deadlines (MCAL/DEADLINE) instead of __delay_ms/__delay_us :
+ * the init can run as a resumable task from the main loop and a byte waits
+ * only for what is left of the execution of the last one.
+ * (It takes TIMER1 : the monotonic clock must be started before the LCD
+ *  init, the init returns E_NOT_OK otherwise. CONFIG_DISABLE keeps the
+ *  busy waits)
+ */
+#ifndef LCD_DEADLINE_FEATURE
+#define LCD_DEADLINE_FEATURE    CONFIG_DISABLE
+#endif
+
 #endif	/* LCD_CFG_H */
\ No newline at end of file
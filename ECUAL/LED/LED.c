@@ -49,8 +49,13 @@ Std_ReturnType led_turn_ON(const led_t* led){
         pin_config_t led_pin_config = {.port = led->port, .pin = led->pin, 
                                     .direction = GPIO_DIRECTION_OUTPUT, .logic = led->led_status};
         
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        /* The pin changes with the other outputs on the next gpio_commit() */
+        ret = gpio_shadow_pin_write_logic(&led_pin_config, GPIO_HIGH);
+#else
         ret = gpio_pin_initialize(&led_pin_config);
         ret = gpio_pin_write_logic(&led_pin_config, GPIO_HIGH);
+#endif
     }
     return ret;  
 }
@@ -71,8 +76,13 @@ Std_ReturnType led_turn_OFF(const led_t* led){
         pin_config_t led_pin_config = {.port = led->port, .pin = led->pin, 
                                     .direction = GPIO_DIRECTION_OUTPUT, .logic = led->led_status};
         
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        /* The pin changes with the other outputs on the next gpio_commit() */
+        ret = gpio_shadow_pin_write_logic(&led_pin_config, GPIO_LOW);
+#else
         ret = gpio_pin_initialize(&led_pin_config);
         ret = gpio_pin_write_logic(&led_pin_config, GPIO_LOW);
+#endif
     }
     return ret;
 }
@@ -92,7 +102,11 @@ Std_ReturnType led_TOGGLE(const led_t* led){
     else{
         pin_config_t led_pin_config = {.port = led->port, .pin = led->pin, 
                                     .direction = GPIO_DIRECTION_OUTPUT, .logic = led->led_status};
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        ret = gpio_shadow_pin_toggle_logic(&led_pin_config);
+#else
         ret = gpio_pin_toggle_logic(&led_pin_config);
+#endif
     }
     return ret;
 }
@@ -55,7 +55,11 @@ Std_ReturnType relay_turn_on(relay_t* _relay){
             .logic     = _relay->relay_status,
             .direction = GPIO_DIRECTION_OUTPUT
         };
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        ret = gpio_shadow_pin_write_logic(&relay_config, GPIO_HIGH);
+#else
         ret = gpio_pin_write_logic(&relay_config, GPIO_HIGH);
+#endif
     }
     return ret; 
 }
@@ -80,7 +84,11 @@ Std_ReturnType relay_turn_off(relay_t* _relay){
             .logic     = _relay->relay_status,
             .direction = GPIO_DIRECTION_OUTPUT
         };
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+        ret = gpio_shadow_pin_write_logic(&relay_config, GPIO_LOW);
+#else
         ret = gpio_pin_write_logic(&relay_config, GPIO_LOW);
+#endif
     }
     return ret; 
 }
\ No newline at end of file
@@ -0,0 +1,333 @@
+/*
+ * File:   multi_servo.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "multi_servo.h"
+#include "../../MCAL/Interrupt/CRITICAL_section/MCAL_critical_section.h"
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+/* --------------- Section: Macro Declarations --------------- */
+#define MULTI_SERVO_MIN_GAP_TICKS           MULTI_SERVO_US_TO_TICKS(MULTI_SERVO_MIN_GAP_US)
+
+/* The frame is stepped on the 16-bit compare timer */
+TIMER_SOLVER_STATIC_ASSERT(MULTI_SERVO_FRAME_TICKS < 65536UL, multi_servo_frame_fits_the_timer);
+
+/* --------------- Section: Data Type Declarations --------------- */
+/*
+ * The pulse ends of one frame : event (e) is at event_ticks[e] from the
+ * frame start and lowers the servos order[event_end[e - 1]] --> order[event_end[e] - 1],
+ * servo order[i] at order_ticks[i] (its pulse when the schedule was built).
+ */
+typedef struct {
+    multi_servo_t *order[MULTI_SERVO_MAX_SERVOS];
+    uint16_t order_ticks[MULTI_SERVO_MAX_SERVOS];
+    uint16_t event_ticks[MULTI_SERVO_MAX_SERVOS];
+    uint8_t event_end[MULTI_SERVO_MAX_SERVOS];
+    uint8_t servos_number;
+    uint8_t events_number;
+} multi_servo_schedule_t;
+
+/* --------------- Section : Global Variables --------------- */
+static multi_servo_t *multi_servo_servos[MULTI_SERVO_MAX_SERVOS];
+static uint8_t multi_servo_servos_number = ZERO_INIT;
+
+/* The schedule of the ISR and the one built by the main loop */
+static multi_servo_schedule_t multi_servo_schedules[2];
+static volatile uint8_t multi_servo_active = ZERO_INIT;
+static volatile uint8_t multi_servo_pending = STD_LOW;
+
+/* The ISR state : the next event of the active schedule and the matches */
+static uint8_t multi_servo_event = ZERO_INIT;
+static uint16_t multi_servo_frame_start = ZERO_INIT;
+static uint16_t multi_servo_match = ZERO_INIT;
+/* The ticks from the frame match to the rise, the pins fall as late after their ends */
+static uint16_t multi_servo_latency = ZERO_INIT;
+static volatile uint32_t multi_servo_frames = ZERO_INIT;
+static ccp_t multi_servo_ccp;
+/* The compare timer of the module is timer 3 (else timer 1) */
+static uint8_t multi_servo_on_timer3 = STD_FALSE;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void multi_servo_ccp_handler(void);
+static void multi_servo_build(void);
+static interrupt_source_t multi_servo_source(void);
+static uint16_t multi_servo_timer_read(void);
+static Std_ReturnType multi_servo_find(const multi_servo_t *_servo);
+
+/*---------------  Section: Function Definitions --------------- */
+Std_ReturnType multi_servo_init(const ccp_t *_ccp)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _ccp) || (_ccp->ccp_module_select > CCP2_MODULE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 1. Stop the frames while the servos are removed */
+        if(CCP1_MODULE == _ccp->ccp_module_select)
+            { INTI_CCP1_INTERRRUPT_DISABLE(); }
+        else
+            { INTI_CCP2_INTERRRUPT_DISABLE(); }
+        multi_servo_servos_number = ZERO_INIT;
+        multi_servo_schedules[0].servos_number = ZERO_INIT;
+        multi_servo_schedules[0].events_number = ZERO_INIT;
+        multi_servo_active = ZERO_INIT;
+        multi_servo_pending = STD_LOW;
+        multi_servo_event = ZERO_INIT;
+        multi_servo_frames = ZERO_INIT;
+
+        /* 2. Software interrupt matches, the ISR drives the pins */
+        multi_servo_ccp = *_ccp;
+        multi_servo_ccp.ccp_mode = CCP_MODE_COMPARE;
+        multi_servo_ccp.ccp_compare_config = CCP_COMPARE_SW_INTERRUPT;
+        multi_servo_ccp.ccp_interrupt_handler = multi_servo_ccp_handler;
+        if(CCP1_MODULE == multi_servo_ccp.ccp_module_select)
+            { multi_servo_on_timer3 = (CCP1_CCP2_TMR3 == multi_servo_ccp.ccp_compare_timer) ? STD_TRUE : STD_FALSE; }
+        else
+            { multi_servo_on_timer3 = (CCP1_CCP2_TMR1 != multi_servo_ccp.ccp_compare_timer) ? STD_TRUE : STD_FALSE; }
+
+        /* 3. The first frame starts when the free running timer passes 0 */
+        multi_servo_frame_start = ZERO_INIT;
+        multi_servo_match = ZERO_INIT;
+        ret = CCP_Compare_SetValue(&multi_servo_ccp, multi_servo_match);
+        ret |= CCP_Init(&multi_servo_ccp);
+    }
+    return ret;
+}
+
+Std_ReturnType multi_servo_add(multi_servo_t *_servo)
+{
+    Std_ReturnType ret = E_OK;
+    /* A pulse shorter than the gap would end in the routine of the frame start */
+    if((NULL == _servo) || (_servo->min_pulse_us < MULTI_SERVO_MIN_GAP_US) || (_servo->min_pulse_us > _servo->max_pulse_us)
+                        || (_servo->max_pulse_us > MULTI_SERVO_MAX_PULSE_US)
+                        || (E_OK == multi_servo_find(_servo))
+                        || (multi_servo_servos_number >= MULTI_SERVO_MAX_SERVOS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Off until its first pulse, only the ISR writes the pin after */
+        _servo->pulse_ticks = ZERO_INIT;
+        _servo->pin.direction = GPIO_DIRECTION_OUTPUT;
+        _servo->pin.logic = GPIO_LOW;
+        ret = gpio_pin_initialize(&(_servo->pin));
+        multi_servo_servos[multi_servo_servos_number] = _servo;
+        multi_servo_servos_number++;
+    }
+    return ret;
+}
+
+Std_ReturnType multi_servo_set_us(multi_servo_t *_servo, uint16_t pulse_us)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _servo) || (pulse_us < _servo->min_pulse_us) || (pulse_us > _servo->max_pulse_us)
+                        || (E_OK != multi_servo_find(_servo)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _servo->pulse_ticks = MULTI_SERVO_US_TO_TICKS(pulse_us);
+        multi_servo_build();
+    }
+    return ret;
+}
+
+Std_ReturnType multi_servo_set_angle(multi_servo_t *_servo, uint8_t angle)
+{
+    Std_ReturnType ret = E_OK;
+    uint16_t l_pulse_us = ZERO_INIT;
+    if((NULL == _servo) || (angle > 180U))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* Integer map of 0 --> 180 degrees on the pulse range, rounded */
+        l_pulse_us = (uint16_t)(_servo->min_pulse_us
+                   + ((((uint32_t)angle * (uint16_t)(_servo->max_pulse_us - _servo->min_pulse_us)) + 90UL) / 180UL));
+        ret = multi_servo_set_us(_servo, l_pulse_us);
+    }
+    return ret;
+}
+
+Std_ReturnType multi_servo_off(multi_servo_t *_servo)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _servo) || (E_OK != multi_servo_find(_servo)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _servo->pulse_ticks = ZERO_INIT;
+        multi_servo_build();
+    }
+    return ret;
+}
+
+uint32_t multi_servo_get_frames(void)
+{
+    uint32_t l_frames = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(multi_servo_source());
+    l_frames = multi_servo_frames;
+    Critical_Section_Unmask_Source(multi_servo_source(), l_critical_state);
+    return l_frames;
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+/**
+ * @brief : The ccp compare interrupt handler, a frame start or a pulse end.
+ */
+static void multi_servo_ccp_handler(void)
+{
+    multi_servo_schedule_t *l_schedule = &multi_servo_schedules[multi_servo_active];
+    uint8_t l_index = ZERO_INIT;
+    uint16_t l_fall = ZERO_INIT;
+    if(multi_servo_event >= l_schedule->events_number)
+    {
+        /* 1. A frame start : take the new schedule and raise its pins */
+        multi_servo_frame_start = multi_servo_match;
+        multi_servo_frames++;
+        if(STD_HIGH == multi_servo_pending)
+        {
+            multi_servo_active ^= 1U;
+            multi_servo_pending = STD_LOW;
+            l_schedule = &multi_servo_schedules[multi_servo_active];
+        }
+        else
+            { /* Nothing */ }
+        /* The pins fall as late after their ends as they rise after the match */
+        multi_servo_latency = (uint16_t)(multi_servo_timer_read() - multi_servo_frame_start);
+        /* The pins rise in the order they fall, the skews cancel out */
+        for(l_index = ZERO_INIT; l_index < l_schedule->servos_number; l_index++)
+        {
+            (void)gpio_pin_write_logic(&(l_schedule->order[l_index]->pin), GPIO_HIGH);
+        }
+        multi_servo_event = ZERO_INIT;
+    }
+    else
+    {
+        /* 2. A pulse end : lower the pins of the event, every one at its own
+         *    end (a short spin for the ends merged behind the first one) */
+        l_index = (ZERO_INIT == multi_servo_event) ? ZERO_INIT : l_schedule->event_end[multi_servo_event - 1U];
+        for(; l_index < l_schedule->event_end[multi_servo_event]; l_index++)
+        {
+            l_fall = (uint16_t)(multi_servo_frame_start + l_schedule->order_ticks[l_index] + multi_servo_latency);
+            while((int16_t)(multi_servo_timer_read() - l_fall) < 0)
+                { /* Nothing */ }
+            (void)gpio_pin_write_logic(&(l_schedule->order[l_index]->pin), GPIO_LOW);
+        }
+        multi_servo_event++;
+    }
+
+    /* 3. The next match, stepped from the frame start (no drift) */
+    if(multi_servo_event < l_schedule->events_number)
+    {
+        multi_servo_match = (uint16_t)(multi_servo_frame_start + l_schedule->event_ticks[multi_servo_event]);
+    }
+    else
+    {
+        multi_servo_match = (uint16_t)(multi_servo_frame_start + (uint16_t)MULTI_SERVO_FRAME_TICKS);
+    }
+    (void)CCP_Compare_SetValue(&multi_servo_ccp, multi_servo_match);
+}
+
+/**
+ * @brief : Sorts the servos by pulse into the schedule the ISR doesn't use,
+ *          the ISR takes it at the next frame start.
+ */
+static void multi_servo_build(void)
+{
+    multi_servo_schedule_t *l_schedule = NULL;
+    multi_servo_t *l_servo = NULL;
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_position = ZERO_INIT;
+    uint16_t l_previous_ticks = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(multi_servo_source());
+    /* The ISR keeps its schedule while this one is built */
+    multi_servo_pending = STD_LOW;
+    l_schedule = &multi_servo_schedules[multi_servo_active ^ 1U];
+    Critical_Section_Unmask_Source(multi_servo_source(), l_critical_state);
+
+    /* 1. Insertion sort of the running servos, the shortest pulse first */
+    l_schedule->servos_number = ZERO_INIT;
+    for(l_index = ZERO_INIT; l_index < multi_servo_servos_number; l_index++)
+    {
+        l_servo = multi_servo_servos[l_index];
+        if(ZERO_INIT != l_servo->pulse_ticks)
+        {
+            l_position = l_schedule->servos_number;
+            while((l_position > ZERO_INIT) && (l_schedule->order_ticks[l_position - 1U] > l_servo->pulse_ticks))
+            {
+                l_schedule->order[l_position] = l_schedule->order[l_position - 1U];
+                l_schedule->order_ticks[l_position] = l_schedule->order_ticks[l_position - 1U];
+                l_position--;
+            }
+            l_schedule->order[l_position] = l_servo;
+            l_schedule->order_ticks[l_position] = l_servo->pulse_ticks;
+            l_schedule->servos_number++;
+        }
+        else
+            { /* Nothing */ }
+    }
+
+    /* 2. One event for the pulse ends closer than the minimum gap to the
+     *    previous one : the next match stays a gap past the spin */
+    l_schedule->events_number = ZERO_INIT;
+    for(l_index = ZERO_INIT; l_index < l_schedule->servos_number; l_index++)
+    {
+        if((ZERO_INIT == l_schedule->events_number)
+        || (l_schedule->order_ticks[l_index] > (uint16_t)(l_previous_ticks + MULTI_SERVO_MIN_GAP_TICKS)))
+        {
+            l_schedule->event_ticks[l_schedule->events_number] = l_schedule->order_ticks[l_index];
+            l_schedule->events_number++;
+        }
+        else
+            { /* Nothing */ }
+        l_previous_ticks = l_schedule->order_ticks[l_index];
+        l_schedule->event_end[l_schedule->events_number - 1U] = (uint8_t)(l_index + 1U);
+    }
+
+    l_critical_state = Critical_Section_Mask_Source(multi_servo_source());
+    multi_servo_pending = STD_HIGH;
+    Critical_Section_Unmask_Source(multi_servo_source(), l_critical_state);
+}
+
+static interrupt_source_t multi_servo_source(void)
+{
+    return (CCP1_MODULE == multi_servo_ccp.ccp_module_select) ? INTERRUPT_SOURCE_CCP1 : INTERRUPT_SOURCE_CCP2;
+}
+
+/**
+ * @brief : Reads the compare timer of the channel (the spin of the merged ends).
+ */
+static uint16_t multi_servo_timer_read(void)
+{
+    return (STD_TRUE == multi_servo_on_timer3) ? (uint16_t)TMR3_READ() : (uint16_t)TMR1_READ();
+}
+
+/**
+ * @brief : Checks a servo was added.
+ * @return (E_OK) : The servo was added.
+ */
+static Std_ReturnType multi_servo_find(const multi_servo_t *_servo)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8_t l_index = ZERO_INIT;
+    for(l_index = ZERO_INIT; l_index < multi_servo_servos_number; l_index++)
+    {
+        if(_servo == multi_servo_servos[l_index])
+            { ret = E_OK; }
+        else
+            { /* Nothing */ }
+    }
+    return ret;
+}
+#endif
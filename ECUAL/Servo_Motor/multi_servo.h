@@ -0,0 +1,153 @@
+/*
+ * File:   multi_servo.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> Up to 8 servos on one CCP compare channel <--
+ *
+ * Every frame (20 ms) the CCP compare interrupt raises the pins of all
+ * the servos together, then lowers them in the order of their pulses :
+ * the main loop keeps the servos sorted by pulse, the ISR walks the
+ * sorted schedule (one interrupt a pulse end, plus one a frame).
+ * The pulse ends closer than MULTI_SERVO_MIN_GAP_US share one interrupt,
+ * it spins on the compare timer to lower every pin at its own end : the
+ * pins fall as late after their ends as they rose after the frame match.
+ *
+ *      multi_servo_t pan = {
+ *          .pin = {.port = PORTD_INDEX, .pin = PIN0_INDEX, .direction = GPIO_DIRECTION_OUTPUT},
+ *          .min_pulse_us = 1000, .max_pulse_us = 2000 };
+ *      ccp_t servo_ccp = {
+ *          .ccp_module_select = CCP1_MODULE,
+ *          .ccp_compare_timer = CCP1_CCP2_TMR3, ... };
+ *      timer3_init(&servo_timer);                  (free running, MULTI_SERVO_TIMER_PRESCALER)
+ *      multi_servo_init(&servo_ccp);
+ *      multi_servo_add(&pan);
+ *      multi_servo_set_angle(&pan, 90);
+ *
+ * The compare timer runs free (no preloaded value, nothing resets it),
+ * the matches are stepped from the last one so the frame doesn't drift.
+ * A new pulse is taken at the next frame start, the current frame ends
+ * with the old pulses.
+ */
+
+#ifndef MULTI_SERVO_H
+#define	MULTI_SERVO_H
+
+/* --------------- Section : Includes --------------- */
+#include "../../MCAL/CCP/ccp.h"
+#include "../../MCAL/TIMER_SOLVER/timer_solver.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The servos of one channel */
+#ifndef MULTI_SERVO_MAX_SERVOS
+#define MULTI_SERVO_MAX_SERVOS              8U
+#endif
+
+#define MULTI_SERVO_FRAME_US                20000UL
+/* The widest pulse a servo accepts */
+#define MULTI_SERVO_MAX_PULSE_US            2500U
+
+/* The prescaler ratio of the compare timer (1, 2, 4 or 8) */
+#define MULTI_SERVO_TIMER_PRESCALER         1UL
+#define MULTI_SERVO_TICKS_PER_MS            (_XTAL_FREQ / 4000UL / MULTI_SERVO_TIMER_PRESCALER)
+#define MULTI_SERVO_FRAME_TICKS             ((MULTI_SERVO_FRAME_US * MULTI_SERVO_TICKS_PER_MS) / 1000UL)
+
+/*
+ * The pulse ends closer than this to the previous one share its interrupt
+ * (the ISR spins to each of them), it covers the ISR, an end can't be
+ * programmed behind the timer. It is the shortest min_pulse_us too, a
+ * shorter pulse would end in the ISR of the frame start.
+ */
+#define MULTI_SERVO_MIN_GAP_US              20U
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+#define MULTI_SERVO_US_TO_TICKS(_US_)       ((uint16_t)((((uint32_t)(_US_) * MULTI_SERVO_TICKS_PER_MS) + 500UL) / 1000UL))
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef struct {
+    /*
+     * The output pin of the servo.
+     */
+    pin_config_t pin;
+    /*
+     * The pulses of 0 and 180 degrees (MULTI_SERVO_MIN_GAP_US --> MULTI_SERVO_MAX_PULSE_US).
+     */
+    uint16_t min_pulse_us;
+    uint16_t max_pulse_us;
+    /*
+     * Private, the pulse in compare timer ticks (0 : off, the pin stays low).
+     */
+    uint16_t pulse_ticks;
+} multi_servo_t;
+
+/*---------------  Section: Function Declarations --------------- */
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+/**
+ *
+ * @Brief  A software interface starts the frames on a ccp compare channel,
+ *         the servos added before are removed.
+ * @param _ccp : A pointer to a ccp module object (module, compare timer and
+ *               priority), its mode, compare configuration and interrupt
+ *               handler are replaced by the driver.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType multi_servo_init(const ccp_t *_ccp);
+
+/**
+ *
+ * @Brief  A software interface adds a servo, it is off until its
+ *         first pulse is set.
+ * @param _servo : The servo, its pin and pulse range are set
+ *                 (MULTI_SERVO_MIN_GAP_US --> MULTI_SERVO_MAX_PULSE_US).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                       (bad servo, servo already added or the channel is full)
+ */
+Std_ReturnType multi_servo_add(multi_servo_t *_servo);
+
+/**
+ *
+ * @Brief  A software interface sets the pulse of a servo.
+ * @param _servo : An added servo.
+ * @param pulse_us : The pulse (min_pulse_us --> max_pulse_us).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType multi_servo_set_us(multi_servo_t *_servo, uint16_t pulse_us);
+
+/**
+ *
+ * @Brief  A software interface sets the angle of a servo,
+ *         mapped on its pulse range.
+ * @param _servo : An added servo.
+ * @param angle : The angle in degrees (0 --> 180).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType multi_servo_set_angle(multi_servo_t *_servo, uint8_t angle);
+
+/**
+ *
+ * @Brief  A software interface stops the pulses of a servo (the pin stays low).
+ * @param _servo : An added servo.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType multi_servo_off(multi_servo_t *_servo);
+
+/**
+ *
+ * @Brief  A software interface reads the frames started since multi_servo_init().
+ * @return The frames (wraps at 2^32).
+ */
+uint32_t multi_servo_get_frames(void);
+#endif
+
+#endif	/* MULTI_SERVO_H */
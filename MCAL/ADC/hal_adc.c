@@ -6,6 +6,10 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "hal_adc.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+#include "../Interrupt/EVENT_queue/MCAL_event_queue.h"
+#endif
 /* --------------- Section : Global Variables --------------- */
 #if ADC_INTERRUPT_FEATURE == INTERRUPT_ENABLE
 /*
@@ -14,6 +18,14 @@
  */
 static interrupt_handler_t ADC_interrupt_handler = NULL;
 #endif
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/* 
+ * The ADRESH:ADRESL value latched by the ISR, read by ADC_get_conversion_result()
+ * while the deferred handler runs (a new conversion may have overwritten ADRES).
+ */
+static uint16_t adc_deferred_value = ZERO_INIT;
+static uint8_t adc_deferred_value_valid = STD_FALSE;
+#endif
 /*---------------  Section: Helper Functions Declaration --------------- */
 
 /**
@@ -34,6 +46,14 @@ static void adc_set_result_format(const adc_cfg_t *_adc);
  * @param _adc : Pointer to the adc module object.
  */
 static void adc_set_voltage_ref(const adc_cfg_t *_adc);
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/**
+ * @brief The deferred part of the ADC interrupt,
+ * called by event_dispatch().
+ * @param payload : The ADRESH:ADRESL content at the interrupt.
+ */
+static void adc_deferred_handler(uint16_t payload);
+#endif
 /*---------------  Section: Functions Definition --------------- */
 
 /**
@@ -70,10 +90,6 @@ Std_ReturnType ADC_init(const adc_cfg_t *_adc)
         // Enable the Interrupt priority.
         INTERRUPT_PRIORITY_ENABLE();
 #endif
-        // Clear the ADC interrupt flag
-        INTI_ADC_CLR_FLAG();
-        // Enable the Interrupts for the ADC module
-        INTI_ADC_INTERRRUPT_ENABLE();
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
         // Assign the specified priority.
         if (PRIORITY_HIGH == _adc -> priority)
@@ -83,8 +99,16 @@ Std_ReturnType ADC_init(const adc_cfg_t *_adc)
         else
             { INTI_ADC_INTERRUPT_PRIORITY_HIGH(); }
 #endif
-        // Assign the Interrupt handler
+        // Assign the Interrupt handler, routed before the source is enabled
         ADC_interrupt_handler = _adc -> ADC_InterruptHandler;
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        event_register_handler(INTERRUPT_SOURCE_ADC, adc_deferred_handler);
+#endif
+        Interrupt_Manager_Register(INTERRUPT_SOURCE_ADC, INTI_ADC_ISR);
+        // Clear the ADC interrupt flag
+        INTI_ADC_CLR_FLAG();
+        // Enable the Interrupts for the ADC module
+        INTI_ADC_INTERRRUPT_ENABLE();
 #endif
         /* Configure Result Format */
         adc_set_result_format(_adc);
@@ -214,16 +238,27 @@ Std_ReturnType ADC_get_conversion_result(const adc_cfg_t *_adc, adc_result_t *re
     else
     {
         /* (ADRESH / ADRESL) */
+        uint16_t l_adres = ZERO_INIT;
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        if (STD_TRUE == adc_deferred_value_valid)
+        {
+            l_adres = adc_deferred_value;
+        }
+        else
+#endif
+        {
+            l_adres = (uint16_t)((ADRESH << 8) + ADRESL);
+        }
         switch (_adc->result_format)
         {
             case ADC_RESULT_RIGHT : 
-                *result = (adc_result_t)((ADRESH << 8) + ADRESL);
+                *result = (adc_result_t)l_adres;
                 break;
             case ADC_RESULT_LEFT :
-                *result = (adc_result_t)(((ADRESH << 8) + ADRESL) >> 6);
+                *result = (adc_result_t)(l_adres >> 6);
                 break;
             default:
-                *result = (adc_result_t)((ADRESH << 8) + ADRESL);
+                *result = (adc_result_t)l_adres;
                 break;
         }
     }
@@ -356,9 +391,27 @@ void INTI_ADC_ISR(void)
 {
     /* 1. Clear the interrupt flag */
     INTI_ADC_CLR_FLAG();
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* 2. Defer the call to the main loop */
+    event_post(INTERRUPT_SOURCE_ADC, (uint16_t)((ADRESH << 8) + ADRESL));
+#else
     /* 2. Call The ISR */
     if (ADC_interrupt_handler)
         { ADC_interrupt_handler(); }
     else
         { /* Nothing */ }
+#endif
 }
+
+#if ADC_DEFERRED_FEATURE==INTERRUPT_ENABLE
+static void adc_deferred_handler(uint16_t payload)
+{
+    adc_deferred_value = payload;
+    adc_deferred_value_valid = STD_TRUE;
+    if (ADC_interrupt_handler)
+        { ADC_interrupt_handler(); }
+    else
+        { /* Nothing */ }
+    adc_deferred_value_valid = STD_FALSE;
+}
+#endif
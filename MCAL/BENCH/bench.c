@@ -0,0 +1,274 @@
+/*
+ * File:   bench.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "bench.h"
+#include "../USART/usart.h"
+
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+/* --------------- Section : Global Variables --------------- */
+uint32_t bench_start_ticks[BENCH_REGIONS_NUMBER];
+
+static bench_region_t bench_regions[BENCH_REGIONS_NUMBER];
+static const uint8_t *bench_names[BENCH_REGIONS_NUMBER];
+/* The cycles of BENCH_BEGIN() + BENCH_END() around nothing */
+static uint32_t bench_overhead = ZERO_INIT;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static uint8_t bench_histogram_bin(uint32_t duration);
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ *
+ * @Brief : A software interface starts the monotonic clock at one tick
+ *          per instruction cycle, measures the cost of the time stamps
+ *          and clears the statistics of all the regions.
+ *          (TIMER1 belongs to the bench from now on)
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_init(void)
+{
+    Std_ReturnType ret = E_OK;
+    Timer1_t l_clock_timer = {
+        .TMR1_INTERRUPT_HANDLER = NULL,
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+        .priority = PRIORITY_LOW,
+#endif
+        .timer1_preloaded_value = ZERO_INIT,
+        .prescaler_value = TMR1_PRESCALAR_RATIO_1,
+        .timer1_mode = TMR1_TIMER_MODE,
+        .timer1_counter_synch_mode = TMR1_COUNTER_SYNCH,
+        .timer1_OSC_cfg = TMR1_OSC_DISABLE,
+        .timer1_rw_mode = TMR1_RW_REG_MODE_16BIT
+    };
+    uint8_t l_run = ZERO_INIT;
+    uint32_t l_duration = ZERO_INIT;
+
+    /* 1. One tick per instruction cycle */
+    ret = monotonic_clock_init(&l_clock_timer);
+
+    /* 2. The shortest empty region is the cost of the two time stamps */
+    bench_overhead = 0xFFFFFFFFUL;
+    for(l_run = ZERO_INIT; l_run < BENCH_CALIBRATION_RUNS; l_run++)
+    {
+        bench_start_ticks[0] = monotonic_clock_get_ticks();
+        l_duration = monotonic_clock_get_ticks() - bench_start_ticks[0];
+        if(l_duration < bench_overhead)
+        {
+            bench_overhead = l_duration;
+        }
+        else
+            { /* Nothing */ }
+    }
+
+    /* 3. Clear the statistics */
+    ret |= bench_reset();
+    return ret;
+}
+
+/**
+ *
+ * @Brief : A software interface names a region in the dump.
+ * @param region : The region index, 0 --> (BENCH_REGIONS_NUMBER - 1).
+ * @param name : A constant string, kept by reference.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_set_name(uint8_t region, const uint8_t *name)
+{
+    Std_ReturnType ret = E_OK;
+    if(region >= BENCH_REGIONS_NUMBER)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        bench_names[region] = name;
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief : Records one run of a region, called by BENCH_END().
+ * @param region : The region index.
+ * @param end_ticks : The monotonic clock at the end of the region.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_end(uint8_t region, uint32_t end_ticks)
+{
+    Std_ReturnType ret = E_OK;
+    bench_region_t *l_region = NULL;
+    uint32_t l_duration = ZERO_INIT;
+    if(region >= BENCH_REGIONS_NUMBER)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_region = &bench_regions[region];
+        l_duration = end_ticks - bench_start_ticks[region];
+        /* Remove the time stamps cost (a faster run than the calibration is zero) */
+        if(l_duration > bench_overhead)
+        {
+            l_duration -= bench_overhead;
+        }
+        else
+        {
+            l_duration = ZERO_INIT;
+        }
+        /* The statistics are frozen once the hits counter saturates */
+        if(0xFFFF != l_region->hits)
+        {
+            if((ZERO_INIT == l_region->hits) || (l_duration < l_region->duration_min))
+                { l_region->duration_min = l_duration; }
+            else
+                { /* Nothing */ }
+            if(l_duration > l_region->duration_max)
+                { l_region->duration_max = l_duration; }
+            else
+                { /* Nothing */ }
+            l_region->duration_sum += l_duration;
+            l_region->histogram[bench_histogram_bin(l_duration)]++;
+            l_region->hits++;
+        }
+        else
+            { /* Nothing */ }
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief : A software interface reads the statistics of a region.
+ * @param region : The region index.
+ * @param stats : Receives a copy of the statistics.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_get(uint8_t region, bench_region_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == stats) || (region >= BENCH_REGIONS_NUMBER))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *stats = bench_regions[region];
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief : A software interface clears the statistics of all the regions.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ */
+Std_ReturnType bench_reset(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_bin = ZERO_INIT;
+    for(l_index = ZERO_INIT; l_index < BENCH_REGIONS_NUMBER; l_index++)
+    {
+        bench_regions[l_index].duration_sum = ZERO_INIT;
+        bench_regions[l_index].duration_min = ZERO_INIT;
+        bench_regions[l_index].duration_max = ZERO_INIT;
+        bench_regions[l_index].hits = ZERO_INIT;
+        for(l_bin = ZERO_INIT; l_bin < BENCH_HISTOGRAM_BINS; l_bin++)
+        {
+            bench_regions[l_index].histogram[l_bin] = ZERO_INIT;
+        }
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief : A software interface returns the cycles of the empty region
+ *          removed from every duration.
+ * @return The time stamps cost in instruction cycles.
+ */
+uint32_t bench_get_overhead(void)
+{
+    return bench_overhead;
+}
+
+/**
+ *
+ * @Brief : A software interface writes the regions which ran over the
+ *          EUSART (blocking), one line per region :
+ *          "<name> hits min avg max | <histogram bins>" in instruction cycles.
+ *          The EUSART must be initialized by the application.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_dump(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_bin = ZERO_INIT;
+    const bench_region_t *l_region = NULL;
+    for(l_index = ZERO_INIT; l_index < BENCH_REGIONS_NUMBER; l_index++)
+    {
+        l_region = &bench_regions[l_index];
+        if(ZERO_INIT != l_region->hits)
+        {
+            /* An unnamed region is written by its index */
+            if(NULL != bench_names[l_index])
+            {
+                ret |= USART_ASYNC_Write_String_With_Blocking(bench_names[l_index]);
+            }
+            else
+            {
+                ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_index);
+            }
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_region->hits);
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_region->duration_min);
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)(l_region->duration_sum / l_region->hits));
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_region->duration_max);
+            ret |= USART_ASYNC_Write_String_With_Blocking((const uint8_t *)" |");
+            for(l_bin = ZERO_INIT; l_bin < BENCH_HISTOGRAM_BINS; l_bin++)
+            {
+                ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+                ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_region->histogram[l_bin]);
+            }
+            ret |= USART_ASYNC_Write_String_With_Blocking((const uint8_t *)"\r\n");
+        }
+        else
+            { /* Nothing */ }
+    }
+    return ret;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : The histogram bin of a duration, its number of significant bits.
+ */
+static uint8_t bench_histogram_bin(uint32_t duration)
+{
+    uint8_t l_bin = ZERO_INIT;
+    while((ZERO_INIT != duration) && (l_bin < (BENCH_HISTOGRAM_BINS - 1)))
+    {
+        duration >>= 1;
+        l_bin++;
+    }
+    return l_bin;
+}
+#endif
@@ -0,0 +1,155 @@
+/*
+ * File:   bench.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The code stopwatch <--
+ *
+ * Times code regions in instruction cycles on the monotonic clock (TIMER1
+ * at FOSC / 4), keeps the min / mean / max of every region with a log2
+ * histogram of its durations and writes them over the EUSART.
+ *
+ *      BENCH_BEGIN(BENCH_REGION_SPI);
+ *      SPI_Write_Byte_Blocking(0x55);
+ *      BENCH_END(BENCH_REGION_SPI);
+ *
+ * The macros take the time stamps inline, the cost of the two readings
+ * is measured by bench_init() and removed from every duration.
+ * A region is timed from one context (main loop or one interrupt level).
+ */
+
+#ifndef BENCH_H
+#define	BENCH_H
+
+/* --------------- Section : Includes --------------- */
+#include "../TIMER1/monotonic_clock.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* Keep the BENCH_BEGIN() / BENCH_END() in the code, compiled out when disabled */
+#define BENCH_FEATURE                   STD_ENABLE
+
+/* The number of the timed regions, 0 --> (BENCH_REGIONS_NUMBER - 1) */
+#ifndef BENCH_REGIONS_NUMBER
+#define BENCH_REGIONS_NUMBER            12U
+#endif
+
+/*
+ * The histogram bin (n) counts the durations of n significant bits :
+ * bin 0 --> 0 cycles, bin n --> [2^(n-1), 2^n) cycles,
+ * the last bin counts every longer duration as well.
+ */
+#ifndef BENCH_HISTOGRAM_BINS
+#define BENCH_HISTOGRAM_BINS            16U
+#endif
+
+/* The runs of the empty region measured by bench_init() */
+#define BENCH_CALIBRATION_RUNS          8U
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+#if BENCH_FEATURE==STD_ENABLE
+/*
+ * A function-like-macro starts the timing of a region.
+ */
+#define BENCH_BEGIN(_REGION_)           (bench_start_ticks[(_REGION_)] = monotonic_clock_get_ticks())
+/*
+ * A function-like-macro ends the timing of a region and records it,
+ * the record is out of the timed window.
+ */
+#define BENCH_END(_REGION_)             bench_end((_REGION_), monotonic_clock_get_ticks())
+#else
+#define BENCH_BEGIN(_REGION_)           ((void)0)
+#define BENCH_END(_REGION_)             ((void)0)
+#endif
+
+/* --------------- Section: Data Type Declarations --------------- */
+/*
+ * The statistics of one region, the durations are in instruction cycles.
+ */
+typedef struct {
+    uint32_t duration_sum;
+    uint32_t duration_min;
+    uint32_t duration_max;
+    uint16_t hits;
+    uint16_t histogram[BENCH_HISTOGRAM_BINS];
+} bench_region_t;
+
+/* --------------- Section: Global Variables Declarations --------------- */
+/* The start time stamps, written by BENCH_BEGIN() only */
+extern uint32_t bench_start_ticks[BENCH_REGIONS_NUMBER];
+
+/*---------------  Section: Function Declarations --------------- */
+/**
+ *
+ * @Brief : A software interface starts the monotonic clock at one tick
+ *          per instruction cycle, measures the cost of the time stamps
+ *          and clears the statistics of all the regions.
+ *          (TIMER1 belongs to the bench from now on)
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_init(void);
+
+/**
+ *
+ * @Brief : A software interface names a region in the dump.
+ * @param region : The region index, 0 --> (BENCH_REGIONS_NUMBER - 1).
+ * @param name : A constant string, kept by reference.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_set_name(uint8_t region, const uint8_t *name);
+
+/**
+ *
+ * @Brief : Records one run of a region, called by BENCH_END().
+ * @param region : The region index.
+ * @param end_ticks : The monotonic clock at the end of the region.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_end(uint8_t region, uint32_t end_ticks);
+
+/**
+ *
+ * @Brief : A software interface reads the statistics of a region.
+ * @param region : The region index.
+ * @param stats : Receives a copy of the statistics.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_get(uint8_t region, bench_region_t *stats);
+
+/**
+ *
+ * @Brief : A software interface clears the statistics of all the regions.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ */
+Std_ReturnType bench_reset(void);
+
+/**
+ *
+ * @Brief : A software interface returns the cycles of the empty region
+ *          removed from every duration.
+ * @return The time stamps cost in instruction cycles.
+ */
+uint32_t bench_get_overhead(void);
+
+/**
+ *
+ * @Brief : A software interface writes the regions which ran over the
+ *          EUSART (blocking), one line per region :
+ *          "<name> hits min avg max | <histogram bins>" in instruction cycles.
+ *          The EUSART must be initialized by the application.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType bench_dump(void);
+
+#endif	/* BENCH_H */
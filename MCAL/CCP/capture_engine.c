@@ -0,0 +1,493 @@
+/*
+ * File:   capture_engine.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "capture_engine.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)) \
+    && (TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE)
+/* --------------- Section: Macro Declarations --------------- */
+#define CAPTURE_ENGINE_RING_MASK            (CAPTURE_ENGINE_RING_SIZE - 1U)
+#define CAPTURE_ENGINE_PERMILLE             1000UL
+
+/* --------------- Section: Data Type Declarations --------------- */
+/* A consistent copy of the edges of a channel, taken from the main loop */
+typedef struct {
+    uint32_t edges;
+    uint32_t ring[CAPTURE_ENGINE_RING_SIZE];
+} capture_snapshot_t;
+
+/* --------------- Section : Global Variables --------------- */
+/* The channel and the ccp object of each module */
+static capture_channel_t *capture_engine_channels[2] = {NULL, NULL};
+static ccp_t capture_engine_ccp[2];
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void capture_engine_ccp1_handler(void);
+static void capture_engine_ccp2_handler(void);
+static void capture_engine_capture(ccp_select_t module);
+static interrupt_source_t capture_engine_source(ccp_select_t module);
+static Std_ReturnType capture_engine_snapshot(const capture_channel_t *_channel, capture_snapshot_t *snapshot);
+static uint32_t capture_engine_edge(const capture_snapshot_t *snapshot, uint32_t edge);
+static uint32_t capture_engine_last_rising(const capture_snapshot_t *snapshot);
+static Std_ReturnType capture_engine_span(const capture_channel_t *_channel, uint32_t *span, uint32_t *periods);
+static uint16_t capture_engine_permille(uint32_t part, uint32_t whole);
+
+/*---------------  Section: Function Definitions --------------- */
+Std_ReturnType capture_engine_init(capture_channel_t *_channel, const ccp_t *_ccp)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_t l_capture_ccp;
+    if((NULL == _channel) || (NULL == _ccp) || (_ccp->ccp_module_select > CCP2_MODULE)
+                          || (_channel->mode > CAPTURE_ENGINE_MODE_DUTY))
+    {
+        ret = E_NOT_OK;
+    }
+    /* The captures extend on timer 1 only */
+    else if(((CCP1_MODULE == _ccp->ccp_module_select) && (CCP1_CCP2_TMR3 == _ccp->ccp_capture_timer))
+         || ((CCP2_MODULE == _ccp->ccp_module_select) && (CCP1_CCP2_TMR1 != _ccp->ccp_capture_timer)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_capture_ccp = *_ccp;
+        l_capture_ccp.ccp_mode = CCP_MODE_CAPTURE;
+
+        /* 1. The input edges of one capture */
+        _channel->edges_per_capture = 1U;
+        if(CAPTURE_ENGINE_MODE_DUTY == _channel->mode)
+        {
+            /* The duty starts on a rising edge then the ISR toggles the edge */
+            l_capture_ccp.ccp_capture_config = CCP_CAPTURE_EVERY_RISING_EDGE;
+        }
+        else if(CCP_CAPTURE_4TH_RISING_EDGE == l_capture_ccp.ccp_capture_config)
+        {
+            _channel->edges_per_capture = 4U;
+        }
+        else if(CCP_CAPTURE_16TH_RISING_EDGE == l_capture_ccp.ccp_capture_config)
+        {
+            _channel->edges_per_capture = 16U;
+        }
+        else
+            { /* Nothing */ }
+
+        /* 2. Stop the captures of the module while the channel changes */
+        switch(l_capture_ccp.ccp_module_select)
+        {
+            case CCP1_MODULE :
+                INTI_CCP1_INTERRRUPT_DISABLE();
+                l_capture_ccp.ccp_interrupt_handler = capture_engine_ccp1_handler;
+                break;
+            case CCP2_MODULE :
+                INTI_CCP2_INTERRRUPT_DISABLE();
+                l_capture_ccp.ccp_interrupt_handler = capture_engine_ccp2_handler;
+                break;
+            default : ret = E_NOT_OK;
+                break;
+        }
+        _channel->module = l_capture_ccp.ccp_module_select;
+        _channel->edges = ZERO_INIT;
+        capture_engine_ccp[l_capture_ccp.ccp_module_select] = l_capture_ccp;
+        capture_engine_channels[l_capture_ccp.ccp_module_select] = _channel;
+
+        /* 3. The module enables its interrupt again */
+        ret |= CCP_Init(&l_capture_ccp);
+    }
+    return ret;
+}
+
+Std_ReturnType capture_engine_get_period(const capture_channel_t *_channel, uint32_t *period_ticks)
+{
+    Std_ReturnType ret = E_OK;
+    capture_snapshot_t l_snapshot;
+    uint32_t l_newest = ZERO_INIT;
+    uint8_t l_step = ZERO_INIT;
+    if((NULL == _channel) || (NULL == period_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = capture_engine_snapshot(_channel, &l_snapshot);
+        if(CAPTURE_ENGINE_MODE_DUTY == _channel->mode)
+        {
+            /* From a rising edge to the next one */
+            l_newest = capture_engine_last_rising(&l_snapshot);
+            l_step = 2U;
+        }
+        else
+        {
+            l_newest = l_snapshot.edges - 1U;
+            l_step = 1U;
+        }
+        if((E_OK == ret) && (l_snapshot.edges > l_step) && (l_newest >= l_step))
+        {
+            *period_ticks = (capture_engine_edge(&l_snapshot, l_newest) - capture_engine_edge(&l_snapshot, l_newest - l_step))
+                          / _channel->edges_per_capture;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType capture_engine_get_average_period(const capture_channel_t *_channel, uint32_t *period_ticks)
+{
+    Std_ReturnType ret = E_OK;
+    uint32_t l_span = ZERO_INIT;
+    uint32_t l_periods = ZERO_INIT;
+    if((NULL == _channel) || (NULL == period_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = capture_engine_span(_channel, &l_span, &l_periods);
+        if(E_OK == ret)
+        {
+            *period_ticks = l_span / l_periods;
+        }
+        else
+            { /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType capture_engine_get_frequency_mhz(const capture_channel_t *_channel, uint32_t *frequency_mhz)
+{
+    Std_ReturnType ret = E_OK;
+    uint32_t l_span = ZERO_INIT;
+    uint32_t l_periods = ZERO_INIT;
+    uint32_t l_quotient = ZERO_INIT;
+    uint32_t l_remainder = ZERO_INIT;
+    uint8_t l_digit = ZERO_INIT;
+    if((NULL == _channel) || (NULL == frequency_mhz))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((E_OK != capture_engine_span(_channel, &l_span, &l_periods)) || (ZERO_INIT == l_span))
+    {
+        /* A stopped input */
+        *frequency_mhz = ZERO_INIT;
+    }
+    else
+    {
+        /* The periods of one second of ticks, three more decimal digits by long division */
+        l_quotient = monotonic_clock_get_tick_hz() * l_periods;
+        l_remainder = l_quotient % l_span;
+        l_quotient /= l_span;
+        for(l_digit = ZERO_INIT; l_digit < 3U; l_digit++)
+        {
+            l_remainder *= 10U;
+            l_quotient = (l_quotient * 10U) + (l_remainder / l_span);
+            l_remainder %= l_span;
+        }
+        *frequency_mhz = l_quotient;
+    }
+    return ret;
+}
+
+Std_ReturnType capture_engine_get_high_time(const capture_channel_t *_channel, uint32_t *high_ticks,
+                                            uint16_t *duty_permille)
+{
+    Std_ReturnType ret = E_OK;
+    capture_snapshot_t l_snapshot;
+    uint32_t l_rising = ZERO_INIT;
+    uint32_t l_period = ZERO_INIT;
+    if((NULL == _channel) || (NULL == high_ticks) || (CAPTURE_ENGINE_MODE_DUTY != _channel->mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = capture_engine_snapshot(_channel, &l_snapshot);
+        /* A rising, a falling and a rising edge at least */
+        if((E_OK == ret) && (l_snapshot.edges >= 3U))
+        {
+            /* The rising edge of the last complete high time */
+            l_rising = (l_snapshot.edges & 1U) ? (l_snapshot.edges - 3U) : (l_snapshot.edges - 2U);
+            *high_ticks = capture_engine_edge(&l_snapshot, l_rising + 1U) - capture_engine_edge(&l_snapshot, l_rising);
+            /* Its period, or the one before while its period isn't over */
+            if((l_rising + 2U) < l_snapshot.edges)
+            {
+                l_period = capture_engine_edge(&l_snapshot, l_rising + 2U) - capture_engine_edge(&l_snapshot, l_rising);
+            }
+            else
+            {
+                l_period = capture_engine_edge(&l_snapshot, l_rising) - capture_engine_edge(&l_snapshot, l_rising - 2U);
+            }
+            if(NULL != duty_permille)
+            {
+                *duty_permille = capture_engine_permille(*high_ticks, l_period);
+            }
+            else
+                { /* Nothing */ }
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+Std_ReturnType capture_engine_get_average_high_time(const capture_channel_t *_channel, uint32_t *high_ticks,
+                                                    uint16_t *duty_permille)
+{
+    Std_ReturnType ret = E_OK;
+    capture_snapshot_t l_snapshot;
+    uint32_t l_rising = ZERO_INIT;
+    uint32_t l_newest = ZERO_INIT;
+    uint32_t l_high_sum = ZERO_INIT;
+    uint32_t l_periods = ZERO_INIT;
+    if((NULL == _channel) || (NULL == high_ticks) || (CAPTURE_ENGINE_MODE_DUTY != _channel->mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = capture_engine_snapshot(_channel, &l_snapshot);
+        if(E_OK == ret)
+        {
+            /* The complete periods of the ring, from the oldest rising edge */
+            l_rising = (l_snapshot.edges > CAPTURE_ENGINE_RING_SIZE)
+                     ? (l_snapshot.edges - CAPTURE_ENGINE_RING_SIZE) : ZERO_INIT;
+            l_rising += (l_rising & 1U);
+            l_newest = capture_engine_last_rising(&l_snapshot);
+            while(l_rising + 2U <= l_newest)
+            {
+                l_high_sum += capture_engine_edge(&l_snapshot, l_rising + 1U) - capture_engine_edge(&l_snapshot, l_rising);
+                l_periods++;
+                l_rising += 2U;
+            }
+            if(ZERO_INIT != l_periods)
+            {
+                *high_ticks = l_high_sum / l_periods;
+                if(NULL != duty_permille)
+                {
+                    *duty_permille = capture_engine_permille(l_high_sum,
+                                     capture_engine_edge(&l_snapshot, l_newest)
+                                   - capture_engine_edge(&l_snapshot, l_newest - (2U * l_periods)));
+                }
+                else
+                    { /* Nothing */ }
+            }
+            else
+            {
+                ret = E_NOT_OK;
+            }
+        }
+        else
+            { /* Nothing */ }
+    }
+    return ret;
+}
+
+Std_ReturnType capture_engine_reset(capture_channel_t *_channel)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if((NULL == _channel) || (_channel->module > CCP2_MODULE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(capture_engine_source(_channel->module));
+        _channel->edges = ZERO_INIT;
+        if(CAPTURE_ENGINE_MODE_DUTY == _channel->mode)
+        {
+            /* Start again on a rising edge, the mode change may set the flag */
+            switch(_channel->module)
+            {
+                case CCP1_MODULE :
+                    CCP1_SET_MODE(CCP_CAPTURE_EVERY_RISING_EDGE);
+                    INTI_CCP1_CLR_FLAG();
+                    break;
+                case CCP2_MODULE :
+                    CCP2_SET_MODE(CCP_CAPTURE_EVERY_RISING_EDGE);
+                    INTI_CCP2_CLR_FLAG();
+                    break;
+                default : /* Nothing */
+                    break;
+            }
+        }
+        else
+            { /* Nothing */ }
+        Critical_Section_Unmask_Source(capture_engine_source(_channel->module), l_critical_state);
+    }
+    return ret;
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+/**
+ * @brief : The ccp interrupt handlers, one capture.
+ */
+static void capture_engine_ccp1_handler(void)
+{
+    capture_engine_capture(CCP1_MODULE);
+}
+
+static void capture_engine_ccp2_handler(void)
+{
+    capture_engine_capture(CCP2_MODULE);
+}
+
+/**
+ * @brief : Stores the capture of a module in its channel ring,
+ *          a duty channel waits for the other edge next.
+ */
+static void capture_engine_capture(ccp_select_t module)
+{
+    capture_channel_t *l_channel = capture_engine_channels[module];
+    uint16_t l_capture = ZERO_INIT;
+    uint8_t l_next_mode = ZERO_INIT;
+    if(NULL != l_channel)
+    {
+        (void)CCP_Capture_Read_Value(&capture_engine_ccp[module], &l_capture);
+        l_channel->ring[l_channel->edges & CAPTURE_ENGINE_RING_MASK] = monotonic_clock_extend(l_capture);
+        l_channel->edges++;
+        if(CAPTURE_ENGINE_MODE_DUTY == l_channel->mode)
+        {
+            /* The odd edges are the falling ones, the mode change may set the flag */
+            l_next_mode = (l_channel->edges & 1U) ? CCP_CAPTURE_EVERY_FALLING_EDGE : CCP_CAPTURE_EVERY_RISING_EDGE;
+            if(CCP1_MODULE == module)
+            {
+                CCP1_SET_MODE(l_next_mode);
+                INTI_CCP1_CLR_FLAG();
+            }
+            else
+            {
+                CCP2_SET_MODE(l_next_mode);
+                INTI_CCP2_CLR_FLAG();
+            }
+        }
+        else
+            { /* Nothing */ }
+    }
+    else
+        { /* Nothing */ }
+}
+
+static interrupt_source_t capture_engine_source(ccp_select_t module)
+{
+    return (CCP1_MODULE == module) ? INTERRUPT_SOURCE_CCP1 : INTERRUPT_SOURCE_CCP2;
+}
+
+/**
+ * @brief : Copies the edges of a channel with its ccp interrupt masked.
+ * @return (E_NOT_OK) when the last edge is older than the channel timeout.
+ */
+static Std_ReturnType capture_engine_snapshot(const capture_channel_t *_channel, capture_snapshot_t *snapshot)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(capture_engine_source(_channel->module));
+    snapshot->edges = _channel->edges;
+    for(l_index = ZERO_INIT; l_index < CAPTURE_ENGINE_RING_SIZE; l_index++)
+    {
+        snapshot->ring[l_index] = _channel->ring[l_index];
+    }
+    Critical_Section_Unmask_Source(capture_engine_source(_channel->module), l_critical_state);
+
+    if(ZERO_INIT == snapshot->edges)
+    {
+        ret = E_NOT_OK;
+    }
+    else if((ZERO_INIT != _channel->timeout_ticks)
+         && ((monotonic_clock_get_ticks() - capture_engine_edge(snapshot, snapshot->edges - 1U)) > _channel->timeout_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+        { /* Nothing */ }
+    return ret;
+}
+
+/**
+ * @brief : The time stamp of an edge still in the ring.
+ */
+static uint32_t capture_engine_edge(const capture_snapshot_t *snapshot, uint32_t edge)
+{
+    return snapshot->ring[edge & CAPTURE_ENGINE_RING_MASK];
+}
+
+/**
+ * @brief : The last rising edge of a duty channel (the even edges).
+ */
+static uint32_t capture_engine_last_rising(const capture_snapshot_t *snapshot)
+{
+    return (snapshot->edges & 1U) ? (snapshot->edges - 1U) : (snapshot->edges - 2U);
+}
+
+/**
+ * @brief : The time of the complete periods of the ring (the moving average window).
+ * @param span : The ticks from the oldest to the newest edge of the same kind.
+ * @param periods : The input periods in the span (the prescaled edges counted).
+ * @return (E_NOT_OK) when there is no complete period or the input timed out.
+ */
+static Std_ReturnType capture_engine_span(const capture_channel_t *_channel, uint32_t *span, uint32_t *periods)
+{
+    Std_ReturnType ret = E_OK;
+    capture_snapshot_t l_snapshot;
+    uint32_t l_oldest = ZERO_INIT;
+    uint32_t l_newest = ZERO_INIT;
+    uint32_t l_periods = ZERO_INIT;
+    ret = capture_engine_snapshot(_channel, &l_snapshot);
+    if(E_OK == ret)
+    {
+        l_oldest = (l_snapshot.edges > CAPTURE_ENGINE_RING_SIZE)
+                 ? (l_snapshot.edges - CAPTURE_ENGINE_RING_SIZE) : ZERO_INIT;
+        if(CAPTURE_ENGINE_MODE_DUTY == _channel->mode)
+        {
+            /* The rising edges of the ring, two edges a period */
+            l_oldest += (l_oldest & 1U);
+            l_newest = capture_engine_last_rising(&l_snapshot);
+            l_periods = (l_newest > l_oldest) ? ((l_newest - l_oldest) / 2U) : ZERO_INIT;
+        }
+        else
+        {
+            l_newest = l_snapshot.edges - 1U;
+            l_periods = l_newest - l_oldest;
+        }
+        if(ZERO_INIT != l_periods)
+        {
+            *span = capture_engine_edge(&l_snapshot, l_newest) - capture_engine_edge(&l_snapshot, l_oldest);
+            *periods = l_periods * _channel->edges_per_capture;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    else
+        { /* Nothing */ }
+    return ret;
+}
+
+/**
+ * @brief : (part * 1000 / whole) without overflowing the long part.
+ */
+static uint16_t capture_engine_permille(uint32_t part, uint32_t whole)
+{
+    uint16_t l_permille = ZERO_INIT;
+    if(ZERO_INIT == whole)
+        { /* Nothing */ }
+    else if(part <= (0xFFFFFFFFUL / CAPTURE_ENGINE_PERMILLE))
+    {
+        l_permille = (uint16_t)((part * CAPTURE_ENGINE_PERMILLE) / whole);
+    }
+    else
+    {
+        l_permille = (uint16_t)(part / (whole / CAPTURE_ENGINE_PERMILLE));
+    }
+    return l_permille;
+}
+#endif
@@ -0,0 +1,182 @@
+/*
+ * File:   capture_engine.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The input capture measurements <--
+ *
+ * The CCP capture on timer 1 stamps the edges of an input, the CCP ISR
+ * extends every 16-bit capture to the 32-bit monotonic clock (TIMER1,
+ * started by the application) and stores it in the ring of its channel.
+ * The measurements are taken from the ring in the main loop :
+ *
+ *      capture_channel_t fan_tach = {
+ *          .mode = CAPTURE_ENGINE_MODE_PERIOD,
+ *          .timeout_ticks = 2000000UL, ... };       (1 s at 2 MHz ticks)
+ *      ccp_t fan_ccp = {
+ *          .ccp_module_select = CCP1_MODULE,
+ *          .ccp_capture_config = CCP_CAPTURE_EVERY_RISING_EDGE,
+ *          .pin = {.port = PORTC_INDEX, .pin = PIN2_INDEX, .direction = GPIO_DIRECTION_INPUT}, ... };
+ *      monotonic_clock_init(&clock_timer);
+ *      capture_engine_init(&fan_tach, &fan_ccp);
+ *      while(1) { capture_engine_get_frequency_mhz(&fan_tach, &fan_mhz); ... }
+ *
+ * CAPTURE_ENGINE_MODE_PERIOD captures the edges of (ccp_capture_config),
+ * every 4th or 16th rising edge divides the fast inputs.
+ * CAPTURE_ENGINE_MODE_DUTY toggles the edge after every capture, the
+ * ring holds a rising edge then a falling edge and so on.
+ *
+ * The capture timer is timer 1 (CCP1_CCP2_TMR1 or CCP1_TMR1_CCP2_TMR3
+ * for CCP1), its overflows are already counted by the monotonic clock.
+ * Timer 3 is not supported : nothing counts its overflows, a capture on
+ * it can't be extended past one wrap, so capture_engine_init() returns
+ * E_NOT_OK for CCP1 on CCP1_CCP2_TMR3 and for CCP2 on anything but
+ * CCP1_CCP2_TMR1 (CCP2 captures on timer 1 only with CCP1 on it too).
+ * The ISR must run less than one timer 1 wrap after the edge
+ * (keep CCP_DEFERRED_FEATURE disabled for the slow main loops). In duty
+ * mode the high and the low times must be longer than the ISR, it arms
+ * the other edge (about 17 cycles from the high priority vector on the
+ * HOST_SIM backend, see BENCHMARK/capture_engine_test.c).
+ */
+
+#ifndef CAPTURE_ENGINE_H
+#define	CAPTURE_ENGINE_H
+
+/* --------------- Section : Includes --------------- */
+#include "ccp.h"
+#include "../TIMER1/monotonic_clock.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The edges kept by a channel, a power of 2 */
+#ifndef CAPTURE_ENGINE_RING_SIZE
+#define CAPTURE_ENGINE_RING_SIZE            8U
+#endif
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef enum
+{
+    CAPTURE_ENGINE_MODE_PERIOD = 0,
+    CAPTURE_ENGINE_MODE_DUTY
+} capture_engine_mode_t;
+
+typedef struct {
+    /*
+     * (CAPTURE_ENGINE_MODE_PERIOD) or (CAPTURE_ENGINE_MODE_DUTY).
+     */
+    capture_engine_mode_t mode;
+    /*
+     * The measurements fail (the frequency reads 0) when the last edge is
+     * older than this, in monotonic clock ticks (0 : never).
+     */
+    uint32_t timeout_ticks;
+    /*
+     * Private, the ccp module of the channel.
+     */
+    ccp_select_t module;
+    /*
+     * Private, the input edges of one captured edge (1, 4 or 16).
+     */
+    uint8_t edges_per_capture;
+    /*
+     * Private, the captured edges (written by the ISR),
+     * edge (n) is in ring[n % CAPTURE_ENGINE_RING_SIZE].
+     */
+    volatile uint32_t edges;
+    volatile uint32_t ring[CAPTURE_ENGINE_RING_SIZE];
+} capture_channel_t;
+
+/*---------------  Section: Function Declarations --------------- */
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)) \
+    && (TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE)
+/**
+ *
+ * @Brief  A software interface starts the captures of a channel.
+ * @param _channel : The channel, its mode and timeout are set.
+ * @param _ccp : A pointer to a ccp module object (module, pin, capture
+ *               configuration, timer and priority), its mode and
+ *               interrupt handler are replaced by the engine.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                        or the capture timer is timer 3
+ */
+Std_ReturnType capture_engine_init(capture_channel_t *_channel, const ccp_t *_ccp);
+
+/**
+ *
+ * @Brief  A software interface reads the last period.
+ * @param _channel : The channel.
+ * @param period_ticks : The period in monotonic clock ticks.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : No period yet or the input timed out
+ */
+Std_ReturnType capture_engine_get_period(const capture_channel_t *_channel, uint32_t *period_ticks);
+
+/**
+ *
+ * @Brief  A software interface reads the moving average of the period,
+ *         over the periods of the ring.
+ * @param _channel : The channel.
+ * @param period_ticks : The average period in monotonic clock ticks.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : No period yet or the input timed out
+ */
+Std_ReturnType capture_engine_get_average_period(const capture_channel_t *_channel, uint32_t *period_ticks);
+
+/**
+ *
+ * @Brief  A software interface reads the frequency of the average period.
+ * @param _channel : The channel.
+ * @param frequency_mhz : The frequency in millihertz, 0 while there is no
+ *                        period yet or the input timed out (stopped).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType capture_engine_get_frequency_mhz(const capture_channel_t *_channel, uint32_t *frequency_mhz);
+
+/**
+ *
+ * @Brief  A software interface reads the last high time and its duty
+ *         cycle (CAPTURE_ENGINE_MODE_DUTY).
+ * @param _channel : The channel.
+ * @param high_ticks : The high time in monotonic clock ticks.
+ * @param duty_permille : The high time per mille of the period (NULL : not read).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Not a duty channel, no period yet or the input timed out
+ */
+Std_ReturnType capture_engine_get_high_time(const capture_channel_t *_channel, uint32_t *high_ticks,
+                                            uint16_t *duty_permille);
+
+/**
+ *
+ * @Brief  A software interface reads the moving average of the high time
+ *         and its duty cycle, over the periods of the ring.
+ * @param _channel : The channel.
+ * @param high_ticks : The average high time in monotonic clock ticks.
+ * @param duty_permille : The average high time per mille of the average period (NULL : not read).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : Not a duty channel, no period yet or the input timed out
+ */
+Std_ReturnType capture_engine_get_average_high_time(const capture_channel_t *_channel, uint32_t *high_ticks,
+                                                    uint16_t *duty_permille);
+
+/**
+ *
+ * @Brief  A software interface forgets the captured edges of a channel.
+ * @param _channel : The channel.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType capture_engine_reset(capture_channel_t *_channel);
+#endif
+
+#endif	/* CAPTURE_ENGINE_H */
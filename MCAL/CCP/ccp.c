@@ -6,6 +6,13 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "ccp.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#ifdef CCP_PWM_SYNC_SELECTED
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+#endif
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+#include "../Interrupt/EVENT_queue/MCAL_event_queue.h"
+#endif
 
 /* --------------- Section : Global Variables --------------- */
 #if (CCP1_INTERRUPT_FEATURE==INTERRUPT_ENABLE)
@@ -16,6 +23,35 @@ static interrupt_handler_t ccp1_interrupt_handler = NULL;
 static interrupt_handler_t ccp2_interrupt_handler = NULL;
 #endif
 
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/* 
+ * The CCPRx value latched by the ISR, read by CCP_Capture_Read_Value()
+ * while its deferred handler runs (a new capture may have overwritten CCPRx).
+ */
+static uint16_t ccp_deferred_value[2] = {ZERO_INIT, ZERO_INIT};
+static uint8_t ccp_deferred_value_valid[2] = {STD_FALSE, STD_FALSE};
+#endif
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+/* 
+ * The full duty cycle 4 * (PR2 + 1) and its per-mille scale
+ * (full duty cycle * 2^10 / 1000), computed by the pwm init.
+ */
+static uint16_t ccp_pwm_duty_full[2] = {ZERO_INIT, ZERO_INIT};
+static uint16_t ccp_pwm_permille_scale[2] = {ZERO_INIT, ZERO_INIT};
+#endif
+
+#ifdef CCP_PWM_SYNC_SELECTED
+/* The duty cycles staged for the next TIMER2 interrupt (CCP1, CCP2) */
+static uint16_t ccp_pwm_sync_duty[2] = {ZERO_INIT, ZERO_INIT};
+static volatile uint8_t ccp_pwm_sync_pending = STD_LOW;
+static volatile uint32_t ccp_pwm_sync_applied = ZERO_INIT;
+/* The TMR2 counts of CCP_PWM_SYNC_WRITE_CYCLES (with the prescaler of the stage) */
+static uint8_t ccp_pwm_sync_margin = ZERO_INIT;
+/* The TIMER2 prescaler (T2CKPS) as a shift : 1, 4, 16, 16 */
+static const uint8_t ccp_pwm_sync_prescaler_shift[4] = {0U, 2U, 4U, 4U};
+#endif
+
 /*---------------  Section: Helper Function Declarations --------------- */
 
 /*
@@ -33,6 +69,15 @@ static Std_ReturnType ccp_Mode_Init(const ccp_t *ccp_obj);
  */
 static void CCP_Configure_Interrupts(const ccp_t *ccp_obj);
 
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/**
+ * The deferred parts of the ccp interrupts, called by event_dispatch().
+ * @param payload : The CCPRx content at the interrupt.
+ */
+static void ccp1_deferred_handler(uint16_t payload);
+static void ccp2_deferred_handler(uint16_t payload);
+#endif
+
 /**
  * A software interface initializes the capture mode 
  * in the ccp module.
@@ -58,6 +103,23 @@ static void CCP_Compare_Mode_Init(const ccp_t *ccp_obj);
  */
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
 static void CCP_PWM_Mode_Init(const ccp_t *ccp_obj);
+
+/**
+ * A software interface writes a 10-bit duty cycle in the registers
+ * of the ccp module (CCPRxL:DCxB).
+ * @param ccp_module : (CCP1_MODULE) or (CCP2_MODULE).
+ * @param dutyRaw : The on time, clipped to (CCP_PWM_DUTY_RAW_MAX).
+ */
+static void CCP_PWM_Write_Duty(const ccp_select_t ccp_module, uint16_t dutyRaw);
+
+/**
+ * A software interface converts a per-mille duty cycle to the raw
+ * duty cycle of the ccp module.
+ * @param ccp_module : (CCP1_MODULE) or (CCP2_MODULE).
+ * @param dutyPermille : The duty cycle (0 --> CCP_PWM_DUTY_PERMILLE_MAX).
+ * @return The raw duty cycle (0 --> the full duty cycle).
+ */
+static uint16_t CCP_PWM_Permille_To_Raw(const ccp_select_t ccp_module, const uint16_t dutyPermille);
 #endif
 /*---------------  Section: Function Definitions --------------- */
 /**
@@ -195,6 +257,14 @@ Std_ReturnType CCP_Capture_Read_Value(const ccp_t *ccp_obj, uint16_t *capture_va
     else
     {
         ccp_period_reg_t l_temp_cap_value = { 0 };
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        if ((ccp_obj->ccp_module_select <= CCP2_MODULE) &&
+            (STD_TRUE == ccp_deferred_value_valid[ccp_obj->ccp_module_select]))
+        {
+            *capture_value = ccp_deferred_value[ccp_obj->ccp_module_select];
+        }
+        else
+#endif
         switch (ccp_obj->ccp_module_select)
         {
             case CCP1_MODULE : 
@@ -306,23 +376,76 @@ Std_ReturnType CCP_PWM_SetDutyCycle(const ccp_t *ccp_obj, const uint8_t dutyCycl
     }
     else
     {
-        uint16_t l_temp_dutyCycle = 0;
-        l_temp_dutyCycle = (uint16_t)((float)4 * ((float)PR2 + 1.0) * ((float)dutyCycle / 100.0));
-        
-        switch (ccp_obj -> ccp_module_select)
-        {
-            case CCP1_MODULE :
-                CCP1CONbits.DC1B = (uint8_t)(l_temp_dutyCycle & 0x0003);
-                CCPR1L = (uint8_t)(l_temp_dutyCycle >> 2);
-                break; 
-            case CCP2_MODULE :
-                CCP2CONbits.DC2B = (uint8_t)(l_temp_dutyCycle & 0x0003);
-                CCPR2L = (uint8_t)(l_temp_dutyCycle >> 2);
-                break; 
-            default : 
-                ret = E_NOT_OK;
-                break;
-        }
+        /* The percent is a per-mille of the tenth, no float math */
+        ret = CCP_PWM_SetDutyPermille(ccp_obj, (uint16_t)((uint16_t)dutyCycle * 10U));
+    }
+    return ret;
+}
+
+/**
+ * A software Interface writes the 10-bit duty cycle register as is.
+ * @param ccp_obj : A pointer to a ccp module object.
+ * @param dutyRaw
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_SetDutyRaw(const ccp_t *ccp_obj, const uint16_t dutyRaw)
+{
+    Std_ReturnType ret = E_OK;
+    if ((NULL == ccp_obj) || (ccp_obj->ccp_module_select > CCP2_MODULE)
+                          || (dutyRaw > ccp_pwm_duty_full[ccp_obj->ccp_module_select]))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        CCP_PWM_Write_Duty(ccp_obj -> ccp_module_select, dutyRaw);
+    }
+    return ret;
+}
+
+/**
+ * A software Interface sets the duty cycle in 0.1 % steps.
+ * @param ccp_obj : A pointer to a ccp module object.
+ * @param dutyPermille
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_SetDutyPermille(const ccp_t *ccp_obj, const uint16_t dutyPermille)
+{
+    Std_ReturnType ret = E_OK;
+    if ((NULL == ccp_obj) || (ccp_obj->ccp_module_select > CCP2_MODULE)
+                          || (dutyPermille > CCP_PWM_DUTY_PERMILLE_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = CCP_PWM_SetDutyRaw(ccp_obj, CCP_PWM_Permille_To_Raw(ccp_obj -> ccp_module_select, dutyPermille));
+    }
+    return ret;
+}
+
+/**
+ * A software Interface reads the full duty cycle of the raw duty.
+ * @param ccp_obj : A pointer to a ccp module object.
+ * @param dutyRawMax
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_GetDutyRawMax(const ccp_t *ccp_obj, uint16_t *dutyRawMax)
+{
+    Std_ReturnType ret = E_OK;
+    if ((NULL == ccp_obj) || (NULL == dutyRawMax) || (ccp_obj->ccp_module_select > CCP2_MODULE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *dutyRawMax = ccp_pwm_duty_full[ccp_obj->ccp_module_select];
     }
     return ret;
 }
@@ -384,6 +507,118 @@ Std_ReturnType CCP_PWM_Stop(const ccp_t *ccp_obj)
 }
 #endif
 
+#ifdef CCP_PWM_SYNC_SELECTED
+/**
+ * A software Interface stages the duty cycles of CCP1 and CCP2 (raw).
+ * @param ccp1DutyRaw
+ * @param ccp2DutyRaw
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_Sync_SetDutyRaw(const uint16_t ccp1DutyRaw, const uint16_t ccp2DutyRaw)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_margin = ZERO_INIT;
+    if ((ccp1DutyRaw > ccp_pwm_duty_full[CCP1_MODULE]) || (ccp2DutyRaw > ccp_pwm_duty_full[CCP2_MODULE]))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_margin = (uint8_t)((CCP_PWM_SYNC_WRITE_CYCLES >> ccp_pwm_sync_prescaler_shift[T2CONbits.T2CKPS]) + 1U);
+        if (PR2 < l_margin)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /* The handler never sees one new duty and one old duty */
+            (void)Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+            ccp_pwm_sync_duty[CCP1_MODULE] = ccp1DutyRaw;
+            ccp_pwm_sync_duty[CCP2_MODULE] = ccp2DutyRaw;
+            ccp_pwm_sync_margin = l_margin;
+            ccp_pwm_sync_pending = STD_HIGH;
+            /* The handler turned the interrupt off when it had nothing staged */
+            Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, STD_TRUE);
+        }
+    }
+    return ret;
+}
+
+/**
+ * A software Interface stages the duty cycles of CCP1 and CCP2 in 0.1 % steps.
+ * @param ccp1DutyPermille
+ * @param ccp2DutyPermille
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_Sync_SetDutyPermille(const uint16_t ccp1DutyPermille, const uint16_t ccp2DutyPermille)
+{
+    Std_ReturnType ret = E_OK;
+    if ((ccp1DutyPermille > CCP_PWM_DUTY_PERMILLE_MAX) || (ccp2DutyPermille > CCP_PWM_DUTY_PERMILLE_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = CCP_PWM_Sync_SetDutyRaw(CCP_PWM_Permille_To_Raw(CCP1_MODULE, ccp1DutyPermille),
+                                      CCP_PWM_Permille_To_Raw(CCP2_MODULE, ccp2DutyPermille));
+    }
+    return ret;
+}
+
+/**
+ * A software Interface reads the staged updates written by the handler.
+ * @param applied
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_Sync_GetApplied(uint32_t *applied)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if (NULL == applied)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+        *applied = ccp_pwm_sync_applied;
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+    }
+    return ret;
+}
+
+/*
+ * The TIMER2 interrupt handler of the buffered updates.
+ */
+void CCP_PWM_Sync_Handler(void)
+{
+    /* The two duties are latched together at the next period start when
+     * both are written before it, too close to it they wait for the next one */
+    if ((STD_HIGH == ccp_pwm_sync_pending) && ((uint16_t)(TMR2 + ccp_pwm_sync_margin) <= PR2))
+    {
+        CCP_PWM_Write_Duty(CCP1_MODULE, ccp_pwm_sync_duty[CCP1_MODULE]);
+        CCP_PWM_Write_Duty(CCP2_MODULE, ccp_pwm_sync_duty[CCP2_MODULE]);
+        ccp_pwm_sync_pending = STD_LOW;
+        ccp_pwm_sync_applied++;
+    }
+    else
+        { /* Nothing */ }
+    /* No period interrupt while nothing is staged */
+    if (STD_LOW == ccp_pwm_sync_pending)
+    {
+        INTI_TMR2_INTERRRUPT_DISABLE();
+    }
+    else
+        { /* Nothing */ }
+}
+#endif
+
 /*---------------  Section: Helper Function Definitions --------------- */
 static Std_ReturnType ccp_Mode_Init(const ccp_t *ccp_obj)
 {
@@ -456,7 +691,25 @@ static void CCP_Configure_Interrupts(const ccp_t *ccp_obj)
                   break;
         }
 #endif
-        // 4- Clear The interrupt flag & Enable its interrupt.
+        // 4- Assign the interrupt handler, routed before the source is enabled.
+        switch(ccp_obj -> ccp_module_select)
+        {
+            case CCP1_MODULE : ccp1_interrupt_handler = ccp_obj -> ccp_interrupt_handler;
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+                            event_register_handler(INTERRUPT_SOURCE_CCP1, ccp1_deferred_handler);
+#endif
+                            Interrupt_Manager_Register(INTERRUPT_SOURCE_CCP1, CCP1_ISR);
+                            break;
+            case CCP2_MODULE : ccp2_interrupt_handler = ccp_obj -> ccp_interrupt_handler;
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+                            event_register_handler(INTERRUPT_SOURCE_CCP2, ccp2_deferred_handler);
+#endif
+                            Interrupt_Manager_Register(INTERRUPT_SOURCE_CCP2, CCP2_ISR);
+                            break;
+            default : /* Nothing */;
+                  break;
+        }
+        // 5- Clear The interrupt flag & Enable its interrupt.
         switch (ccp_obj->ccp_module_select)
         {
             case CCP1_MODULE : 
@@ -470,16 +723,6 @@ static void CCP_Configure_Interrupts(const ccp_t *ccp_obj)
             default : /* Nothing */;
                   break;
         }
-        // 5- Assign the interrupt handler.
-        switch(ccp_obj -> ccp_module_select)
-        {
-            case CCP1_MODULE : ccp1_interrupt_handler = ccp_obj -> ccp_interrupt_handler;
-                            break;
-            case CCP2_MODULE : ccp2_interrupt_handler = ccp_obj -> ccp_interrupt_handler;
-                            break;
-            default : /* Nothing */;
-                  break;
-        }
 #endif 
 }
 
@@ -679,10 +922,65 @@ static void CCP_PWM_Mode_Init(const ccp_t *ccp_obj)
               break;
     }
     /* Initialize PWM frequency */
+#if CCP_PWM_PLANNER_FEATURE==CONFIG_ENABLE
+    PR2 = ccp_obj -> ccp_pwm_pr2;
+#else
     PR2 = (uint8_t) ((_XTAL_FREQ / ((ccp_obj -> ccp_pwm_frequency) * 4.0 * (ccp_obj -> timer2_prescaler_value)
             * ccp_obj -> timer2_postscaler_value)) - 1);
 #endif
+    /* The duty cycle scale of this PR2, the duty updates are integer only */
+    if (ccp_obj->ccp_module_select <= CCP2_MODULE)
+    {
+        ccp_pwm_duty_full[ccp_obj->ccp_module_select] = (uint16_t)(4U * ((uint16_t)PR2 + 1U));
+        ccp_pwm_permille_scale[ccp_obj->ccp_module_select] = (uint16_t)
+                ((((uint32_t)ccp_pwm_duty_full[ccp_obj->ccp_module_select] << CCP_PWM_PERMILLE_SCALE_SHIFT)
+                + (CCP_PWM_DUTY_PERMILLE_MAX / 2U)) / CCP_PWM_DUTY_PERMILLE_MAX);
+    }
+    else
+        { /* Nothing */ }
+#endif
+}
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+static void CCP_PWM_Write_Duty(const ccp_select_t ccp_module, uint16_t dutyRaw)
+{
+    /* 4 * 256 doesn't fit the 10 bits, the full duty is one clock short */
+    if (dutyRaw > CCP_PWM_DUTY_RAW_MAX)
+    {
+        dutyRaw = CCP_PWM_DUTY_RAW_MAX;
+    }
+    else
+        { /* Nothing */ }
+
+    switch (ccp_module)
+    {
+        case CCP1_MODULE :
+            CCP1CONbits.DC1B = (uint8_t)(dutyRaw & 0x0003);
+            CCPR1L = (uint8_t)(dutyRaw >> 2);
+            break; 
+        case CCP2_MODULE :
+            CCP2CONbits.DC2B = (uint8_t)(dutyRaw & 0x0003);
+            CCPR2L = (uint8_t)(dutyRaw >> 2);
+            break; 
+        default : /* Nothing */
+            break;
+    }
+}
+
+static uint16_t CCP_PWM_Permille_To_Raw(const ccp_select_t ccp_module, const uint16_t dutyPermille)
+{
+    /* One 16 x 16 multiply and a shift, rounded to the nearest clock */
+    uint16_t l_temp_dutyCycle = (uint16_t)((((uint32_t)dutyPermille * ccp_pwm_permille_scale[ccp_module])
+            + (1UL << (CCP_PWM_PERMILLE_SCALE_SHIFT - 1U))) >> CCP_PWM_PERMILLE_SCALE_SHIFT);
+    if (l_temp_dutyCycle > ccp_pwm_duty_full[ccp_module])
+    {
+        l_temp_dutyCycle = ccp_pwm_duty_full[ccp_module];
+    }
+    else
+        { /* Nothing */ }
+    return l_temp_dutyCycle;
 }
+#endif
 /*--------------- Section : The ISRs for CCP1 & CCP2 Modules --------------- */
 /**
  * The Interrupt service routine for the ccp 1 module
@@ -692,6 +990,10 @@ void CCP1_ISR(void)
     /* 1. Clear the interrupt flag */
     INTI_CCP1_CLR_FLAG();
     (PIR1bits.CCP1IF = 0);
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* 2. Defer the call to the main loop with the captured value */
+    event_post(INTERRUPT_SOURCE_CCP1, (uint16_t)((CCPR1H << 8) + CCPR1L));
+#else
     /* 2. Call the ISR */
     if (ccp1_interrupt_handler)
     {
@@ -699,6 +1001,7 @@ void CCP1_ISR(void)
     }
     else
         { /* Nothing */ }
+#endif
 }
 
 /*
@@ -709,6 +1012,10 @@ void CCP2_ISR(void)
     /* 1. Clear the interrupt flag */
     INTI_CCP2_CLR_FLAG();
     
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* 2. Defer the call to the main loop with the captured value */
+    event_post(INTERRUPT_SOURCE_CCP2, (uint16_t)((CCPR2H << 8) + CCPR2L));
+#else
     /* 2. Call the ISR */
     if (ccp2_interrupt_handler)
     {
@@ -716,6 +1023,35 @@ void CCP2_ISR(void)
     }
     else
         { /* Nothing */ }
+#endif
 }
 
+#if CCP_DEFERRED_FEATURE==INTERRUPT_ENABLE
+static void ccp1_deferred_handler(uint16_t payload)
+{
+    ccp_deferred_value[CCP1_MODULE] = payload;
+    ccp_deferred_value_valid[CCP1_MODULE] = STD_TRUE;
+    if (ccp1_interrupt_handler)
+    {
+        ccp1_interrupt_handler();
+    }
+    else
+        { /* Nothing */ }
+    ccp_deferred_value_valid[CCP1_MODULE] = STD_FALSE;
+}
+
+static void ccp2_deferred_handler(uint16_t payload)
+{
+    ccp_deferred_value[CCP2_MODULE] = payload;
+    ccp_deferred_value_valid[CCP2_MODULE] = STD_TRUE;
+    if (ccp2_interrupt_handler)
+    {
+        ccp2_interrupt_handler();
+    }
+    else
+        { /* Nothing */ }
+    ccp_deferred_value_valid[CCP2_MODULE] = STD_FALSE;
+}
+#endif
+
 /*---------------  Section: End Of CCP Module Driver --------------- */
@@ -48,6 +48,32 @@
  */
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
 #define CCP_PWM_MODE                    ((uint8_t)(0b00001100))
+
+/* The 10-bit duty cycle register (CCPRxL:DCxB) */
+#define CCP_PWM_DUTY_RAW_MAX            ((uint16_t)(0x03FF))
+/* The full duty cycle of CCP_PWM_SetDutyPermille() */
+#define CCP_PWM_DUTY_PERMILLE_MAX       ((uint16_t)(1000))
+/* The fraction bits of the per-mille scale computed at the init */
+#define CCP_PWM_PERMILLE_SCALE_SHIFT    (10U)
+#endif
+
+/* The buffered updates need the two modules in pwm mode and the TIMER2 interrupt */
+#if CCP_PWM_SYNC_FEATURE==CONFIG_ENABLE
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) && (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) \
+    && (TMR2_INTERRUPT_FEATURE==INTERRUPT_ENABLE)
+#define CCP_PWM_SYNC_SELECTED
+#else
+#error "CCP_PWM_SYNC_FEATURE needs CCP1 and CCP2 in pwm mode and TMR2_INTERRUPT_FEATURE"
+#endif
+#endif
+
+#ifdef CCP_PWM_SYNC_SELECTED
+/*
+ * The most instruction cycles from the TMR2 read of CCP_PWM_Sync_Handler()
+ * to its last duty write (with room), closer to the PR2 match the writes
+ * wait for the next one.
+ */
+#define CCP_PWM_SYNC_WRITE_CYCLES       (32U)
 #endif
 
 /* --------------- Section: Macro Functions Declarations --------------- */
@@ -148,12 +174,20 @@ typedef struct
 #endif
 
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+#if CCP_PWM_PLANNER_FEATURE==CONFIG_ENABLE
+    /*
+     * CCP module pwm mode period, ex (TMR2_PWM_SOLVER_PR2(20000UL)),
+     * timer 2 runs with the prescaler of the same plan.
+     */ 
+    uint8_t ccp_pwm_pr2;
+#else
     /*
      * CCP module pwm mode frequency.
      */ 
     uint32_t ccp_pwm_frequency;
     uint8_t timer2_prescaler_value;
     uint8_t timer2_postscaler_value;
+#endif
 #endif
     /*
      * CCP module mode selection.
@@ -243,6 +277,37 @@ Std_ReturnType CCP_Compare_SetValue(const ccp_t *ccp_obj, uint16_t compare_value
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 Std_ReturnType CCP_PWM_SetDutyCycle(const ccp_t *ccp_obj, const uint8_t dutyCycle);
+/**
+ * A software Interface writes the 10-bit duty cycle register as is,
+ * (CCP_PWM_GetDutyRawMax()) is the full duty cycle of the current PR2.
+ * @param ccp_obj : A pointer to a ccp module object.
+ * @param dutyRaw : The on time in TMR2 input clocks (0 --> the full duty cycle),
+ *                  clipped to (CCP_PWM_DUTY_RAW_MAX) when PR2 is 255.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_SetDutyRaw(const ccp_t *ccp_obj, const uint16_t dutyRaw);
+/**
+ * A software Interface sets the duty cycle in 0.1 % steps, integer only :
+ * the scale of PR2 is computed once by CCP_Init().
+ * @param ccp_obj : A pointer to a ccp module object.
+ * @param dutyPermille : The duty cycle (0 --> CCP_PWM_DUTY_PERMILLE_MAX).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_SetDutyPermille(const ccp_t *ccp_obj, const uint16_t dutyPermille);
+/**
+ * A software Interface reads the full duty cycle of the raw duty,
+ * 4 * (PR2 + 1) as PR2 was at CCP_Init().
+ * @param ccp_obj : A pointer to a ccp module object.
+ * @param dutyRawMax
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_GetDutyRawMax(const ccp_t *ccp_obj, uint16_t *dutyRawMax);
 /**
  * A software Interface starts the pwm mode.
  * @param ccp_obj : A pointer to a ccp module object.
@@ -261,4 +326,49 @@ Std_ReturnType CCP_PWM_Start(const ccp_t *ccp_obj);
 Std_ReturnType CCP_PWM_Stop(const ccp_t *ccp_obj);
 #endif
 
+#ifdef CCP_PWM_SYNC_SELECTED
+/**
+ * A software Interface stages the duty cycles of CCP1 and CCP2 (raw)
+ * and turns the TIMER2 interrupt on, CCP_PWM_Sync_Handler() writes the
+ * two in the next TIMER2 interrupt and they take effect on the same pwm
+ * period. A new stage before the interrupt replaces the last one.
+ * @param ccp1DutyRaw : The CCP1 on time (0 --> CCP_PWM_GetDutyRawMax()).
+ * @param ccp2DutyRaw : The CCP2 on time (0 --> CCP_PWM_GetDutyRawMax()).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                       (or PR2 leaves no room for the writes,
+ *                        see CCP_PWM_SYNC_WRITE_CYCLES)
+ */
+Std_ReturnType CCP_PWM_Sync_SetDutyRaw(const uint16_t ccp1DutyRaw, const uint16_t ccp2DutyRaw);
+/**
+ * A software Interface stages the duty cycles of CCP1 and CCP2 in 0.1 % steps
+ * (see CCP_PWM_Sync_SetDutyRaw()).
+ * @param ccp1DutyPermille : The CCP1 duty cycle (0 --> CCP_PWM_DUTY_PERMILLE_MAX).
+ * @param ccp2DutyPermille : The CCP2 duty cycle (0 --> CCP_PWM_DUTY_PERMILLE_MAX).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_Sync_SetDutyPermille(const uint16_t ccp1DutyPermille, const uint16_t ccp2DutyPermille);
+/**
+ * A software Interface reads the staged updates written by CCP_PWM_Sync_Handler().
+ * @param applied : The updates since the start (wraps at 2^32).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType CCP_PWM_Sync_GetApplied(uint32_t *applied);
+/**
+ * The TIMER2 interrupt handler of the buffered updates (TMR2_INTERRUPT_HANDLER
+ * of the pwm timer). The two duty cycles are written in the same period
+ * and latched together at the next one : when TMR2 is within
+ * CCP_PWM_SYNC_WRITE_CYCLES of PR2 (an interrupt pending from an idle
+ * period, or a late one) the writes wait for the next match.
+ * The handler turns the TIMER2 interrupt off once nothing is staged :
+ * the TIMER2 interrupt serves the buffered updates only.
+ */
+void CCP_PWM_Sync_Handler(void);
+#endif
+
 #endif	/* CCP_H */
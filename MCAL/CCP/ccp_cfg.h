@@ -13,8 +13,30 @@
 #define CCP_CFG_COMPARE_MODE_SELECTED       (0X01)
 #define CCP_CFG_PWM_MODE_SELECTED           (0X02)
 
+/* The modes of the modules (a build can select its own) */
+#ifndef CCP1_CFG_SELECTED_MODE
 #define CCP1_CFG_SELECTED_MODE              CCP_CFG_COMPARE_MODE_SELECTED
+#endif
+#ifndef CCP2_CFG_SELECTED_MODE
 #define CCP2_CFG_SELECTED_MODE              CCP_CFG_PWM_MODE_SELECTED
+#endif
+
+/*
+ * The PWM period is given as PR2, planned at compile time with
+ * TMR2_PWM_SOLVER_*() (MCAL/TIMER_SOLVER/timer_solver.h).
+ * CONFIG_DISABLE : PR2 is computed by CCP_Init() from the frequency.
+ */
+#define CCP_PWM_PLANNER_FEATURE             CONFIG_ENABLE
+
+/*
+ * Buffered PWM updates : the duty cycles of the two modules are staged
+ * and written together by the TIMER2 interrupt, they take effect on the
+ * same pwm period. It needs CCP1 and CCP2 both in pwm mode and
+ * TMR2_INTERRUPT_FEATURE, ccp.h stops the build without them.
+ */
+#ifndef CCP_PWM_SYNC_FEATURE
+#define CCP_PWM_SYNC_FEATURE                CONFIG_DISABLE
+#endif
 
 #endif	/* CCP_CFG_H */
 
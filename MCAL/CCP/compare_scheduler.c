@@ -0,0 +1,311 @@
+/*
+ * File:   compare_scheduler.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "compare_scheduler.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)) \
+    && (TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE)
+/* --------------- Section: Data Type Declarations --------------- */
+/* A queued event and its add order (the order of the same timestamps) */
+typedef struct {
+    compare_event_t event;
+    uint8_t order;
+} compare_scheduler_entry_t;
+
+/* --------------- Section : Global Variables --------------- */
+/* The heap : an entry is never later than its two children (2n + 1) and (2n + 2) */
+static compare_scheduler_entry_t compare_scheduler_heap[COMPARE_SCHEDULER_QUEUE_SIZE];
+static uint8_t compare_scheduler_size = ZERO_INIT;
+static uint8_t compare_scheduler_order = ZERO_INIT;
+static ccp_t compare_scheduler_ccp;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void compare_scheduler_ccp_handler(void);
+static uint8_t compare_scheduler_arm(void);
+static void compare_scheduler_pop(compare_event_t *_event);
+static void compare_scheduler_run(const compare_event_t *_event);
+static uint8_t compare_scheduler_earlier(const compare_scheduler_entry_t *_first,
+                                         const compare_scheduler_entry_t *_second);
+static interrupt_source_t compare_scheduler_source(void);
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ *
+ * @Brief  A software interface starts the scheduler on a ccp compare
+ *         channel, the queued events are removed.
+ * @param _ccp : A pointer to a ccp module object, its compare timer is timer 1.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType compare_scheduler_init(const ccp_t *_ccp)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == _ccp) || (_ccp->ccp_module_select > CCP2_MODULE))
+    {
+        ret = E_NOT_OK;
+    }
+    /* The timestamps are on timer 1 only */
+    else if(((CCP1_MODULE == _ccp->ccp_module_select) && (CCP1_CCP2_TMR3 == _ccp->ccp_compare_timer))
+         || ((CCP2_MODULE == _ccp->ccp_module_select) && (CCP1_CCP2_TMR1 != _ccp->ccp_compare_timer)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 1. Stop the events while the queue is emptied */
+        if(CCP1_MODULE == _ccp->ccp_module_select)
+            { INTI_CCP1_INTERRRUPT_DISABLE(); }
+        else
+            { INTI_CCP2_INTERRRUPT_DISABLE(); }
+        compare_scheduler_size = ZERO_INIT;
+
+        /* 2. Software interrupt matches, the ISR runs the events */
+        compare_scheduler_ccp = *_ccp;
+        compare_scheduler_ccp.ccp_mode = CCP_MODE_COMPARE;
+        compare_scheduler_ccp.ccp_compare_config = CCP_COMPARE_SW_INTERRUPT;
+        compare_scheduler_ccp.ccp_interrupt_handler = compare_scheduler_ccp_handler;
+        ret = CCP_Init(&compare_scheduler_ccp);
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief  A software interface queues a copy of an event, a new next
+ *         event programs the compare again.
+ * @param _event : The event.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                       (bad event or the queue is full)
+ */
+Std_ReturnType compare_scheduler_add(const compare_event_t *_event)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    compare_scheduler_entry_t l_entry;
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_parent = ZERO_INIT;
+    if((NULL == _event) || (_event->action > COMPARE_EVENT_CALLBACK)
+                        || ((COMPARE_EVENT_CALLBACK == _event->action) && (NULL == _event->callback)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(compare_scheduler_source());
+        if(compare_scheduler_size >= COMPARE_SCHEDULER_QUEUE_SIZE)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /* 1. Sift the event up from the end of the heap */
+            l_entry.event = *_event;
+            l_entry.order = compare_scheduler_order++;
+            l_index = compare_scheduler_size++;
+            while(l_index > ZERO_INIT)
+            {
+                l_parent = (uint8_t)((l_index - 1U) >> 1);
+                if(STD_TRUE == compare_scheduler_earlier(&l_entry, &compare_scheduler_heap[l_parent]))
+                {
+                    compare_scheduler_heap[l_index] = compare_scheduler_heap[l_parent];
+                    l_index = l_parent;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            compare_scheduler_heap[l_index] = l_entry;
+
+            /* 2. A new next event : program its compare, or request the ISR when it is close */
+            if((ZERO_INIT == l_index) && (STD_TRUE == compare_scheduler_arm()))
+            {
+                if(CCP1_MODULE == compare_scheduler_ccp.ccp_module_select)
+                    { INTI_CCP1_SET_FLAG(); }
+                else
+                    { INTI_CCP2_SET_FLAG(); }
+            }
+            else
+                { /* Nothing */ }
+        }
+        Critical_Section_Unmask_Source(compare_scheduler_source(), l_critical_state);
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief  A software interface removes the queued events.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType compare_scheduler_clear(void)
+{
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(compare_scheduler_source());
+    compare_scheduler_size = ZERO_INIT;
+    Critical_Section_Unmask_Source(compare_scheduler_source(), l_critical_state);
+    return E_OK;
+}
+
+/**
+ *
+ * @Brief  A software interface reads the queued events.
+ * @param pending : The events not run yet.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType compare_scheduler_get_pending(uint8_t *pending)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == pending)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *pending = compare_scheduler_size;
+    }
+    return ret;
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+/**
+ * @brief : The ccp compare interrupt handler, runs the events that are due.
+ */
+static void compare_scheduler_ccp_handler(void)
+{
+    compare_event_t l_event;
+    /* A match of a far event (an earlier wrap of timer 1) only programs it again */
+    while(STD_TRUE == compare_scheduler_arm())
+    {
+        /* Too close for a compare match, wait for it here */
+        while((int32_t)(compare_scheduler_heap[0].event.timestamp - monotonic_clock_get_ticks()) > 0)
+            { /* Nothing */ }
+        compare_scheduler_pop(&l_event);
+        compare_scheduler_run(&l_event);
+    }
+}
+
+/**
+ * @brief : Programs the compare on the next event.
+ * @return STD_TRUE : The next event is closer than COMPARE_SCHEDULER_SPIN_TICKS
+ *                    (or late), its match can be missed.
+ */
+static uint8_t compare_scheduler_arm(void)
+{
+    uint8_t l_close = STD_FALSE;
+    if(compare_scheduler_size > ZERO_INIT)
+    {
+        /* The compare first, then the clock : a match after the read can't be missed */
+        (void)CCP_Compare_SetValue(&compare_scheduler_ccp, (uint16_t)compare_scheduler_heap[0].event.timestamp);
+        if((int32_t)(compare_scheduler_heap[0].event.timestamp - monotonic_clock_get_ticks()) <= COMPARE_SCHEDULER_SPIN_TICKS)
+        {
+            l_close = STD_TRUE;
+        }
+        else
+            { /* Nothing */ }
+    }
+    else
+        { /* Nothing */ }
+    return l_close;
+}
+
+/**
+ * @brief : Removes the next event, the last entry sifts down from the top.
+ */
+static void compare_scheduler_pop(compare_event_t *_event)
+{
+    compare_scheduler_entry_t l_last;
+    uint8_t l_index = ZERO_INIT;
+    uint8_t l_child = ZERO_INIT;
+    *_event = compare_scheduler_heap[0].event;
+    compare_scheduler_size--;
+    l_last = compare_scheduler_heap[compare_scheduler_size];
+    while(1)
+    {
+        l_child = (uint8_t)((l_index << 1) + 1U);
+        if(l_child >= compare_scheduler_size)
+        {
+            break;
+        }
+        else
+            { /* Nothing */ }
+        /* The earlier of the two children */
+        if(((l_child + 1U) < compare_scheduler_size)
+        && (STD_TRUE == compare_scheduler_earlier(&compare_scheduler_heap[l_child + 1U], &compare_scheduler_heap[l_child])))
+        {
+            l_child++;
+        }
+        else
+            { /* Nothing */ }
+        if(STD_TRUE == compare_scheduler_earlier(&compare_scheduler_heap[l_child], &l_last))
+        {
+            compare_scheduler_heap[l_index] = compare_scheduler_heap[l_child];
+            l_index = l_child;
+        }
+        else
+        {
+            break;
+        }
+    }
+    compare_scheduler_heap[l_index] = l_last;
+}
+
+/**
+ * @brief : Runs the action of an event.
+ */
+static void compare_scheduler_run(const compare_event_t *_event)
+{
+    switch(_event->action)
+    {
+        case COMPARE_EVENT_PIN_WRITE :
+            (void)gpio_pin_write_logic(&(_event->pin), (logic_t)_event->pin.logic);
+            break;
+        case COMPARE_EVENT_PIN_TOGGLE :
+            (void)gpio_pin_toggle_logic(&(_event->pin));
+            break;
+        case COMPARE_EVENT_CALLBACK :
+            _event->callback();
+            break;
+        default : /* Nothing */
+            break;
+    }
+}
+
+/**
+ * @brief : The order of the heap, the timestamps then the add order
+ *          (the differences are right across the wraps).
+ * @return STD_TRUE : (_first) runs before (_second).
+ */
+static uint8_t compare_scheduler_earlier(const compare_scheduler_entry_t *_first,
+                                         const compare_scheduler_entry_t *_second)
+{
+    int32_t l_difference = (int32_t)(_first->event.timestamp - _second->event.timestamp);
+    uint8_t l_earlier = STD_FALSE;
+    if((l_difference < 0) || ((ZERO_INIT == l_difference) && ((int8_t)(_first->order - _second->order) < 0)))
+    {
+        l_earlier = STD_TRUE;
+    }
+    else
+        { /* Nothing */ }
+    return l_earlier;
+}
+
+/**
+ * @brief : The interrupt source of the scheduler channel.
+ */
+static interrupt_source_t compare_scheduler_source(void)
+{
+    return (CCP1_MODULE == compare_scheduler_ccp.ccp_module_select) ? INTERRUPT_SOURCE_CCP1 : INTERRUPT_SOURCE_CCP2;
+}
+#endif
@@ -0,0 +1,129 @@
+/*
+ * File:   compare_scheduler.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The timed output events on a CCP compare channel <--
+ *
+ * The events (a pin write, a pin toggle or a callback) are queued at
+ * absolute monotonic clock timestamps (TIMER1, started by the
+ * application), the queue is a binary heap on the timestamps and the
+ * CCP compare is programmed on the next event only :
+ *
+ *      compare_event_t valve_open = {
+ *          .action = COMPARE_EVENT_PIN_WRITE,
+ *          .pin = {.port = PORTD_INDEX, .pin = PIN0_INDEX, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_HIGH} };
+ *      monotonic_clock_init(&clock_timer);
+ *      compare_scheduler_init(&scheduler_ccp);
+ *      l_start = monotonic_clock_get_ticks() + monotonic_clock_us_to_ticks(1000);
+ *      valve_open.timestamp = l_start;
+ *      compare_scheduler_add(&valve_open);
+ *      valve_close.timestamp = l_start + monotonic_clock_us_to_ticks(2500);
+ *      compare_scheduler_add(&valve_close);
+ *
+ * The compare timer is timer 1 (CCP1_CCP2_TMR1 or CCP1_TMR1_CCP2_TMR3
+ * for CCP1), the timestamps are within 2^31 ticks of the clock. The
+ * events run in the CCP ISR, in the order of their timestamps and in
+ * the order they were added for the same timestamp. The pins are
+ * initialized outputs. An event later than the clock runs at once,
+ * closer than COMPARE_SCHEDULER_SPIN_TICKS the ISR waits for it.
+ */
+
+#ifndef COMPARE_SCHEDULER_H
+#define	COMPARE_SCHEDULER_H
+
+/* --------------- Section : Includes --------------- */
+#include "ccp.h"
+#include "../TIMER1/monotonic_clock.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The queued events, up to 127 */
+#ifndef COMPARE_SCHEDULER_QUEUE_SIZE
+#define COMPARE_SCHEDULER_QUEUE_SIZE        16U
+#endif
+
+/*
+ * An event this close (in monotonic clock ticks) is waited for in the
+ * ISR, the compare can't be programmed before the timer passes it.
+ */
+#define COMPARE_SCHEDULER_SPIN_TICKS        64L
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef enum
+{
+    COMPARE_EVENT_PIN_WRITE = 0,    /* Writes (pin.logic) on the pin */
+    COMPARE_EVENT_PIN_TOGGLE,
+    COMPARE_EVENT_CALLBACK
+} compare_event_action_t;
+
+typedef struct {
+    /*
+     * The monotonic clock ticks of the event.
+     */
+    uint32_t timestamp;
+    /*
+     * (COMPARE_EVENT_PIN_WRITE), (COMPARE_EVENT_PIN_TOGGLE) or (COMPARE_EVENT_CALLBACK).
+     */
+    compare_event_action_t action;
+    /*
+     * The pin and its logic of a pin event.
+     */
+    pin_config_t pin;
+    /*
+     * The callback of a callback event, it runs in the ISR
+     * (keep it short, it can add events).
+     */
+    void (* callback)(void);
+} compare_event_t;
+
+/*---------------  Section: Function Declarations --------------- */
+#if ((CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)) \
+    && (TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE)
+/**
+ *
+ * @Brief  A software interface starts the scheduler on a ccp compare
+ *         channel, the queued events are removed.
+ * @param _ccp : A pointer to a ccp module object (module, compare timer and
+ *               priority), its mode, compare configuration and interrupt
+ *               handler are replaced by the scheduler.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType compare_scheduler_init(const ccp_t *_ccp);
+
+/**
+ *
+ * @Brief  A software interface queues an event (the event is copied).
+ * @param _event : The event.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                       (bad event or the queue is full)
+ */
+Std_ReturnType compare_scheduler_add(const compare_event_t *_event);
+
+/**
+ *
+ * @Brief  A software interface removes the queued events.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType compare_scheduler_clear(void);
+
+/**
+ *
+ * @Brief  A software interface reads the queued events.
+ * @param pending : The events not run yet.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType compare_scheduler_get_pending(uint8_t *pending);
+#endif
+
+#endif	/* COMPARE_SCHEDULER_H */
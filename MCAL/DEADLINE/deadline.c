@@ -0,0 +1,54 @@
+/*
+ * File:   deadline.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "deadline.h"
+
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+/*---------------  Section: Function Definitions --------------- */
+Std_ReturnType deadline_start_us(deadline_t *_deadline, uint32_t us)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == _deadline)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        _deadline->ticks = monotonic_clock_us_to_ticks(us);
+        _deadline->start = monotonic_clock_get_ticks();
+    }
+    return ret;
+}
+
+uint8_t deadline_expired(const deadline_t *_deadline)
+{
+    uint8_t l_expired = STD_TRUE;
+    if(NULL != _deadline)
+    {
+        /* The elapsed ticks are right across the wrap of the clock */
+        l_expired = ((monotonic_clock_get_ticks() - _deadline->start) >= _deadline->ticks)
+                  ? STD_TRUE : STD_FALSE;
+    }
+    else
+        { /* Nothing */ }
+    return l_expired;
+}
+
+Std_ReturnType deadline_wait(const deadline_t *_deadline)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == _deadline)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(STD_FALSE == deadline_expired(_deadline));
+    }
+    return ret;
+}
+#endif
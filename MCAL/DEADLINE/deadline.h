@@ -0,0 +1,152 @@
+/*
+ * File:   deadline.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The cooperative delays <--
+ *
+ * A deadline is a start time stamp and a length on the monotonic clock
+ * (TIMER1), started by the application before the first deadline.
+ * A driver checks deadline_expired() and returns instead of spinning,
+ * its resumable task goes on from the same place on the next call :
+ *
+ *      static uint8_t blink_task(deadline_task_t *task)
+ *      {
+ *          DEADLINE_TASK_BEGIN(task);
+ *          led_turn_on(&led);
+ *          DEADLINE_TASK_DELAY_US(task, 500000UL);
+ *          led_turn_off(&led);
+ *          DEADLINE_TASK_DELAY_US(task, 500000UL);
+ *          DEADLINE_TASK_END(task);
+ *      }
+ *      while(1) { blink_task(&blink); service_uart(); ... }
+ *
+ * The task body is a switch on its resume point : the locals are lost
+ * between the calls (keep the state in the task or in the driver object)
+ * and no switch statement may hold a wait.
+ */
+
+#ifndef DEADLINE_H
+#define	DEADLINE_H
+
+/* --------------- Section : Includes --------------- */
+#include "../TIMER1/monotonic_clock.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The status returned by a task body */
+#define DEADLINE_TASK_PENDING           STD_LOW
+#define DEADLINE_TASK_DONE              STD_HIGH
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+/*
+ * A function-like-macro opens the body of a resumable task,
+ * the body goes on from the last wait of the task.
+ */
+#define DEADLINE_TASK_BEGIN(_TASK_)                                     \
+            switch((_TASK_)->resume_point) { case 0U:
+
+/*
+ * A function-like-macro returns (DEADLINE_TASK_PENDING) from the task
+ * body until the condition is true.
+ * (The resume point is only reached by the switch, after the return,
+ *  no statement falls through into its case label)
+ */
+#define DEADLINE_TASK_WAIT_UNTIL(_TASK_, _COND_)                        \
+            do {                                                        \
+                (_TASK_)->resume_point = (uint16_t)__LINE__;            \
+                while(!(_COND_)) {                                      \
+                    return DEADLINE_TASK_PENDING;                       \
+                    case __LINE__: ;                                    \
+                }                                                       \
+            } while(0)
+
+/*
+ * A function-like-macro returns (DEADLINE_TASK_PENDING) from the task
+ * body until (_US_) microseconds passed.
+ */
+#define DEADLINE_TASK_DELAY_US(_TASK_, _US_)                            \
+            do {                                                        \
+                deadline_start_us(&((_TASK_)->deadline), (_US_));       \
+                DEADLINE_TASK_WAIT_UNTIL((_TASK_), deadline_expired(&((_TASK_)->deadline))); \
+            } while(0)
+
+/*
+ * A function-like-macro returns (DEADLINE_TASK_PENDING) once,
+ * the body goes on on the next call.
+ */
+#define DEADLINE_TASK_YIELD(_TASK_)                                     \
+            do {                                                        \
+                (_TASK_)->resume_point = (uint16_t)__LINE__;            \
+                return DEADLINE_TASK_PENDING;                           \
+                case __LINE__: ;                                        \
+            } while(0)
+
+/*
+ * A function-like-macro closes the body of a resumable task, returns
+ * (DEADLINE_TASK_DONE) and the next call starts the task again.
+ */
+#define DEADLINE_TASK_END(_TASK_)                                       \
+            default : break; }                                          \
+            (_TASK_)->resume_point = 0U;                                \
+            return DEADLINE_TASK_DONE
+
+/*
+ * A function-like-macro starts a task again from its beginning.
+ */
+#define DEADLINE_TASK_RESTART(_TASK_)   ((_TASK_)->resume_point = 0U)
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef struct {
+    uint32_t start;             /* The monotonic clock at the start */
+    uint32_t ticks;             /* The length in monotonic clock ticks */
+} deadline_t;
+
+typedef struct {
+    /*
+     * Private, the line of the last wait (0 : the task beginning).
+     */
+    uint16_t resume_point;
+    /*
+     * The deadline of DEADLINE_TASK_DELAY_US().
+     */
+    deadline_t deadline;
+    /*
+     * Free for the task body, a loop index kept between the calls.
+     */
+    uint8_t index;
+} deadline_task_t;
+
+/*---------------  Section: Function Declarations --------------- */
+/**
+ *
+ * @Brief  A software interface starts a deadline from now.
+ * @param _deadline : The deadline.
+ * @param us : The microseconds to the deadline (at most half the clock wrap).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType deadline_start_us(deadline_t *_deadline, uint32_t us);
+
+/**
+ *
+ * @Brief  A software interface checks a deadline, the clock wrap is harmless.
+ * @param _deadline : The deadline.
+ * @return (STD_TRUE) : The deadline passed (or no deadline given).
+ *         (STD_FALSE) : The deadline is still ahead.
+ */
+uint8_t deadline_expired(const deadline_t *_deadline);
+
+/**
+ *
+ * @Brief  A software interface spins until a deadline passes,
+ *         for the waits shorter than a main loop pass.
+ * @param _deadline : The deadline.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType deadline_wait(const deadline_t *_deadline);
+
+#endif	/* DEADLINE_H */
@@ -15,6 +15,13 @@ volatile uint8_t* lat_registers[] = {&LATA, &LATB, &LATC, &LATD, &LATE};       /
 /* Reference to the port status registers (PORT) */
 volatile uint8_t* port_registers[] = {&PORTA, &PORTB, &PORTC, &PORTD, &PORTE}; /*-->accessed with dereferencing <--*/
 
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+/* RAM copies of LATA --> LATE, only the bits set in lat_dirty[] are meaningful */
+static uint8_t lat_shadow[PORT_MAX_NUMBER];
+/* The shadow bits written since the last gpio_commit() */
+static uint8_t lat_dirty[PORT_MAX_NUMBER];
+#endif
+
 /* -------------Functions Definitions------------- */
 /**
  * 
@@ -162,8 +169,70 @@ Std_ReturnType gpio_pin_initialize(const pin_config_t* _pin_config){
     }
     else 
     {
-        ret = gpio_pin_direction_init(_pin_config);
+        /* The latch first, an output pin starts driving its initial logic */
         ret = gpio_pin_write_logic(_pin_config, _pin_config->logic);
+        ret |= gpio_pin_direction_init(_pin_config);
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param _pin_table   : A table of pin configurations, can be a const table
+ *                       kept in the program memory.
+ * @param pins_number  : The number of entries in the table.
+ * @return Status of the function
+ *          (E_OK)     : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Initializes all the pins of the table in one pass,
+ *                           the table is folded into one LAT value and one 
+ *                           TRIS value per port, then each used port is 
+ *                           written twice (LATx then TRISx) <--
+ * @note               : The pins of a port not listed in the table keep 
+ *                       their direction and logic.
+ */
+#if DIO_PIN_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_init_table(const pin_config_t _pin_table[], uint8_t pins_number){
+    Std_ReturnType ret = E_OK;
+    uint8_t l_pins_mask[PORT_MAX_NUMBER] = {ZERO_INIT};
+    uint8_t l_tris_value[PORT_MAX_NUMBER] = {ZERO_INIT};
+    uint8_t l_lat_value[PORT_MAX_NUMBER] = {ZERO_INIT};
+    uint8_t l_counter = ZERO_INIT;
+    uint8_t l_pin_bit = ZERO_INIT;
+    if(NULL == _pin_table)
+    {
+        ret = E_NOT_OK;
+    }
+    else 
+    {
+        for( ; l_counter < pins_number; ++l_counter){
+            if(_pin_table[l_counter].port > PORT_MAX_NUMBER - 1){
+                ret = E_NOT_OK;
+            }
+            else {
+                l_pin_bit = (uint8_t)(BIT_MASK << _pin_table[l_counter].pin);
+                l_pins_mask[_pin_table[l_counter].port] |= l_pin_bit;
+                if(GPIO_DIRECTION_INPUT == _pin_table[l_counter].direction){
+                    l_tris_value[_pin_table[l_counter].port] |= l_pin_bit;
+                }
+                else { /* Nothing */ }
+                if(GPIO_HIGH == _pin_table[l_counter].logic){
+                    l_lat_value[_pin_table[l_counter].port] |= l_pin_bit;
+                }
+                else { /* Nothing */ }
+            }
+        }
+        for(l_counter = ZERO_INIT; l_counter < PORT_MAX_NUMBER; ++l_counter){
+            if(l_pins_mask[l_counter]){
+                /* The latch first, the outputs start driving their initial logic */
+                *lat_registers[l_counter] = (uint8_t)((*lat_registers[l_counter] & ~l_pins_mask[l_counter]) 
+                                                      | l_lat_value[l_counter]);
+                *tris_registers[l_counter] = (uint8_t)((*tris_registers[l_counter] & ~l_pins_mask[l_counter]) 
+                                                       | l_tris_value[l_counter]);
+            }
+            else { /* Nothing */ }
+        }
     }
     return ret;
 }
@@ -280,4 +349,311 @@ Std_ReturnType gpio_port_toggle_logic(const port_index_t port){
     }
     return ret;
 }
-#endif
\ No newline at end of file
+#endif
+
+/**
+ * 
+ * @param port         : The port number or name.
+ * @param mask         : The pins of the port to be written (1 : written).
+ * @param value        : The new logic of the masked pins.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Writes the masked pins of the port in one 
+ *                           read-modify-write of LATx, the other pins 
+ *                           keep their logic <--
+ */
+#if DIO_PORT_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_port_write_masked(const port_index_t port, uint8_t mask, uint8_t value){
+    Std_ReturnType ret = E_OK;
+    if(port > PORT_MAX_NUMBER - 1) {
+        ret = E_NOT_OK;
+    }
+    else {
+        *lat_registers[port] = (uint8_t)((*lat_registers[port] & ~mask) | (value & mask));
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param _group       : The group object to be filled.
+ * @param _pins        : The pins of the group, _pins[n] is driven by bit (n)
+ *                       of the group value.
+ * @param pins_number  : The number of pins in the group (1 --> 8).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Precomputes the per-port masks of a pin group <--
+ * @note               : The pins direction/logic are not touched, 
+ *                       initialize the pins first.
+ */
+#if DIO_GROUP_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_group_init(gpio_group_t *_group, const pin_config_t _pins[],
+                               uint8_t pins_number){
+    Std_ReturnType ret = E_OK;
+    uint8_t l_pin_counter = ZERO_INIT;
+    if((NULL == _group) || (NULL == _pins) || (ZERO_INIT == pins_number)
+                        || (pins_number > GPIO_GROUP_MAX_PINS)){
+        ret = E_NOT_OK;
+    }
+    else {
+        memset(_group, ZERO_INIT, sizeof(gpio_group_t));
+        _group->pins_number = pins_number;
+        _group->port = _pins[0].port;
+        _group->shift = _pins[0].pin;
+        _group->single_port = STD_TRUE;
+        for( ; l_pin_counter < pins_number; ++l_pin_counter){
+            if(_pins[l_pin_counter].port > PORT_MAX_NUMBER - 1){
+                ret = E_NOT_OK;
+                break;
+            }
+            else { /* Nothing */ }
+            _group->pin_port[l_pin_counter] = _pins[l_pin_counter].port;
+            _group->pin_mask[l_pin_counter] = (uint8_t)(BIT_MASK << _pins[l_pin_counter].pin);
+            _group->port_mask[_pins[l_pin_counter].port] |= _group->pin_mask[l_pin_counter];
+            if((_pins[l_pin_counter].port != _group->port) || 
+               (_pins[l_pin_counter].pin != (_group->shift + l_pin_counter))){
+                _group->single_port = STD_FALSE;
+            }
+            else { /* Nothing */ }
+        }
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param _group       : The group object (built by gpio_group_init()).
+ * @param value        : The value to be written, bit (n) --> pin (n).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Writes a value on a pin group, one masked LATx 
+ *                           write per port the group touches <--
+ */
+#if DIO_GROUP_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_group_write(const gpio_group_t *_group, uint8_t value){
+    Std_ReturnType ret = E_OK;
+    if(NULL == _group) {
+        ret = E_NOT_OK;
+    }
+    else if(_group->single_port) {
+        ret = gpio_port_write_masked(_group->port, _group->port_mask[_group->port], 
+                                     (uint8_t)(value << _group->shift));
+    }
+    else {
+        uint8_t l_port_value[PORT_MAX_NUMBER] = {ZERO_INIT};
+        uint8_t l_counter = ZERO_INIT;
+        for( ; l_counter < _group->pins_number; ++l_counter){
+            if(value & BIT_MASK){
+                l_port_value[_group->pin_port[l_counter]] |= _group->pin_mask[l_counter];
+            }
+            else { /* Nothing */ }
+            value >>= 1;
+        }
+        for(l_counter = ZERO_INIT; l_counter < PORT_MAX_NUMBER; ++l_counter){
+            if(_group->port_mask[l_counter]){
+                ret = gpio_port_write_masked(l_counter, _group->port_mask[l_counter], 
+                                             l_port_value[l_counter]);
+            }
+            else { /* Nothing */ }
+        }
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param _group       : The group object (built by gpio_group_init()).
+ * @param value        : A pointer to the variable receiving the group value,
+ *                       bit (n) <-- pin (n).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Reads a pin group, each PORTx register the group 
+ *                           touches is read only once <--
+ */
+#if DIO_GROUP_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_group_read(const gpio_group_t *_group, uint8_t *value){
+    Std_ReturnType ret = E_OK;
+    if((NULL == _group) || (NULL == value)) {
+        ret = E_NOT_OK;
+    }
+    else if(_group->single_port) {
+        *value = (uint8_t)((*port_registers[_group->port] & _group->port_mask[_group->port]) 
+                                                          >> _group->shift);
+    }
+    else {
+        uint8_t l_port_value[PORT_MAX_NUMBER] = {ZERO_INIT};
+        uint8_t l_counter = ZERO_INIT;
+        uint8_t l_value = ZERO_INIT;
+        for( ; l_counter < PORT_MAX_NUMBER; ++l_counter){
+            if(_group->port_mask[l_counter]){
+                l_port_value[l_counter] = *port_registers[l_counter];
+            }
+            else { /* Nothing */ }
+        }
+        for(l_counter = _group->pins_number; l_counter > ZERO_INIT; --l_counter){
+            l_value <<= 1;
+            if(l_port_value[_group->pin_port[l_counter - 1]] & _group->pin_mask[l_counter - 1]){
+                l_value |= BIT_MASK;
+            }
+            else { /* Nothing */ }
+        }
+        *value = l_value;
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param ports_value  : An array of (PORT_MAX_NUMBER) elements receiving 
+ *                       PORTA --> PORTE.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Reads all the PORTx registers back to back, so 
+ *                           the inputs are sampled as close together as 
+ *                           possible <--
+ */
+#if DIO_PORT_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_port_snapshot(uint8_t ports_value[]){
+    Std_ReturnType ret = E_OK;
+    if(NULL == ports_value) {
+        ret = E_NOT_OK;
+    }
+    else {
+        ports_value[PORTA_INDEX] = PORTA;
+        ports_value[PORTB_INDEX] = PORTB;
+        ports_value[PORTC_INDEX] = PORTC;
+        ports_value[PORTD_INDEX] = PORTD;
+        ports_value[PORTE_INDEX] = PORTE;
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param _pin_config  : an object describes the pin configurations.
+ * @param logic        : The logic wanted to be written on the pin.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Writes the pin logic in the shadow latch, 
+ *                           the pin changes on the next gpio_commit() <--
+ */
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_shadow_pin_write_logic(const pin_config_t* _pin_config, logic_t logic){
+    Std_ReturnType ret = E_OK;
+    if(NULL == _pin_config || (_pin_config -> pin) > PIN_MAX_NUMBER - 1){
+        ret = E_NOT_OK;
+    }
+    else {
+        switch(logic){
+            case STD_HIGH:
+                SET_BIT(lat_shadow[_pin_config->port], _pin_config->pin);
+                break;
+            case STD_LOW:
+                CLEAR_BIT(lat_shadow[_pin_config->port], _pin_config->pin);
+                break;
+            default: ret = E_NOT_OK;    
+        }
+        if(E_OK == ret){
+            SET_BIT(lat_dirty[_pin_config->port], _pin_config->pin);
+        }
+        else { /* Nothing */ }
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param _pin_config  : an object describes the pin configurations.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Toggles the pin logic in the shadow latch, 
+ *                           the pin changes on the next gpio_commit() <--
+ */
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_shadow_pin_toggle_logic(const pin_config_t* _pin_config){
+    Std_ReturnType ret = E_OK;
+    if(NULL == _pin_config || (_pin_config -> pin) > PIN_MAX_NUMBER - 1){
+        ret = E_NOT_OK;
+    }
+    else {
+        /* A bit not written since the last commit takes its value from LATx */
+        if(!READ_BIT(lat_dirty[_pin_config->port], _pin_config->pin)){
+            if(READ_BIT(*lat_registers[_pin_config->port], _pin_config->pin)){
+                SET_BIT(lat_shadow[_pin_config->port], _pin_config->pin);
+            }
+            else {
+                CLEAR_BIT(lat_shadow[_pin_config->port], _pin_config->pin);
+            }
+            SET_BIT(lat_dirty[_pin_config->port], _pin_config->pin);
+        }
+        else { /* Nothing */ }
+        TOGGLE_BIT(lat_shadow[_pin_config->port], _pin_config->pin);
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @param port         : The port number or name.
+ * @param mask         : The pins of the port to be written (1 : written).
+ * @param value        : The new logic of the masked pins.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Writes the masked pins in the shadow latch, 
+ *                           the pins change on the next gpio_commit() <--
+ */
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_shadow_port_write_masked(const port_index_t port, uint8_t mask, uint8_t value){
+    Std_ReturnType ret = E_OK;
+    if(port > PORT_MAX_NUMBER - 1) {
+        ret = E_NOT_OK;
+    }
+    else {
+        lat_shadow[port] = (uint8_t)((lat_shadow[port] & ~mask) | (value & mask));
+        lat_dirty[port] |= mask;
+    }
+    return ret;
+}
+#endif
+
+/**
+ * 
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ * @brief              : --> Flushes the shadow latches, only the ports with 
+ *                           written bits are touched (one LATx write each) 
+ *                           and only the written bits change <--
+ * @note               : Call it once per control tick, all the outputs 
+ *                       written during the tick change together.
+ */
+#if DIO_SHADOW_LATCH_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType gpio_commit(void){
+    Std_ReturnType ret = E_OK;
+    uint8_t l_port_counter = ZERO_INIT;
+    for( ; l_port_counter < PORT_MAX_NUMBER; ++l_port_counter){
+        if(lat_dirty[l_port_counter]){
+            *lat_registers[l_port_counter] = (uint8_t)((*lat_registers[l_port_counter] & ~lat_dirty[l_port_counter]) 
+                                            | (lat_shadow[l_port_counter] & lat_dirty[l_port_counter]));
+            lat_dirty[l_port_counter] = ZERO_INIT;
+        }
+        else { /* Nothing */ }
+    }
+    return ret;
+}
+#endif
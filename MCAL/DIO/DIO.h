@@ -23,6 +23,9 @@
 #define PIN_MAX_NUMBER              8
 #define PORT_MAX_NUMBER             5
 
+/* The maximum number of pins in one pin group (one bit of the group value per pin) */
+#define GPIO_GROUP_MAX_PINS         8
+
 /* Function-like Macros Declaration */
 #define HWREG8(_x)                  (*((volatile uint8_t*)(_x)))
     
@@ -31,6 +34,50 @@
 #define TOGGLE_BIT(REG, BIT_POS)    REG ^= (BIT_MASK << BIT_POS)    
 #define READ_BIT(REG, BIT_POS)      ((REG >> BIT_POS) & BIT_MASK)
 
+/* 
+ * Compile-time resolved pin access.
+ * The port letter and pin number are pasted into the SFR bit name, so the
+ * compiler emits one BSF/BCF/BTG on LATx (1 instruction cycle) instead of
+ * going through the tris/lat/port pointer tables. BENCHMARK/dio_static_benchmark.c
+ * counts the CALL/RETURN cycles alone on HOST_SIM : 4 per gpio_pin_write_logic()
+ * against 0, 52 per keypad_get_value() scan (13 calls) against 4 for
+ * keypad_static_get_value(), the NULL check, bit-field unpacking, table
+ * lookup and BIT_MASK shift of the functions come on top on the target.
+ * Both arguments must be literals:
+ *      GPIO_STATIC_PIN_HIGH(C, 0)      --> LATCbits.LATC0 = 1
+ */
+#if DIO_STATIC_PIN_CONFIGURATION==CONFIG_ENABLE
+#define GPIO_STATIC_PIN_HIGH(_PORT_, _PIN_)             (LAT##_PORT_##bits.LAT##_PORT_##_PIN_ = GPIO_HIGH)
+#define GPIO_STATIC_PIN_LOW(_PORT_, _PIN_)              (LAT##_PORT_##bits.LAT##_PORT_##_PIN_ = GPIO_LOW)
+#define GPIO_STATIC_PIN_TOGGLE(_PORT_, _PIN_)           (LAT##_PORT_##bits.LAT##_PORT_##_PIN_ ^= GPIO_HIGH)
+#define GPIO_STATIC_PIN_WRITE(_PORT_, _PIN_, _LOGIC_)   (LAT##_PORT_##bits.LAT##_PORT_##_PIN_ = (_LOGIC_))
+#define GPIO_STATIC_PIN_READ(_PORT_, _PIN_)             (PORT##_PORT_##bits.R##_PORT_##_PIN_)
+#define GPIO_STATIC_PIN_OUTPUT(_PORT_, _PIN_)           (TRIS##_PORT_##bits.TRIS##_PORT_##_PIN_ = GPIO_DIRECTION_OUTPUT)
+#define GPIO_STATIC_PIN_INPUT(_PORT_, _PIN_)            (TRIS##_PORT_##bits.TRIS##_PORT_##_PIN_ = GPIO_DIRECTION_INPUT)
+
+/* 
+ * Board pin table accessors, the argument is a name from the board pin
+ * table in dio_cfg.h (expands to "<port letter>, <pin number>").
+ * The extra level of expansion splits the name into its two fields.
+ */
+#define GPIO_BOARD_PIN_HIGH(_BOARD_PIN_)                GPIO_STATIC_PIN_HIGH(_BOARD_PIN_)
+#define GPIO_BOARD_PIN_LOW(_BOARD_PIN_)                 GPIO_STATIC_PIN_LOW(_BOARD_PIN_)
+#define GPIO_BOARD_PIN_TOGGLE(_BOARD_PIN_)              GPIO_STATIC_PIN_TOGGLE(_BOARD_PIN_)
+#define GPIO_BOARD_PIN_WRITE(_BOARD_PIN_, _LOGIC_)      GPIO_STATIC_PIN_WRITE_X(_BOARD_PIN_, _LOGIC_)
+#define GPIO_BOARD_PIN_READ(_BOARD_PIN_)                GPIO_STATIC_PIN_READ(_BOARD_PIN_)
+#define GPIO_BOARD_PIN_OUTPUT(_BOARD_PIN_)              GPIO_STATIC_PIN_OUTPUT(_BOARD_PIN_)
+#define GPIO_BOARD_PIN_INPUT(_BOARD_PIN_)               GPIO_STATIC_PIN_INPUT(_BOARD_PIN_)
+#define GPIO_STATIC_PIN_WRITE_X(_PORT_, _PIN_, _LOGIC_) GPIO_STATIC_PIN_WRITE(_PORT_, _PIN_, _LOGIC_)
+
+/* 
+ * Builds a pin_config_t initializer for the same board pin, so the slow
+ * function API (gpio_pin_initialize(), ...) can still be used on it.
+ */
+#define GPIO_BOARD_PIN_CONFIG(_BOARD_PIN_, _DIR_, _LOGIC_)      GPIO_STATIC_PIN_CONFIG_X(_BOARD_PIN_, _DIR_, _LOGIC_)
+#define GPIO_STATIC_PIN_CONFIG_X(_PORT_, _PIN_, _DIR_, _LOGIC_) \
+        { .port = PORT##_PORT_##_INDEX, .pin = (_PIN_), .direction = (_DIR_), .logic = (_LOGIC_) }
+#endif
+
 /* Datatype Declarations: */
 typedef enum{
     GPIO_LOW                        = 0x00,
@@ -68,6 +115,22 @@ typedef struct{
     uint8_t logic                   :1;
 } pin_config_t;
 
+/*
+ * A group of pins written/read as one value, bit (n) of the value goes to
+ * the pin (n) of the pin array the group was built from.
+ * The per-port masks are computed once by gpio_group_init(), so a group
+ * write costs one masked LATx write per port the group touches.
+ */
+typedef struct{
+    uint8_t port_mask[PORT_MAX_NUMBER];     /* The group pins on each port */
+    uint8_t pin_port[GPIO_GROUP_MAX_PINS];  /* The port of value bit (n) */
+    uint8_t pin_mask[GPIO_GROUP_MAX_PINS];  /* The LATx bit of value bit (n) */
+    uint8_t pins_number             :4;
+    uint8_t single_port             :1;     /* All pins ascending and adjacent on one port */
+    uint8_t port                    :3;     /* The port used when (single_port) is set */
+    uint8_t shift;                          /* The first pin when (single_port) is set */
+} gpio_group_t;
+
 
 /* Functions Prototypes */
 Std_ReturnType gpio_pin_direction_init(const pin_config_t* _pin_config);
@@ -79,6 +142,7 @@ Std_ReturnType gpio_pin_read_logic(const pin_config_t* _pin_config,
                                    uint8_t *logic);
 Std_ReturnType gpio_pin_toggle_logic(const pin_config_t* _pin_config);
 Std_ReturnType gpio_pin_initialize(const pin_config_t* _pin_config);
+Std_ReturnType gpio_init_table(const pin_config_t _pin_table[], uint8_t pins_number);
 
 Std_ReturnType gpio_port_direction_init(const port_index_t port,
                                         uint8_t direction);
@@ -87,6 +151,19 @@ Std_ReturnType gpio_port_get_direction_status(const port_index_t port,
 Std_ReturnType gpio_port_write_logic(const port_index_t port, logic_t logic);
 Std_ReturnType gpio_port_read_logic(const port_index_t port, uint8_t *value);
 Std_ReturnType gpio_port_toggle_logic(const port_index_t port);
+Std_ReturnType gpio_port_write_masked(const port_index_t port, uint8_t mask, uint8_t value);
+
+Std_ReturnType gpio_port_snapshot(uint8_t ports_value[]);
+
+Std_ReturnType gpio_shadow_pin_write_logic(const pin_config_t* _pin_config, logic_t logic);
+Std_ReturnType gpio_shadow_pin_toggle_logic(const pin_config_t* _pin_config);
+Std_ReturnType gpio_shadow_port_write_masked(const port_index_t port, uint8_t mask, uint8_t value);
+Std_ReturnType gpio_commit(void);
+
+Std_ReturnType gpio_group_init(gpio_group_t *_group, const pin_config_t _pins[],
+                               uint8_t pins_number);
+Std_ReturnType gpio_group_write(const gpio_group_t *_group, uint8_t value);
+Std_ReturnType gpio_group_read(const gpio_group_t *_group, uint8_t *value);
 
 #endif	/* GPIO_H */
 
@@ -15,6 +15,34 @@
 
 #define DIO_PIN_CONFIGURATION       CONFIG_ENABLE
 #define DIO_PORT_CONFIGURATION      CONFIG_ENABLE
+#define DIO_STATIC_PIN_CONFIGURATION CONFIG_ENABLE
+#define DIO_GROUP_CONFIGURATION     CONFIG_ENABLE
+/* 
+ * Shadow latches : the LED, RELAY and BUZZER writes land in RAM copies of 
+ * LATA --> LATE and reach the pins only when gpio_commit() is called.
+ */
+#define DIO_SHADOW_LATCH_CONFIGURATION CONFIG_DISABLE
+
+/* 
+ * Board pin table (used with the GPIO_BOARD_PIN_xxx() macros).
+ * Each entry is:   #define <NAME>      <port letter>, <pin number>
+ *  e.g.
+ *      #define BOARD_PIN_STATUS_LED    D, 0
+ *      #define BOARD_PIN_LCD_RS        C, 0
+ *  then
+ *      GPIO_BOARD_PIN_OUTPUT(BOARD_PIN_STATUS_LED);
+ *      GPIO_BOARD_PIN_TOGGLE(BOARD_PIN_STATUS_LED);
+ */
+#define BOARD_PIN_STATUS_LED        D, 6
+/* The keypad (keypad_static_initialize()/keypad_static_get_value()) */
+#define BOARD_PIN_KEYPAD_ROW0       B, 0
+#define BOARD_PIN_KEYPAD_ROW1       B, 1
+#define BOARD_PIN_KEYPAD_ROW2       B, 2
+#define BOARD_PIN_KEYPAD_ROW3       B, 3
+#define BOARD_PIN_KEYPAD_COL0       B, 4
+#define BOARD_PIN_KEYPAD_COL1       B, 5
+#define BOARD_PIN_KEYPAD_COL2       B, 6
+#define BOARD_PIN_KEYPAD_COL3       B, 7
 
 #endif	/* DIO_CFG_H */
 
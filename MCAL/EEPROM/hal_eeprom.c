@@ -7,47 +7,47 @@
 
 /* --------------- Section : Includes --------------- */
 #include "hal_eeprom.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
 
 /*---------------  Section: Functions Definitions --------------- */
 Std_ReturnType EEPROM_write_byte(uint16_t bAdd, uint8_t bData)
 {
     Std_ReturnType ret = E_OK;
-    /* 1.Read the interrupt status */
-    uint8_t interrupt_status = INTCONbits.GIE;
+    critical_state_t l_critical_state = ZERO_INIT;
     
-    /* 2.Update Address Registers */
+    /* 1.Update Address Registers */
     EEADRH = (uint8_t) ((bAdd >> 8) & (0x03));
     EEADR  = (uint8_t) (bAdd & 0xFF);
     
-    /* 3.Update Data Register */
+    /* 2.Update Data Register */
     EEDATA = bData;
     
-    /* 4.Access The EEPROM */
+    /* 3.Access The EEPROM */
     ACCESS_EEPROM();
     ACCESS_EEPROM_FLASH();   
     
-    /* 5.Allow the WR operations on the data EEPROM/Flash Program */
+    /* 4.Allow the WR operations on the data EEPROM/Flash Program */
     ALLOW_EEPROM_FLASH_WRITE();
     
-    /* 6.Disable the General Interrupts */
-    INTERRUPT_GIEH_DISABLE();
+    /* 5.Disable the General Interrupts, only the required sequence is atomic */
+    l_critical_state = Critical_Section_Enter();
     
-    /* 7. Write the required Section from the dataSheet */
+    /* 6. Write the required Section from the dataSheet */
     EECON2 = 0x55;  
     EECON2 = 0xAA;  
     
-    /* 8.Initiate Data EEPROM erase/Write Cycle */
+    /* 7.Initiate Data EEPROM erase/Write Cycle */
     INITIATE_WR_OPERATIONS();
     
+    /* 8.Restore the Interrupt status, the write cycle goes on by itself */
+    Critical_Section_Exit(l_critical_state);
+    
     /* 9.Wait with for the operation to complete */ 
     while(READ_WR());
     
     /* 10.Disable the writes to Flash Program/Data EEPROM */
     INHIBIT_EEPROM_FLASH_WRITE();
     
-    /* 11.Restore the Interrupt status */
-    INTCONbits.GIE = interrupt_status;
-    
     return ret;
 }
 Std_ReturnType EEPROM_read_byte(uint16_t bAdd, uint8_t *bData)
@@ -0,0 +1,1123 @@
+/*
+ * File:   pic18f4620_sim.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> Peripheral models of the host side PIC18F4620 simulation <--
+ */
+
+/* --------------- Section : Includes --------------- */
+#include <string.h>
+#include "pic18f4620_sim.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+#define SIM_ADDR_PORTA          0xF80
+#define SIM_ADDR_PORTB          0xF81
+#define SIM_ADDR_PORTC          0xF82
+#define SIM_ADDR_LATA           0xF89
+#define SIM_ADDR_TRISA          0xF92
+#define SIM_ADDR_PIE1           0xF9D
+#define SIM_ADDR_PIR1           0xF9E
+#define SIM_ADDR_IPR1           0xF9F
+#define SIM_ADDR_PIE2           0xFA0
+#define SIM_ADDR_PIR2           0xFA1
+#define SIM_ADDR_IPR2           0xFA2
+#define SIM_ADDR_EECON1         0xFA6
+#define SIM_ADDR_EEDATA         0xFA8
+#define SIM_ADDR_EEADR          0xFA9
+#define SIM_ADDR_EEADRH         0xFAA
+#define SIM_ADDR_RCSTA          0xFAB
+#define SIM_ADDR_TXSTA          0xFAC
+#define SIM_ADDR_TXREG          0xFAD
+#define SIM_ADDR_RCREG          0xFAE
+#define SIM_ADDR_SPBRG          0xFAF
+#define SIM_ADDR_SPBRGH         0xFB0
+#define SIM_ADDR_T3CON          0xFB1
+#define SIM_ADDR_TMR3L          0xFB2
+#define SIM_ADDR_BAUDCON        0xFB8
+#define SIM_ADDR_CCP2CON        0xFBA
+#define SIM_ADDR_CCPR2L         0xFBB
+#define SIM_ADDR_CCP1CON        0xFBD
+#define SIM_ADDR_CCPR1L         0xFBE
+#define SIM_ADDR_ADCON2         0xFC0
+#define SIM_ADDR_ADCON0         0xFC2
+#define SIM_ADDR_ADRESL         0xFC3
+#define SIM_ADDR_ADRESH         0xFC4
+#define SIM_ADDR_SSPCON2        0xFC5
+#define SIM_ADDR_SSPCON1        0xFC6
+#define SIM_ADDR_SSPSTAT        0xFC7
+#define SIM_ADDR_SSPADD         0xFC8
+#define SIM_ADDR_SSPBUF         0xFC9
+#define SIM_ADDR_T2CON          0xFCA
+#define SIM_ADDR_PR2            0xFCB
+#define SIM_ADDR_TMR2           0xFCC
+#define SIM_ADDR_T1CON          0xFCD
+#define SIM_ADDR_TMR1L          0xFCE
+#define SIM_ADDR_RCON           0xFD0
+#define SIM_ADDR_T0CON          0xFD5
+#define SIM_ADDR_TMR0L          0xFD6
+#define SIM_ADDR_TMR0H          0xFD7
+#define SIM_ADDR_INTCON3        0xFF0
+#define SIM_ADDR_INTCON2        0xFF1
+#define SIM_ADDR_INTCON         0xFF2
+
+#define SIM_NO_EVENT            0xFFFFFFFFFFFFFFFFULL
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+#define SIM_REG(_ADDRESS_)              sim_sfr_file[(_ADDRESS_) - SIM_SFR_FIRST_ADDRESS]
+#define SIM_REG16(_ADDRESS_)            ((unsigned short)(SIM_REG(_ADDRESS_) | (SIM_REG((_ADDRESS_) + 1) << 8)))
+#define SIM_BIT(_ADDRESS_, _BIT_)       ((SIM_REG(_ADDRESS_) >> (_BIT_)) & 1U)
+#define SIM_SET(_ADDRESS_, _BIT_)       (SIM_REG(_ADDRESS_) |= (unsigned char)(1U << (_BIT_)))
+#define SIM_CLR(_ADDRESS_, _BIT_)       (SIM_REG(_ADDRESS_) &= (unsigned char)~(1U << (_BIT_)))
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef struct {
+    unsigned short flag_address;
+    unsigned char  flag_bit;
+    unsigned short enable_address;
+    unsigned char  enable_bit;
+    unsigned short priority_address;    /* 0 : always high priority (INT0) */
+    unsigned char  priority_bit;
+    unsigned char  peripheral;          /* Needs PEIE when the priorities are off */
+} sim_interrupt_source_t;
+
+/* --------------- Section: Global Variables --------------- */
+volatile unsigned char sim_sfr_file[SIM_SFR_FILE_SIZE];
+
+/* The interrupt vectors, weak so a test can link without the interrupt manager */
+extern void InterruptManagerHigh(void) __attribute__((weak));
+extern void InterruptManagerLow(void) __attribute__((weak));
+extern void InterruptManager(void) __attribute__((weak));
+
+static unsigned long long sim_cycles;
+
+/* Called after every instruction cycle (NULL : none), a test samples the pins with it */
+static void (*sim_tick_hook)(void);
+
+/* The last register accessed through sim_sfr_access(), processed on the next access */
+static unsigned int  sim_pending_address;
+static unsigned char sim_pending_value;
+
+/* The logic driven on the input pins by the outside world */
+static unsigned char sim_pin_level[SIM_PORTS_NUMBER];
+static unsigned char sim_ccp_pin[2];
+
+static unsigned long sim_calls;
+
+static unsigned char sim_in_high_isr;
+static unsigned char sim_in_low_isr;
+
+static unsigned int  sim_tmr0_prescaler;
+static unsigned int  sim_tmr1_prescaler;
+static unsigned int  sim_tmr2_prescaler;
+static unsigned int  sim_tmr2_postscaler;
+static unsigned int  sim_tmr3_prescaler;
+/* The counts left by the timer models, a different register value is a write
+ * of the program, which clears the prescaler counter (TMR2 : and the postscaler) */
+static unsigned short sim_tmr0_count;
+static unsigned short sim_tmr1_count;
+static unsigned char  sim_tmr2_count;
+static unsigned short sim_tmr3_count;
+static unsigned char sim_ccp_capture_count[2];
+
+static unsigned char sim_uart_rx_fifo[SIM_UART_BUFFER_SIZE];
+static unsigned int  sim_uart_rx_head, sim_uart_rx_tail;
+static unsigned long long sim_uart_rx_done_at;
+static unsigned char sim_uart_tx_log[SIM_UART_BUFFER_SIZE];
+static unsigned int  sim_uart_tx_head, sim_uart_tx_tail;
+static unsigned char sim_uart_tsr;
+static unsigned char sim_uart_txreg_full;
+static unsigned long long sim_uart_tx_done_at;
+
+static unsigned char sim_spi_miso[SIM_UART_BUFFER_SIZE];
+static unsigned int  sim_spi_miso_size, sim_spi_miso_index;
+static unsigned long long sim_mssp_done_at;
+static unsigned char sim_mssp_event;
+static unsigned char sim_i2c_rx[SIM_UART_BUFFER_SIZE];
+static unsigned int  sim_i2c_rx_size, sim_i2c_rx_index;
+static unsigned char sim_i2c_nack;
+
+static unsigned short sim_adc_input[SIM_ADC_CHANNELS];
+static unsigned long long sim_adc_done_at;
+
+static unsigned char sim_eeprom[SIM_EEPROM_SIZE];
+static unsigned long long sim_eeprom_done_at;
+
+static const sim_interrupt_source_t sim_interrupt_sources[] = {
+    {SIM_ADDR_INTCON,  1, SIM_ADDR_INTCON,  4, 0,                0, 0},     /* INT0 */
+    {SIM_ADDR_INTCON3, 0, SIM_ADDR_INTCON3, 3, SIM_ADDR_INTCON3, 6, 0},     /* INT1 */
+    {SIM_ADDR_INTCON3, 1, SIM_ADDR_INTCON3, 4, SIM_ADDR_INTCON3, 7, 0},     /* INT2 */
+    {SIM_ADDR_INTCON,  2, SIM_ADDR_INTCON,  5, SIM_ADDR_INTCON2, 2, 0},     /* TMR0 */
+    {SIM_ADDR_INTCON,  0, SIM_ADDR_INTCON,  3, SIM_ADDR_INTCON2, 0, 0},     /* RB */
+    {SIM_ADDR_PIR1,    0, SIM_ADDR_PIE1,    0, SIM_ADDR_IPR1,    0, 1},     /* TMR1 */
+    {SIM_ADDR_PIR1,    1, SIM_ADDR_PIE1,    1, SIM_ADDR_IPR1,    1, 1},     /* TMR2 */
+    {SIM_ADDR_PIR1,    2, SIM_ADDR_PIE1,    2, SIM_ADDR_IPR1,    2, 1},     /* CCP1 */
+    {SIM_ADDR_PIR1,    3, SIM_ADDR_PIE1,    3, SIM_ADDR_IPR1,    3, 1},     /* SSP */
+    {SIM_ADDR_PIR1,    4, SIM_ADDR_PIE1,    4, SIM_ADDR_IPR1,    4, 1},     /* TX */
+    {SIM_ADDR_PIR1,    5, SIM_ADDR_PIE1,    5, SIM_ADDR_IPR1,    5, 1},     /* RC */
+    {SIM_ADDR_PIR1,    6, SIM_ADDR_PIE1,    6, SIM_ADDR_IPR1,    6, 1},     /* AD */
+    {SIM_ADDR_PIR2,    0, SIM_ADDR_PIE2,    0, SIM_ADDR_IPR2,    0, 1},     /* CCP2 */
+    {SIM_ADDR_PIR2,    1, SIM_ADDR_PIE2,    1, SIM_ADDR_IPR2,    1, 1},     /* TMR3 */
+    {SIM_ADDR_PIR2,    3, SIM_ADDR_PIE2,    3, SIM_ADDR_IPR2,    3, 1},     /* BCL */
+    {SIM_ADDR_PIR2,    4, SIM_ADDR_PIE2,    4, SIM_ADDR_IPR2,    4, 1},     /* EE */
+};
+
+/* --------------- Section: Helper Functions Declarations --------------- */
+static void sim_process_pending(void);
+static void sim_advance(unsigned long cycles);
+static void sim_tick(void);
+static void sim_refresh_ports(void);
+static void sim_service_interrupts(void);
+static unsigned char sim_interrupt_pending(unsigned char priority);
+static void sim_timer0_tick(void);
+static void sim_timer13_tick(unsigned int con_address, unsigned int tmr_address,
+                             unsigned int *prescaler, unsigned short *count, unsigned char flag_bit_pir,
+                             unsigned int pir_address, unsigned char timer_index);
+static void sim_timer2_tick(void);
+static void sim_ccp_compare(unsigned char ccp, unsigned char timer_index, unsigned short value);
+static unsigned char sim_ccp_timer(unsigned char ccp);
+static void sim_uart_tick(void);
+static unsigned long sim_uart_frame_cycles(void);
+static void sim_mssp_access_buffer(void);
+static void sim_mssp_access_con2(void);
+static void sim_mssp_tick(void);
+static unsigned long sim_mssp_bit_cycles(void);
+static void sim_adc_start(void);
+static void sim_adc_tick(void);
+static void sim_eeprom_access(void);
+static void sim_eeprom_tick(void);
+
+void __cyg_profile_func_enter(void *function, void *call_site) __attribute__((no_instrument_function));
+void __cyg_profile_func_exit(void *function, void *call_site) __attribute__((no_instrument_function));
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ * @brief : The access hook of every hooked register, processes the previous
+ *          access, advances the time by SIM_SFR_ACCESS_CYCLES and returns
+ *          the register location.
+ * @param address : The register address (0xF80 --> 0xFFF).
+ * @return The register location in the register file.
+ */
+volatile unsigned char *sim_sfr_access(unsigned int address)
+{
+    sim_process_pending();
+    sim_advance(SIM_SFR_ACCESS_CYCLES);
+    sim_pending_address = address;
+    sim_pending_value = SIM_REG(address);
+    return &SIM_REG(address);
+}
+
+/**
+ * @brief : The access hook of a register read through a pointer, charges
+ *          the pointer load (SIM_SFR_POINTER_LOAD_CYCLES) then the access.
+ * @param pointer : The register location in the register file.
+ * @return The register location in the register file.
+ */
+volatile unsigned char *sim_sfr_indirect(volatile unsigned char *pointer)
+{
+    sim_process_pending();
+    sim_advance(SIM_SFR_POINTER_LOAD_CYCLES);
+    return sim_sfr_access((unsigned int)(pointer - sim_sfr_file) + SIM_SFR_FIRST_ADDRESS);
+}
+
+/**
+ * @brief : Puts the register file and all the models in their reset state.
+ */
+__attribute__((constructor)) void sim_reset(void)
+{
+    memset((void *)sim_sfr_file, 0, sizeof(sim_sfr_file));
+    SIM_REG(SIM_ADDR_TRISA + 0) = 0xFF;
+    SIM_REG(SIM_ADDR_TRISA + 1) = 0xFF;
+    SIM_REG(SIM_ADDR_TRISA + 2) = 0xFF;
+    SIM_REG(SIM_ADDR_TRISA + 3) = 0xFF;
+    SIM_REG(SIM_ADDR_TRISA + 4) = 0x07;
+    SIM_REG(SIM_ADDR_IPR1) = 0xFF;
+    SIM_REG(SIM_ADDR_IPR2) = 0xDF;
+    SIM_REG(SIM_ADDR_TXSTA) = 0x02;
+    SIM_REG(SIM_ADDR_BAUDCON) = 0x40;
+    SIM_REG(SIM_ADDR_PR2) = 0xFF;
+    SIM_REG(SIM_ADDR_T0CON) = 0xFF;
+    SIM_REG(SIM_ADDR_INTCON2) = 0xF5;
+    SIM_REG(SIM_ADDR_INTCON3) = 0xC0;
+    SIM_REG(SIM_ADDR_RCON) = 0x1C;
+    memset(sim_pin_level, 0, sizeof(sim_pin_level));
+    memset(sim_ccp_pin, 0, sizeof(sim_ccp_pin));
+    memset(sim_ccp_capture_count, 0, sizeof(sim_ccp_capture_count));
+    memset(sim_adc_input, 0, sizeof(sim_adc_input));
+    memset(sim_eeprom, 0xFF, sizeof(sim_eeprom));
+    sim_cycles = 0;
+    sim_calls = 0;
+    sim_pending_address = 0;
+    sim_in_high_isr = 0;
+    sim_in_low_isr = 0;
+    sim_tmr0_prescaler = sim_tmr1_prescaler = sim_tmr3_prescaler = 0;
+    sim_tmr2_prescaler = sim_tmr2_postscaler = 0;
+    sim_tmr0_count = sim_tmr1_count = sim_tmr3_count = 0;
+    sim_tmr2_count = 0;
+    sim_uart_rx_head = sim_uart_rx_tail = 0;
+    sim_uart_tx_head = sim_uart_tx_tail = 0;
+    sim_uart_txreg_full = 0;
+    sim_uart_rx_done_at = sim_uart_tx_done_at = SIM_NO_EVENT;
+    sim_spi_miso_size = sim_spi_miso_index = 0;
+    sim_i2c_rx_size = sim_i2c_rx_index = 0;
+    sim_i2c_nack = 0;
+    sim_mssp_done_at = SIM_NO_EVENT;
+    sim_mssp_event = 0;
+    sim_adc_done_at = SIM_NO_EVENT;
+    sim_eeprom_done_at = SIM_NO_EVENT;
+}
+
+/**
+ * @brief : Processes the last register access and refreshes the PORTx
+ *          registers without advancing the time.
+ */
+void sim_sync(void)
+{
+    sim_process_pending();
+    sim_refresh_ports();
+}
+
+/**
+ * @brief : Advances the simulated time, the interrupts are served on the way.
+ * @param cycles : The number of instruction cycles.
+ */
+void sim_delay_cycles(unsigned long cycles)
+{
+    sim_process_pending();
+    sim_advance(cycles);
+}
+
+/**
+ * @brief : Reads the simulated time.
+ * @return The instruction cycles since the last reset.
+ */
+unsigned long long sim_get_cycles(void)
+{
+    return sim_cycles;
+}
+
+/**
+ * @brief : Reads the number of the function calls charged by the call cost
+ *          model, stays 0 in a build without -finstrument-functions.
+ * @return The function calls since the last reset.
+ */
+unsigned long sim_get_calls(void)
+{
+    return sim_calls;
+}
+
+/**
+ * @brief : Sets a function called after every instruction cycle, inside
+ *          the interrupt routines too. It sees a pin written between two
+ *          register accesses at the cycle of the next access.
+ *          It must not access the registers through sim_sfr_access()
+ *          (read LATx/PORTx or SIM_SFR_DIRECT()).
+ * @param hook : The function, NULL removes it (sim_reset() keeps it).
+ */
+void sim_set_tick_hook(void (*hook)(void))
+{
+    sim_tick_hook = hook;
+}
+
+/**
+ * @brief : The call cost model, gcc calls it at the entry of every function
+ *          of an -finstrument-functions build, charges the CALL instruction.
+ * @param function : The called function (unused).
+ * @param call_site : The return address (unused).
+ */
+void __cyg_profile_func_enter(void *function, void *call_site)
+{
+    (void)function;
+    (void)call_site;
+    ++sim_calls;
+    sim_delay_cycles(SIM_CALL_CYCLES);
+}
+
+/**
+ * @brief : The call cost model, charges the RETURN instruction.
+ * @param function : The called function (unused).
+ * @param call_site : The return address (unused).
+ */
+void __cyg_profile_func_exit(void *function, void *call_site)
+{
+    (void)function;
+    (void)call_site;
+    sim_delay_cycles(SIM_RETURN_CYCLES);
+}
+
+/**
+ * @brief : Drives an input pin from the outside world, raises the INT0-2 and
+ *          the RB4-RB7 change interrupts flags.
+ * @param port : 0 (PORTA) --> 4 (PORTE).
+ * @param pin : 0 --> 7.
+ * @param logic : The new pin logic.
+ */
+void sim_pin_input(unsigned char port, unsigned char pin, unsigned char logic)
+{
+    unsigned char old_logic = 0;
+    if((port < SIM_PORTS_NUMBER) && (pin < 8))
+    {
+        old_logic = (sim_pin_level[port] >> pin) & 1U;
+        logic = logic ? 1U : 0U;
+        if(logic)
+            { sim_pin_level[port] |= (unsigned char)(1U << pin); }
+        else
+            { sim_pin_level[port] &= (unsigned char)~(1U << pin); }
+        if((1 == port) && (old_logic != logic) && SIM_BIT(SIM_ADDR_TRISA + 1, pin))
+        {
+            /* INTx : edge selected by INTEDGx (INTCON2 6, 5, 4) */
+            if((0 == pin) && (logic == SIM_BIT(SIM_ADDR_INTCON2, 6)))
+                { SIM_SET(SIM_ADDR_INTCON, 1); }
+            else if((1 == pin) && (logic == SIM_BIT(SIM_ADDR_INTCON2, 5)))
+                { SIM_SET(SIM_ADDR_INTCON3, 0); }
+            else if((2 == pin) && (logic == SIM_BIT(SIM_ADDR_INTCON2, 4)))
+                { SIM_SET(SIM_ADDR_INTCON3, 1); }
+            else if(pin >= 4)
+                { SIM_SET(SIM_ADDR_INTCON, 0); }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+        sim_refresh_ports();
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief : Applies an edge on a CCP pin configured in capture mode.
+ * @param ccp : 1 or 2.
+ * @param rising : 1 for a rising edge, 0 for a falling edge.
+ */
+void sim_ccp_capture_edge(unsigned char ccp, unsigned char rising)
+{
+    unsigned int con_address = (1 == ccp) ? SIM_ADDR_CCP1CON : SIM_ADDR_CCP2CON;
+    unsigned int ccpr_address = (1 == ccp) ? SIM_ADDR_CCPR1L : SIM_ADDR_CCPR2L;
+    unsigned char mode = SIM_REG(con_address) & 0x0F;
+    unsigned char every = 0;
+    unsigned short value = 0;
+    sim_process_pending();
+    switch(mode)
+    {
+        case 0x04: every = rising ? 0 : 1;  break;
+        case 0x05: every = rising ? 1 : 0;  break;
+        case 0x06: every = rising ? 4 : 0;  break;
+        case 0x07: every = rising ? 16 : 0; break;
+        default:   every = 0;               break;
+    }
+    if(every)
+    {
+        if(++sim_ccp_capture_count[ccp - 1] >= every)
+        {
+            sim_ccp_capture_count[ccp - 1] = 0;
+            value = sim_ccp_timer(ccp) ? SIM_REG16(SIM_ADDR_TMR3L) : SIM_REG16(SIM_ADDR_TMR1L);
+            SIM_REG(ccpr_address) = (unsigned char)value;
+            SIM_REG(ccpr_address + 1) = (unsigned char)(value >> 8);
+            if(1 == ccp)
+                { SIM_SET(SIM_ADDR_PIR1, 2); }
+            else
+                { SIM_SET(SIM_ADDR_PIR2, 0); }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief : Queues a byte on the EUSART RX line, it is received one frame
+ *          time later (after the previous queued bytes).
+ * @param data : The received byte.
+ */
+void sim_uart_rx_push(unsigned char data)
+{
+    sim_uart_rx_fifo[sim_uart_rx_head] = data;
+    sim_uart_rx_head = (sim_uart_rx_head + 1) % SIM_UART_BUFFER_SIZE;
+}
+
+/**
+ * @brief : Takes the bytes transmitted on the EUSART TX line.
+ * @param buffer : The destination buffer.
+ * @param size : The buffer size.
+ * @return The number of bytes copied.
+ */
+unsigned int sim_uart_tx_pop(unsigned char *buffer, unsigned int size)
+{
+    unsigned int count = 0;
+    sim_process_pending();
+    while((sim_uart_tx_tail != sim_uart_tx_head) && (count < size))
+    {
+        buffer[count++] = sim_uart_tx_log[sim_uart_tx_tail];
+        sim_uart_tx_tail = (sim_uart_tx_tail + 1) % SIM_UART_BUFFER_SIZE;
+    }
+    return count;
+}
+
+/**
+ * @brief : Sets the bytes shifted in by the next SPI transfers, when they run
+ *          out the transmitted byte is looped back.
+ */
+void sim_spi_set_miso(const unsigned char *data, unsigned int size)
+{
+    sim_spi_miso_size = (size > SIM_UART_BUFFER_SIZE) ? SIM_UART_BUFFER_SIZE : size;
+    sim_spi_miso_index = 0;
+    memcpy(sim_spi_miso, data, sim_spi_miso_size);
+}
+
+/**
+ * @brief : Sets the bytes returned by the next I2C master receptions.
+ */
+void sim_i2c_set_rx(const unsigned char *data, unsigned int size)
+{
+    sim_i2c_rx_size = (size > SIM_UART_BUFFER_SIZE) ? SIM_UART_BUFFER_SIZE : size;
+    sim_i2c_rx_index = 0;
+    memcpy(sim_i2c_rx, data, sim_i2c_rx_size);
+}
+
+/**
+ * @brief : Selects the acknowledge of the I2C slave (0 : ACK, 1 : NACK).
+ */
+void sim_i2c_set_nack(unsigned char nack)
+{
+    sim_i2c_nack = nack ? 1U : 0U;
+}
+
+/**
+ * @brief : Sets the 10-bit value converted on an ADC channel.
+ */
+void sim_adc_set_input(unsigned char channel, unsigned short value)
+{
+    if(channel < SIM_ADC_CHANNELS)
+        { sim_adc_input[channel] = value & 0x3FF; }
+    else { /* Nothing */ }
+}
+
+/**
+ * @brief : Reads the data EEPROM content without going through the registers.
+ */
+unsigned char sim_eeprom_peek(unsigned int address)
+{
+    sim_process_pending();
+    return sim_eeprom[address % SIM_EEPROM_SIZE];
+}
+
+/*---------------  Section: Helper Functions --------------- */
+static void sim_process_pending(void)
+{
+    unsigned int address = sim_pending_address;
+    sim_pending_address = 0;
+    switch(address)
+    {
+        case SIM_ADDR_TXREG:
+            if(SIM_BIT(SIM_ADDR_TXSTA, 5))
+            {
+                if(SIM_NO_EVENT == sim_uart_tx_done_at)
+                {
+                    sim_uart_tsr = SIM_REG(SIM_ADDR_TXREG);
+                    sim_uart_tx_done_at = sim_cycles + sim_uart_frame_cycles();
+                    SIM_CLR(SIM_ADDR_TXSTA, 1);
+                }
+                else
+                {
+                    sim_uart_txreg_full = 1;
+                    SIM_CLR(SIM_ADDR_PIR1, 4);
+                }
+            }
+            else { /* Nothing */ }
+            break;
+        case SIM_ADDR_RCREG:
+            SIM_CLR(SIM_ADDR_PIR1, 5);
+            break;
+        case SIM_ADDR_SSPBUF:
+            sim_mssp_access_buffer();
+            break;
+        case SIM_ADDR_SSPCON2:
+            sim_mssp_access_con2();
+            break;
+        case SIM_ADDR_ADCON0:
+            if(SIM_BIT(SIM_ADDR_ADCON0, 1) && (SIM_NO_EVENT == sim_adc_done_at))
+                { sim_adc_start(); }
+            else { /* Nothing */ }
+            break;
+        case SIM_ADDR_EECON1:
+            sim_eeprom_access();
+            break;
+        default:
+            break;
+    }
+}
+
+static void sim_advance(unsigned long cycles)
+{
+    while(cycles--)
+    {
+        sim_tick();
+        sim_service_interrupts();
+    }
+    sim_refresh_ports();
+}
+
+static void sim_tick(void)
+{
+    ++sim_cycles;
+    sim_timer0_tick();
+    sim_timer13_tick(SIM_ADDR_T1CON, SIM_ADDR_TMR1L, &sim_tmr1_prescaler, &sim_tmr1_count, 0, SIM_ADDR_PIR1, 1);
+    sim_timer2_tick();
+    sim_timer13_tick(SIM_ADDR_T3CON, SIM_ADDR_TMR3L, &sim_tmr3_prescaler, &sim_tmr3_count, 1, SIM_ADDR_PIR2, 3);
+    sim_uart_tick();
+    sim_mssp_tick();
+    sim_adc_tick();
+    sim_eeprom_tick();
+    if(sim_tick_hook)
+        { sim_tick_hook(); }
+    else { /* Nothing */ }
+}
+
+static void sim_refresh_ports(void)
+{
+    unsigned char port = 0;
+    unsigned char value = 0;
+    for( ; port < SIM_PORTS_NUMBER; ++port)
+    {
+        value = (unsigned char)((SIM_REG(SIM_ADDR_LATA + port) & ~SIM_REG(SIM_ADDR_TRISA + port))
+                               | (sim_pin_level[port] & SIM_REG(SIM_ADDR_TRISA + port)));
+        if(2 == port)
+        {
+            /* The CCP outputs (RC2 : CCP1, RC1 : CCP2) override the latch */
+            if(((SIM_REG(SIM_ADDR_CCP1CON) & 0x0F) >= 0x08) && !SIM_BIT(SIM_ADDR_TRISA + 2, 2))
+                { value = (unsigned char)((value & ~0x04) | (sim_ccp_pin[0] << 2)); }
+            else { /* Nothing */ }
+            if(((SIM_REG(SIM_ADDR_CCP2CON) & 0x0F) >= 0x08) && !SIM_BIT(SIM_ADDR_TRISA + 2, 1))
+                { value = (unsigned char)((value & ~0x02) | (sim_ccp_pin[1] << 1)); }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+        SIM_REG(SIM_ADDR_PORTA + port) = value;
+    }
+}
+
+static unsigned char sim_interrupt_pending(unsigned char priority)
+{
+    unsigned char pending = 0;
+    unsigned int index = 0;
+    const sim_interrupt_source_t *source = NULL;
+    for( ; (index < sizeof(sim_interrupt_sources) / sizeof(sim_interrupt_sources[0])) && !pending; ++index)
+    {
+        source = &sim_interrupt_sources[index];
+        if(SIM_BIT(source->flag_address, source->flag_bit) && SIM_BIT(source->enable_address, source->enable_bit))
+        {
+            if(!SIM_BIT(SIM_ADDR_RCON, 7))
+            {
+                /* Compatibility mode : one vector, the peripherals need PEIE */
+                pending = (!source->peripheral) || SIM_BIT(SIM_ADDR_INTCON, 6);
+            }
+            else if(0 == source->priority_address)
+            {
+                pending = priority;
+            }
+            else
+            {
+                pending = (SIM_BIT(source->priority_address, source->priority_bit) == priority);
+            }
+        }
+        else { /* Nothing */ }
+    }
+    return pending;
+}
+
+static void sim_service_interrupts(void)
+{
+    unsigned char l_tick = 0;
+    if(SIM_BIT(SIM_ADDR_RCON, 7))
+    {
+        if(!sim_in_high_isr && SIM_BIT(SIM_ADDR_INTCON, 7) && sim_interrupt_pending(1)
+                            && InterruptManagerHigh)
+        {
+            sim_in_high_isr = 1;
+            SIM_CLR(SIM_ADDR_INTCON, 7);
+            for(l_tick = 0; l_tick < SIM_INTERRUPT_LATENCY_CYCLES; ++l_tick)
+                { sim_tick(); }
+            InterruptManagerHigh();
+            sim_process_pending();
+            SIM_SET(SIM_ADDR_INTCON, 7);
+            sim_in_high_isr = 0;
+        }
+        else if(!sim_in_high_isr && !sim_in_low_isr && SIM_BIT(SIM_ADDR_INTCON, 7)
+                            && SIM_BIT(SIM_ADDR_INTCON, 6) && sim_interrupt_pending(0)
+                            && InterruptManagerLow)
+        {
+            /* A high priority interrupt can still preempt this one */
+            sim_in_low_isr = 1;
+            SIM_CLR(SIM_ADDR_INTCON, 6);
+            for(l_tick = 0; l_tick < SIM_INTERRUPT_LATENCY_CYCLES; ++l_tick)
+                { sim_tick(); }
+            InterruptManagerLow();
+            sim_process_pending();
+            SIM_SET(SIM_ADDR_INTCON, 6);
+            sim_in_low_isr = 0;
+        }
+        else { /* Nothing */ }
+    }
+    else
+    {
+        if(!sim_in_high_isr && SIM_BIT(SIM_ADDR_INTCON, 7) && sim_interrupt_pending(1)
+                            && InterruptManager)
+        {
+            sim_in_high_isr = 1;
+            SIM_CLR(SIM_ADDR_INTCON, 7);
+            for(l_tick = 0; l_tick < SIM_INTERRUPT_LATENCY_CYCLES; ++l_tick)
+                { sim_tick(); }
+            InterruptManager();
+            sim_process_pending();
+            SIM_SET(SIM_ADDR_INTCON, 7);
+            sim_in_high_isr = 0;
+        }
+        else { /* Nothing */ }
+    }
+}
+
+static void sim_timer0_tick(void)
+{
+    unsigned char t0con = SIM_REG(SIM_ADDR_T0CON);
+    unsigned int prescaler = (t0con & 0x08) ? 1U : (2U << (t0con & 0x07));
+    unsigned short value = (t0con & 0x40) ? SIM_REG(SIM_ADDR_TMR0L) : SIM_REG16(SIM_ADDR_TMR0L);
+    /* A write to TMR0 clears the prescaler counter */
+    if(value != sim_tmr0_count)
+        { sim_tmr0_prescaler = 0; }
+    else { /* Nothing */ }
+    /* TMR0ON and the internal clock (T0CS = 0) */
+    if((t0con & 0x80) && !(t0con & 0x20))
+    {
+        if(++sim_tmr0_prescaler >= prescaler)
+        {
+            sim_tmr0_prescaler = 0;
+            if(t0con & 0x40)
+            {
+                if(0 == ++SIM_REG(SIM_ADDR_TMR0L))
+                    { SIM_SET(SIM_ADDR_INTCON, 2); }
+                else { /* Nothing */ }
+            }
+            else
+            {
+                value = (unsigned short)(SIM_REG16(SIM_ADDR_TMR0L) + 1U);
+                SIM_REG(SIM_ADDR_TMR0L) = (unsigned char)value;
+                SIM_REG(SIM_ADDR_TMR0H) = (unsigned char)(value >> 8);
+                if(0 == value)
+                    { SIM_SET(SIM_ADDR_INTCON, 2); }
+                else { /* Nothing */ }
+            }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+    sim_tmr0_count = (t0con & 0x40) ? SIM_REG(SIM_ADDR_TMR0L) : SIM_REG16(SIM_ADDR_TMR0L);
+}
+
+static void sim_timer13_tick(unsigned int con_address, unsigned int tmr_address,
+                             unsigned int *prescaler, unsigned short *count, unsigned char flag_bit_pir,
+                             unsigned int pir_address, unsigned char timer_index)
+{
+    unsigned char con = SIM_REG(con_address);
+    unsigned short value = 0;
+    /* A write to TMRx clears the prescaler counter */
+    if(SIM_REG16(tmr_address) != *count)
+        { *prescaler = 0; }
+    else { /* Nothing */ }
+    /* TMRxON and the internal clock (TMRxCS = 0) */
+    if((con & 0x01) && !(con & 0x02))
+    {
+        if(++(*prescaler) >= (1U << ((con >> 4) & 0x03)))
+        {
+            *prescaler = 0;
+            value = (unsigned short)(SIM_REG16(tmr_address) + 1U);
+            SIM_REG(tmr_address) = (unsigned char)value;
+            SIM_REG(tmr_address + 1) = (unsigned char)(value >> 8);
+            if(0 == value)
+            {
+                SIM_SET(pir_address, flag_bit_pir);
+            }
+            else { /* Nothing */ }
+            /* The CCP modules compare on the timer they select (0 : TIMER1, 1 : TIMER3) */
+            if(sim_ccp_timer(1) == ((3 == timer_index) ? 1U : 0U))
+                { sim_ccp_compare(1, timer_index, value); }
+            else { /* Nothing */ }
+            if(sim_ccp_timer(2) == ((3 == timer_index) ? 1U : 0U))
+                { sim_ccp_compare(2, timer_index, value); }
+            else { /* Nothing */ }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+    /* (After the compares, the special event trigger reset isn't a write) */
+    *count = SIM_REG16(tmr_address);
+}
+
+/* 0 : the CCP module runs on TIMER1, 1 : on TIMER3 */
+static unsigned char sim_ccp_timer(unsigned char ccp)
+{
+    unsigned char select = (unsigned char)((SIM_BIT(SIM_ADDR_T3CON, 6) << 1) | SIM_BIT(SIM_ADDR_T3CON, 3));
+    unsigned char timer3 = 0;
+    if(select >= 2)
+        { timer3 = 1; }
+    else if(1 == select)
+        { timer3 = (2 == ccp) ? 1U : 0U; }
+    else
+        { timer3 = 0; }
+    return timer3;
+}
+
+static void sim_ccp_compare(unsigned char ccp, unsigned char timer_index, unsigned short value)
+{
+    unsigned int con_address = (1 == ccp) ? SIM_ADDR_CCP1CON : SIM_ADDR_CCP2CON;
+    unsigned int ccpr_address = (1 == ccp) ? SIM_ADDR_CCPR1L : SIM_ADDR_CCPR2L;
+    unsigned int tmr_address = (1 == timer_index) ? SIM_ADDR_TMR1L : SIM_ADDR_TMR3L;
+    unsigned char mode = SIM_REG(con_address) & 0x0F;
+    if(((0x02 == mode) || ((mode >= 0x08) && (mode <= 0x0B))) && (value == SIM_REG16(ccpr_address)))
+    {
+        if(1 == ccp)
+            { SIM_SET(SIM_ADDR_PIR1, 2); }
+        else
+            { SIM_SET(SIM_ADDR_PIR2, 0); }
+        switch(mode)
+        {
+            case 0x02: sim_ccp_pin[ccp - 1] ^= 1U; break;
+            case 0x08: sim_ccp_pin[ccp - 1] = 1U;  break;
+            case 0x09: sim_ccp_pin[ccp - 1] = 0U;  break;
+            case 0x0B:
+                /* Special event trigger : resets the timer (CCP2 also starts the ADC) */
+                SIM_REG(tmr_address) = 0;
+                SIM_REG(tmr_address + 1) = 0;
+                if((2 == ccp) && SIM_BIT(SIM_ADDR_ADCON0, 0) && (SIM_NO_EVENT == sim_adc_done_at))
+                {
+                    SIM_SET(SIM_ADDR_ADCON0, 1);
+                    sim_adc_start();
+                }
+                else { /* Nothing */ }
+                break;
+            default: break;
+        }
+    }
+    else { /* Nothing */ }
+}
+
+static void sim_timer2_tick(void)
+{
+    static const unsigned char prescalers[4] = {1, 4, 16, 16};
+    unsigned char t2con = SIM_REG(SIM_ADDR_T2CON);
+    /* A write to TMR2 clears the prescaler and the postscaler counters */
+    if(SIM_REG(SIM_ADDR_TMR2) != sim_tmr2_count)
+    {
+        sim_tmr2_prescaler = 0;
+        sim_tmr2_postscaler = 0;
+    }
+    else { /* Nothing */ }
+    if(t2con & 0x04)
+    {
+        if(++sim_tmr2_prescaler >= prescalers[t2con & 0x03])
+        {
+            sim_tmr2_prescaler = 0;
+            if(SIM_REG(SIM_ADDR_TMR2) == SIM_REG(SIM_ADDR_PR2))
+            {
+                SIM_REG(SIM_ADDR_TMR2) = 0;
+                /* A new PWM period : the duty cycles are latched (CCPRxL --> CCPRxH) */
+                if(0x0C == (SIM_REG(SIM_ADDR_CCP1CON) & 0x0C))
+                    { SIM_REG(SIM_ADDR_CCPR1L + 1) = SIM_REG(SIM_ADDR_CCPR1L); }
+                else { /* Nothing */ }
+                if(0x0C == (SIM_REG(SIM_ADDR_CCP2CON) & 0x0C))
+                    { SIM_REG(SIM_ADDR_CCPR2L + 1) = SIM_REG(SIM_ADDR_CCPR2L); }
+                else { /* Nothing */ }
+                if(++sim_tmr2_postscaler > ((t2con >> 3) & 0x0F))
+                {
+                    sim_tmr2_postscaler = 0;
+                    SIM_SET(SIM_ADDR_PIR1, 1);
+                }
+                else { /* Nothing */ }
+            }
+            else
+            {
+                ++SIM_REG(SIM_ADDR_TMR2);
+            }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+    sim_tmr2_count = SIM_REG(SIM_ADDR_TMR2);
+}
+
+static unsigned long sim_uart_frame_cycles(void)
+{
+    unsigned long multiplier = 0;
+    unsigned long divisor = 0;
+    unsigned char brgh = SIM_BIT(SIM_ADDR_TXSTA, 2);
+    unsigned char brg16 = SIM_BIT(SIM_ADDR_BAUDCON, 3);
+    if(brg16)
+    {
+        multiplier = brgh ? 4UL : 16UL;
+        divisor = ((unsigned long)SIM_REG(SIM_ADDR_SPBRGH) << 8) | SIM_REG(SIM_ADDR_SPBRG);
+    }
+    else
+    {
+        multiplier = brgh ? 16UL : 64UL;
+        divisor = SIM_REG(SIM_ADDR_SPBRG);
+    }
+    /* One start bit, 8 (9) data bits and one stop bit, Fosc / 4 per cycle */
+    return ((SIM_BIT(SIM_ADDR_TXSTA, 6) ? 11UL : 10UL) * multiplier * (divisor + 1UL)) / 4UL;
+}
+
+static void sim_uart_tick(void)
+{
+    unsigned char enabled = SIM_BIT(SIM_ADDR_RCSTA, 7);
+    /* Transmitter */
+    if(enabled && SIM_BIT(SIM_ADDR_TXSTA, 5))
+    {
+        if(!sim_uart_txreg_full)
+            { SIM_SET(SIM_ADDR_PIR1, 4); }
+        else { /* Nothing */ }
+        if((SIM_NO_EVENT != sim_uart_tx_done_at) && (sim_cycles >= sim_uart_tx_done_at))
+        {
+            sim_uart_tx_log[sim_uart_tx_head] = sim_uart_tsr;
+            sim_uart_tx_head = (sim_uart_tx_head + 1) % SIM_UART_BUFFER_SIZE;
+            if(sim_uart_txreg_full)
+            {
+                sim_uart_txreg_full = 0;
+                sim_uart_tsr = SIM_REG(SIM_ADDR_TXREG);
+                sim_uart_tx_done_at = sim_cycles + sim_uart_frame_cycles();
+                SIM_SET(SIM_ADDR_PIR1, 4);
+            }
+            else
+            {
+                sim_uart_tx_done_at = SIM_NO_EVENT;
+                SIM_SET(SIM_ADDR_TXSTA, 1);
+            }
+        }
+        else { /* Nothing */ }
+    }
+    else
+    {
+        SIM_CLR(SIM_ADDR_PIR1, 4);
+    }
+    /* Receiver, a new byte is received when the previous one was read */
+    if(enabled && SIM_BIT(SIM_ADDR_RCSTA, 4) && (sim_uart_rx_tail != sim_uart_rx_head)
+               && !SIM_BIT(SIM_ADDR_PIR1, 5))
+    {
+        if(SIM_NO_EVENT == sim_uart_rx_done_at)
+        {
+            sim_uart_rx_done_at = sim_cycles + sim_uart_frame_cycles();
+        }
+        else if(sim_cycles >= sim_uart_rx_done_at)
+        {
+            SIM_REG(SIM_ADDR_RCREG) = sim_uart_rx_fifo[sim_uart_rx_tail];
+            sim_uart_rx_tail = (sim_uart_rx_tail + 1) % SIM_UART_BUFFER_SIZE;
+            sim_uart_rx_done_at = SIM_NO_EVENT;
+            SIM_SET(SIM_ADDR_PIR1, 5);
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+/* MSSP events */
+#define SIM_MSSP_SPI_TRANSFER   1U
+#define SIM_MSSP_I2C_WRITE      2U
+#define SIM_MSSP_I2C_READ       3U
+#define SIM_MSSP_I2C_START      4U
+#define SIM_MSSP_I2C_RESTART    5U
+#define SIM_MSSP_I2C_STOP       6U
+#define SIM_MSSP_I2C_ACK        7U
+
+static unsigned long sim_mssp_bit_cycles(void)
+{
+    unsigned char mode = SIM_REG(SIM_ADDR_SSPCON1) & 0x0F;
+    unsigned long cycles = 0;
+    switch(mode)
+    {
+        case 0x00: cycles = 1UL;  break;
+        case 0x01: cycles = 4UL;  break;
+        case 0x02: cycles = 16UL; break;
+        case 0x03: cycles = 2UL * ((unsigned long)SIM_REG(SIM_ADDR_PR2) + 1UL); break;
+        case 0x08: cycles = (unsigned long)SIM_REG(SIM_ADDR_SSPADD) + 1UL; break;
+        default:   cycles = 4UL;  break;
+    }
+    return cycles;
+}
+
+static void sim_mssp_access_buffer(void)
+{
+    unsigned char mode = SIM_REG(SIM_ADDR_SSPCON1) & 0x0F;
+    unsigned char write = (!SIM_BIT(SIM_ADDR_SSPSTAT, 0)) || (sim_pending_value != SIM_REG(SIM_ADDR_SSPBUF));
+    if(SIM_BIT(SIM_ADDR_SSPCON1, 5))
+    {
+        if(!write)
+        {
+            SIM_CLR(SIM_ADDR_SSPSTAT, 0);
+        }
+        else if(0 != sim_mssp_event)
+        {
+            /* Write collision */
+            SIM_SET(SIM_ADDR_SSPCON1, 7);
+        }
+        else if(mode <= 0x05)
+        {
+            sim_mssp_event = SIM_MSSP_SPI_TRANSFER;
+            sim_mssp_done_at = sim_cycles + 8UL * sim_mssp_bit_cycles();
+        }
+        else if(0x08 == mode)
+        {
+            SIM_SET(SIM_ADDR_SSPSTAT, 0);
+            sim_mssp_event = SIM_MSSP_I2C_WRITE;
+            sim_mssp_done_at = sim_cycles + 9UL * sim_mssp_bit_cycles();
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+static void sim_mssp_access_con2(void)
+{
+    unsigned char started = (unsigned char)(SIM_REG(SIM_ADDR_SSPCON2) & ~sim_pending_value);
+    if(SIM_BIT(SIM_ADDR_SSPCON1, 5) && (0x08 == (SIM_REG(SIM_ADDR_SSPCON1) & 0x0F)) && (0 == sim_mssp_event))
+    {
+        if(started & 0x01)
+            { sim_mssp_event = SIM_MSSP_I2C_START; }
+        else if(started & 0x02)
+            { sim_mssp_event = SIM_MSSP_I2C_RESTART; }
+        else if(started & 0x04)
+            { sim_mssp_event = SIM_MSSP_I2C_STOP; }
+        else if(started & 0x08)
+            { sim_mssp_event = SIM_MSSP_I2C_READ; }
+        else if(started & 0x10)
+            { sim_mssp_event = SIM_MSSP_I2C_ACK; }
+        else { /* Nothing */ }
+        if(SIM_MSSP_I2C_READ == sim_mssp_event)
+            { sim_mssp_done_at = sim_cycles + 8UL * sim_mssp_bit_cycles(); }
+        else if(0 != sim_mssp_event)
+            { sim_mssp_done_at = sim_cycles + SIM_I2C_EVENT_CYCLES; }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+static void sim_mssp_tick(void)
+{
+    unsigned char sent = 0;
+    if((0 != sim_mssp_event) && (sim_cycles >= sim_mssp_done_at))
+    {
+        switch(sim_mssp_event)
+        {
+            case SIM_MSSP_SPI_TRANSFER:
+                sent = SIM_REG(SIM_ADDR_SSPBUF);
+                if(sim_spi_miso_index < sim_spi_miso_size)
+                    { SIM_REG(SIM_ADDR_SSPBUF) = sim_spi_miso[sim_spi_miso_index++]; }
+                else
+                    { SIM_REG(SIM_ADDR_SSPBUF) = sent; }
+                SIM_SET(SIM_ADDR_SSPSTAT, 0);
+                break;
+            case SIM_MSSP_I2C_WRITE:
+                SIM_CLR(SIM_ADDR_SSPSTAT, 0);
+                if(sim_i2c_nack)
+                    { SIM_SET(SIM_ADDR_SSPCON2, 6); }
+                else
+                    { SIM_CLR(SIM_ADDR_SSPCON2, 6); }
+                break;
+            case SIM_MSSP_I2C_READ:
+                SIM_REG(SIM_ADDR_SSPBUF) = (sim_i2c_rx_index < sim_i2c_rx_size) ? sim_i2c_rx[sim_i2c_rx_index++] : 0xFF;
+                SIM_SET(SIM_ADDR_SSPSTAT, 0);
+                SIM_CLR(SIM_ADDR_SSPCON2, 3);
+                break;
+            case SIM_MSSP_I2C_START:
+                SIM_CLR(SIM_ADDR_SSPCON2, 0);
+                SIM_SET(SIM_ADDR_SSPSTAT, 3);
+                SIM_CLR(SIM_ADDR_SSPSTAT, 4);
+                break;
+            case SIM_MSSP_I2C_RESTART:
+                SIM_CLR(SIM_ADDR_SSPCON2, 1);
+                SIM_SET(SIM_ADDR_SSPSTAT, 3);
+                break;
+            case SIM_MSSP_I2C_STOP:
+                SIM_CLR(SIM_ADDR_SSPCON2, 2);
+                SIM_CLR(SIM_ADDR_SSPSTAT, 3);
+                SIM_SET(SIM_ADDR_SSPSTAT, 4);
+                break;
+            case SIM_MSSP_I2C_ACK:
+                SIM_CLR(SIM_ADDR_SSPCON2, 4);
+                break;
+            default:
+                break;
+        }
+        sim_mssp_event = 0;
+        sim_mssp_done_at = SIM_NO_EVENT;
+        SIM_SET(SIM_ADDR_PIR1, 3);
+    }
+    else { /* Nothing */ }
+}
+
+static void sim_adc_start(void)
+{
+    static const unsigned char tad_fosc[8] = {2, 8, 32, 16, 4, 16, 64, 16};
+    static const unsigned char acquisition_tad[8] = {0, 2, 4, 6, 8, 12, 16, 20};
+    unsigned char adcon2 = SIM_REG(SIM_ADDR_ADCON2);
+    unsigned long tad = tad_fosc[adcon2 & 0x07];
+    unsigned long cycles = ((acquisition_tad[(adcon2 >> 3) & 0x07] + 11UL) * tad) / 4UL;
+    sim_adc_done_at = sim_cycles + ((cycles > 0) ? cycles : 1UL);
+}
+
+static void sim_adc_tick(void)
+{
+    unsigned char channel = 0;
+    unsigned short value = 0;
+    if((SIM_NO_EVENT != sim_adc_done_at) && (sim_cycles >= sim_adc_done_at))
+    {
+        channel = (SIM_REG(SIM_ADDR_ADCON0) >> 2) & 0x0F;
+        value = (channel < SIM_ADC_CHANNELS) ? sim_adc_input[channel] : 0;
+        if(SIM_BIT(SIM_ADDR_ADCON2, 7))
+        {
+            SIM_REG(SIM_ADDR_ADRESH) = (unsigned char)(value >> 8);
+            SIM_REG(SIM_ADDR_ADRESL) = (unsigned char)value;
+        }
+        else
+        {
+            SIM_REG(SIM_ADDR_ADRESH) = (unsigned char)(value >> 2);
+            SIM_REG(SIM_ADDR_ADRESL) = (unsigned char)(value << 6);
+        }
+        SIM_CLR(SIM_ADDR_ADCON0, 1);
+        SIM_SET(SIM_ADDR_PIR1, 6);
+        sim_adc_done_at = SIM_NO_EVENT;
+    }
+    else { /* Nothing */ }
+}
+
+static void sim_eeprom_access(void)
+{
+    unsigned int address = ((unsigned int)(SIM_REG(SIM_ADDR_EEADRH) & 0x03) << 8) | SIM_REG(SIM_ADDR_EEADR);
+    /* EEPGD = 0 and CFGS = 0 : the data EEPROM */
+    if(0 == (SIM_REG(SIM_ADDR_EECON1) & 0xC0))
+    {
+        if(SIM_BIT(SIM_ADDR_EECON1, 0))
+        {
+            SIM_REG(SIM_ADDR_EEDATA) = sim_eeprom[address];
+            SIM_CLR(SIM_ADDR_EECON1, 0);
+        }
+        else { /* Nothing */ }
+        if(SIM_BIT(SIM_ADDR_EECON1, 1) && (SIM_NO_EVENT == sim_eeprom_done_at))
+        {
+            if(SIM_BIT(SIM_ADDR_EECON1, 2))
+                { sim_eeprom_done_at = sim_cycles + SIM_EEPROM_WRITE_CYCLES; }
+            else
+                { SIM_CLR(SIM_ADDR_EECON1, 1); }
+        }
+        else { /* Nothing */ }
+    }
+    else { /* Nothing */ }
+}
+
+static void sim_eeprom_tick(void)
+{
+    unsigned int address = 0;
+    if((SIM_NO_EVENT != sim_eeprom_done_at) && (sim_cycles >= sim_eeprom_done_at))
+    {
+        address = ((unsigned int)(SIM_REG(SIM_ADDR_EEADRH) & 0x03) << 8) | SIM_REG(SIM_ADDR_EEADR);
+        sim_eeprom[address] = SIM_REG(SIM_ADDR_EEDATA);
+        SIM_CLR(SIM_ADDR_EECON1, 1);
+        SIM_SET(SIM_ADDR_PIR2, 4);
+        sim_eeprom_done_at = SIM_NO_EVENT;
+    }
+    else { /* Nothing */ }
+}
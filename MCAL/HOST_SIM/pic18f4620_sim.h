@@ -0,0 +1,859 @@
+/* 
+ * File:   pic18f4620_sim.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> Host side simulation of the PIC18F4620 special function registers <--
+ *
+ * Included by "compiler.h" instead of <xc.h> when HOST_SIM is defined, so the
+ * MCAL and ECUAL sources build unmodified with gcc/clang, e.g.
+ *
+ *  gcc -std=gnu11 -DHOST_SIM -Wno-unknown-pragmas main.c MCAL/DIO/DIO.c ... 
+ *      MCAL/HOST_SIM/pic18f4620_sim.c
+ *
+ * The register file (0xF80 --> 0xFFF) is a plain RAM array:
+ *  - TRISx/LATx/PORTx are direct array elements (their addresses are constant,
+ *    the DIO register tables take them at compile time).
+ *  - Every other register and every xxxbits view goes through sim_sfr_access(),
+ *    which advances the simulated time by SIM_SFR_ACCESS_CYCLES and steps the
+ *    peripheral models. A driver spinning on a flag (SSPSTATbits.BF, 
+ *    TXSTAbits.TRMT, ...) so advances the time until the peripheral is done.
+ *  - A register read through a pointer with SFR_INDIRECT() ("compiler.h") 
+ *    also charges the load of the pointer in FSRx (SIM_SFR_POINTER_LOAD_CYCLES).
+ * 
+ * The cycle counter counts instruction cycles (Fosc/4) spent in the modeled 
+ * peripherals, the delays (__delay_us/__delay_ms/__nop) and the SFR accesses.
+ * The C code between two SFR accesses runs on the host for free, so the counts 
+ * are a lower bound of the target cost, good for comparing two versions of 
+ * a driver, not for absolute timing.
+ *
+ * Call cost model : built with
+ *      -finstrument-functions -finstrument-functions-exclude-file-list=HOST_SIM
+ * every call of an MCAL/ECUAL function also charges SIM_CALL_CYCLES (CALL) and
+ * SIM_RETURN_CYCLES (RETURN), sim_get_calls() counts them. The argument 
+ * passing and the function body are still free, so a function and a macro 
+ * doing the same access differ by at least these cycles.
+ *
+ * Modeled : GPIO (external inputs), TIMER0-3, CCP1/2 (compare, capture, PWM 
+ * duty latch), EUSART (async), MSSP (SPI master, I2C master), ADC, data 
+ * EEPROM, INT0-2 and RB4-RB7 interrupt on change, two level interrupts.
+ * 
+ * A write and a read of a data register (TXREG, SSPBUF, ...) look the same 
+ * through sim_sfr_access(), the models process an access at the next access
+ * to any register (or the next sim_sync()):
+ *  - TXREG is always a write, RCREG is always a read.
+ *  - SSPBUF is a write when BF is clear or its value changed, else a read.
+ */
+
+#ifndef PIC18F4620_SIM_H
+#define	PIC18F4620_SIM_H
+
+/* --------------- Section: Macro Declarations --------------- */
+#define SIM_SFR_FIRST_ADDRESS           0xF80
+#define SIM_SFR_FILE_SIZE               0x80
+
+/* Instruction cycles charged for one access through sim_sfr_access() */
+#define SIM_SFR_ACCESS_CYCLES           1UL
+/* Instruction cycles of the pointer load before an indirect access (MOVFF x2 to FSRx) */
+#define SIM_SFR_POINTER_LOAD_CYCLES     4UL
+/* Instruction cycles from the interrupt flag to the first vector instruction */
+#define SIM_INTERRUPT_LATENCY_CYCLES    3UL
+/* Instruction cycles of a CALL and a RETURN (the call cost model only) */
+#define SIM_CALL_CYCLES                 2UL
+#define SIM_RETURN_CYCLES               2UL
+/* Data EEPROM write cycle (4 ms at 8 MHz) */
+#define SIM_EEPROM_WRITE_CYCLES         8000UL
+/* I2C bus events (START, STOP, ACK, ...) duration */
+#define SIM_I2C_EVENT_CYCLES            10UL
+/* Only the SFR accesses take cycles here, the reload of a timer ISR loses these */
+#define TMR0_RELOAD_COMPENSATION_CYCLES 3U
+#define TMR1_RELOAD_COMPENSATION_CYCLES 1U
+#define TMR2_RELOAD_COMPENSATION_CYCLES 1U
+#define TMR3_RELOAD_COMPENSATION_CYCLES 1U
+
+#define SIM_PORTS_NUMBER                5
+#define SIM_ADC_CHANNELS                13
+#define SIM_EEPROM_SIZE                 1024
+#define SIM_UART_BUFFER_SIZE            256
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+#define SIM_SFR_DIRECT(_ADDRESS_)       (sim_sfr_file[(_ADDRESS_) - SIM_SFR_FIRST_ADDRESS])
+#define SIM_SFR_ACCESS(_ADDRESS_)       (*sim_sfr_access(_ADDRESS_))
+#define SIM_SFR_INDIRECT(_POINTER_)     (*sim_sfr_indirect(_POINTER_))
+
+/* The XC8 built-ins */
+#define __interrupt(...)
+#define __nop()                         sim_delay_cycles(1UL)
+#define __delay_us(_US_)                sim_delay_cycles((unsigned long)((unsigned long long)(_US_) * (_XTAL_FREQ / 4000UL) / 1000UL))
+#define __delay_ms(_MS_)                sim_delay_cycles((unsigned long)((unsigned long long)(_MS_) * (_XTAL_FREQ / 4000UL)))
+#define CLRWDT()
+#define NOP()                           __nop()
+#define ei()                            (INTCONbits.GIE = 1)
+#define di()                            (INTCONbits.GIE = 0)
+
+/* --------------- Section: Data Type Declarations --------------- */
+extern volatile unsigned char sim_sfr_file[SIM_SFR_FILE_SIZE];
+
+/* --------------- Section: Special Function Registers --------------- */
+#define PORTA                   SIM_SFR_DIRECT(0xF80)
+typedef union {
+    struct {
+        unsigned char RA0                   :1;
+        unsigned char RA1                   :1;
+        unsigned char RA2                   :1;
+        unsigned char RA3                   :1;
+        unsigned char RA4                   :1;
+        unsigned char RA5                   :1;
+        unsigned char RA6                   :1;
+        unsigned char RA7                   :1;
+    };
+} PORTAbits_t;
+#define PORTAbits               (*(volatile PORTAbits_t *)&SIM_SFR_DIRECT(0xF80))
+
+#define PORTB                   SIM_SFR_DIRECT(0xF81)
+typedef union {
+    struct {
+        unsigned char RB0                   :1;
+        unsigned char RB1                   :1;
+        unsigned char RB2                   :1;
+        unsigned char RB3                   :1;
+        unsigned char RB4                   :1;
+        unsigned char RB5                   :1;
+        unsigned char RB6                   :1;
+        unsigned char RB7                   :1;
+    };
+} PORTBbits_t;
+#define PORTBbits               (*(volatile PORTBbits_t *)&SIM_SFR_DIRECT(0xF81))
+
+#define PORTC                   SIM_SFR_DIRECT(0xF82)
+typedef union {
+    struct {
+        unsigned char RC0                   :1;
+        unsigned char RC1                   :1;
+        unsigned char RC2                   :1;
+        unsigned char RC3                   :1;
+        unsigned char RC4                   :1;
+        unsigned char RC5                   :1;
+        unsigned char RC6                   :1;
+        unsigned char RC7                   :1;
+    };
+} PORTCbits_t;
+#define PORTCbits               (*(volatile PORTCbits_t *)&SIM_SFR_DIRECT(0xF82))
+
+#define PORTD                   SIM_SFR_DIRECT(0xF83)
+typedef union {
+    struct {
+        unsigned char RD0                   :1;
+        unsigned char RD1                   :1;
+        unsigned char RD2                   :1;
+        unsigned char RD3                   :1;
+        unsigned char RD4                   :1;
+        unsigned char RD5                   :1;
+        unsigned char RD6                   :1;
+        unsigned char RD7                   :1;
+    };
+} PORTDbits_t;
+#define PORTDbits               (*(volatile PORTDbits_t *)&SIM_SFR_DIRECT(0xF83))
+
+#define PORTE                   SIM_SFR_DIRECT(0xF84)
+typedef union {
+    struct {
+        unsigned char RE0                   :1;
+        unsigned char RE1                   :1;
+        unsigned char RE2                   :1;
+        unsigned char RE3                   :1;
+    };
+} PORTEbits_t;
+#define PORTEbits               (*(volatile PORTEbits_t *)&SIM_SFR_DIRECT(0xF84))
+
+#define LATA                    SIM_SFR_DIRECT(0xF89)
+typedef union {
+    struct {
+        unsigned char LATA0                 :1;
+        unsigned char LATA1                 :1;
+        unsigned char LATA2                 :1;
+        unsigned char LATA3                 :1;
+        unsigned char LATA4                 :1;
+        unsigned char LATA5                 :1;
+        unsigned char LATA6                 :1;
+        unsigned char LATA7                 :1;
+    };
+} LATAbits_t;
+#define LATAbits                (*(volatile LATAbits_t *)&SIM_SFR_DIRECT(0xF89))
+
+#define LATB                    SIM_SFR_DIRECT(0xF8A)
+typedef union {
+    struct {
+        unsigned char LATB0                 :1;
+        unsigned char LATB1                 :1;
+        unsigned char LATB2                 :1;
+        unsigned char LATB3                 :1;
+        unsigned char LATB4                 :1;
+        unsigned char LATB5                 :1;
+        unsigned char LATB6                 :1;
+        unsigned char LATB7                 :1;
+    };
+} LATBbits_t;
+#define LATBbits                (*(volatile LATBbits_t *)&SIM_SFR_DIRECT(0xF8A))
+
+#define LATC                    SIM_SFR_DIRECT(0xF8B)
+typedef union {
+    struct {
+        unsigned char LATC0                 :1;
+        unsigned char LATC1                 :1;
+        unsigned char LATC2                 :1;
+        unsigned char LATC3                 :1;
+        unsigned char LATC4                 :1;
+        unsigned char LATC5                 :1;
+        unsigned char LATC6                 :1;
+        unsigned char LATC7                 :1;
+    };
+} LATCbits_t;
+#define LATCbits                (*(volatile LATCbits_t *)&SIM_SFR_DIRECT(0xF8B))
+
+#define LATD                    SIM_SFR_DIRECT(0xF8C)
+typedef union {
+    struct {
+        unsigned char LATD0                 :1;
+        unsigned char LATD1                 :1;
+        unsigned char LATD2                 :1;
+        unsigned char LATD3                 :1;
+        unsigned char LATD4                 :1;
+        unsigned char LATD5                 :1;
+        unsigned char LATD6                 :1;
+        unsigned char LATD7                 :1;
+    };
+} LATDbits_t;
+#define LATDbits                (*(volatile LATDbits_t *)&SIM_SFR_DIRECT(0xF8C))
+
+#define LATE                    SIM_SFR_DIRECT(0xF8D)
+typedef union {
+    struct {
+        unsigned char LATE0                 :1;
+        unsigned char LATE1                 :1;
+        unsigned char LATE2                 :1;
+    };
+} LATEbits_t;
+#define LATEbits                (*(volatile LATEbits_t *)&SIM_SFR_DIRECT(0xF8D))
+
+#define TRISA                   SIM_SFR_DIRECT(0xF92)
+typedef union {
+    struct {
+        unsigned char TRISA0                :1;
+        unsigned char TRISA1                :1;
+        unsigned char TRISA2                :1;
+        unsigned char TRISA3                :1;
+        unsigned char TRISA4                :1;
+        unsigned char TRISA5                :1;
+        unsigned char TRISA6                :1;
+        unsigned char TRISA7                :1;
+    };
+    struct {
+        unsigned char RA0                   :1;
+        unsigned char RA1                   :1;
+        unsigned char RA2                   :1;
+        unsigned char RA3                   :1;
+        unsigned char RA4                   :1;
+        unsigned char RA5                   :1;
+        unsigned char RA6                   :1;
+        unsigned char RA7                   :1;
+    };
+} TRISAbits_t;
+#define TRISAbits               (*(volatile TRISAbits_t *)&SIM_SFR_DIRECT(0xF92))
+
+#define TRISB                   SIM_SFR_DIRECT(0xF93)
+typedef union {
+    struct {
+        unsigned char TRISB0                :1;
+        unsigned char TRISB1                :1;
+        unsigned char TRISB2                :1;
+        unsigned char TRISB3                :1;
+        unsigned char TRISB4                :1;
+        unsigned char TRISB5                :1;
+        unsigned char TRISB6                :1;
+        unsigned char TRISB7                :1;
+    };
+    struct {
+        unsigned char RB0                   :1;
+        unsigned char RB1                   :1;
+        unsigned char RB2                   :1;
+        unsigned char RB3                   :1;
+        unsigned char RB4                   :1;
+        unsigned char RB5                   :1;
+        unsigned char RB6                   :1;
+        unsigned char RB7                   :1;
+    };
+} TRISBbits_t;
+#define TRISBbits               (*(volatile TRISBbits_t *)&SIM_SFR_DIRECT(0xF93))
+
+#define TRISC                   SIM_SFR_DIRECT(0xF94)
+typedef union {
+    struct {
+        unsigned char TRISC0                :1;
+        unsigned char TRISC1                :1;
+        unsigned char TRISC2                :1;
+        unsigned char TRISC3                :1;
+        unsigned char TRISC4                :1;
+        unsigned char TRISC5                :1;
+        unsigned char TRISC6                :1;
+        unsigned char TRISC7                :1;
+    };
+    struct {
+        unsigned char RC0                   :1;
+        unsigned char RC1                   :1;
+        unsigned char RC2                   :1;
+        unsigned char RC3                   :1;
+        unsigned char RC4                   :1;
+        unsigned char RC5                   :1;
+        unsigned char RC6                   :1;
+        unsigned char RC7                   :1;
+    };
+} TRISCbits_t;
+#define TRISCbits               (*(volatile TRISCbits_t *)&SIM_SFR_DIRECT(0xF94))
+
+#define TRISD                   SIM_SFR_DIRECT(0xF95)
+typedef union {
+    struct {
+        unsigned char TRISD0                :1;
+        unsigned char TRISD1                :1;
+        unsigned char TRISD2                :1;
+        unsigned char TRISD3                :1;
+        unsigned char TRISD4                :1;
+        unsigned char TRISD5                :1;
+        unsigned char TRISD6                :1;
+        unsigned char TRISD7                :1;
+    };
+    struct {
+        unsigned char RD0                   :1;
+        unsigned char RD1                   :1;
+        unsigned char RD2                   :1;
+        unsigned char RD3                   :1;
+        unsigned char RD4                   :1;
+        unsigned char RD5                   :1;
+        unsigned char RD6                   :1;
+        unsigned char RD7                   :1;
+    };
+} TRISDbits_t;
+#define TRISDbits               (*(volatile TRISDbits_t *)&SIM_SFR_DIRECT(0xF95))
+
+#define TRISE                   SIM_SFR_DIRECT(0xF96)
+typedef union {
+    struct {
+        unsigned char TRISE0                :1;
+        unsigned char TRISE1                :1;
+        unsigned char TRISE2                :1;
+    };
+    struct {
+        unsigned char RE0                   :1;
+        unsigned char RE1                   :1;
+        unsigned char RE2                   :1;
+    };
+} TRISEbits_t;
+#define TRISEbits               (*(volatile TRISEbits_t *)&SIM_SFR_DIRECT(0xF96))
+
+#define PIE1                    SIM_SFR_ACCESS(0xF9D)
+typedef union {
+    struct {
+        unsigned char TMR1IE                :1;
+        unsigned char TMR2IE                :1;
+        unsigned char CCP1IE                :1;
+        unsigned char SSPIE                 :1;
+        unsigned char TXIE                  :1;
+        unsigned char RCIE                  :1;
+        unsigned char ADIE                  :1;
+        unsigned char PSPIE                 :1;
+    };
+} PIE1bits_t;
+#define PIE1bits                (*(volatile PIE1bits_t *)&SIM_SFR_ACCESS(0xF9D))
+
+#define PIR1                    SIM_SFR_ACCESS(0xF9E)
+typedef union {
+    struct {
+        unsigned char TMR1IF                :1;
+        unsigned char TMR2IF                :1;
+        unsigned char CCP1IF                :1;
+        unsigned char SSPIF                 :1;
+        unsigned char TXIF                  :1;
+        unsigned char RCIF                  :1;
+        unsigned char ADIF                  :1;
+        unsigned char PSPIF                 :1;
+    };
+} PIR1bits_t;
+#define PIR1bits                (*(volatile PIR1bits_t *)&SIM_SFR_ACCESS(0xF9E))
+
+#define IPR1                    SIM_SFR_ACCESS(0xF9F)
+typedef union {
+    struct {
+        unsigned char TMR1IP                :1;
+        unsigned char TMR2IP                :1;
+        unsigned char CCP1IP                :1;
+        unsigned char SSPIP                 :1;
+        unsigned char TXIP                  :1;
+        unsigned char RCIP                  :1;
+        unsigned char ADIP                  :1;
+        unsigned char PSPIP                 :1;
+    };
+} IPR1bits_t;
+#define IPR1bits                (*(volatile IPR1bits_t *)&SIM_SFR_ACCESS(0xF9F))
+
+#define PIE2                    SIM_SFR_ACCESS(0xFA0)
+typedef union {
+    struct {
+        unsigned char CCP2IE                :1;
+        unsigned char TMR3IE                :1;
+        unsigned char HLVDIE                :1;
+        unsigned char BCLIE                 :1;
+        unsigned char EEIE                  :1;
+        unsigned char                 :1;
+        unsigned char CMIE                  :1;
+        unsigned char OSCFIE                :1;
+    };
+} PIE2bits_t;
+#define PIE2bits                (*(volatile PIE2bits_t *)&SIM_SFR_ACCESS(0xFA0))
+
+#define PIR2                    SIM_SFR_ACCESS(0xFA1)
+typedef union {
+    struct {
+        unsigned char CCP2IF                :1;
+        unsigned char TMR3IF                :1;
+        unsigned char HLVDIF                :1;
+        unsigned char BCLIF                 :1;
+        unsigned char EEIF                  :1;
+        unsigned char                 :1;
+        unsigned char CMIF                  :1;
+        unsigned char OSCFIF                :1;
+    };
+} PIR2bits_t;
+#define PIR2bits                (*(volatile PIR2bits_t *)&SIM_SFR_ACCESS(0xFA1))
+
+#define IPR2                    SIM_SFR_ACCESS(0xFA2)
+typedef union {
+    struct {
+        unsigned char CCP2IP                :1;
+        unsigned char TMR3IP                :1;
+        unsigned char HLVDIP                :1;
+        unsigned char BCLIP                 :1;
+        unsigned char EEIP                  :1;
+        unsigned char                 :1;
+        unsigned char CMIP                  :1;
+        unsigned char OSCFIP                :1;
+    };
+} IPR2bits_t;
+#define IPR2bits                (*(volatile IPR2bits_t *)&SIM_SFR_ACCESS(0xFA2))
+
+#define EECON1                  SIM_SFR_ACCESS(0xFA6)
+typedef union {
+    struct {
+        unsigned char RD                    :1;
+        unsigned char WR                    :1;
+        unsigned char WREN                  :1;
+        unsigned char WRERR                 :1;
+        unsigned char FREE                  :1;
+        unsigned char                 :1;
+        unsigned char CFGS                  :1;
+        unsigned char EEPGD                 :1;
+    };
+} EECON1bits_t;
+#define EECON1bits              (*(volatile EECON1bits_t *)&SIM_SFR_ACCESS(0xFA6))
+
+#define EECON2                  SIM_SFR_ACCESS(0xFA7)
+
+#define EEDATA                  SIM_SFR_ACCESS(0xFA8)
+
+#define EEADR                   SIM_SFR_ACCESS(0xFA9)
+
+#define EEADRH                  SIM_SFR_ACCESS(0xFAA)
+
+#define RCSTA                   SIM_SFR_ACCESS(0xFAB)
+typedef union {
+    struct {
+        unsigned char RX9D                  :1;
+        unsigned char OERR                  :1;
+        unsigned char FERR                  :1;
+        unsigned char ADDEN                 :1;
+        unsigned char CREN                  :1;
+        unsigned char SREN                  :1;
+        unsigned char RX9                   :1;
+        unsigned char SPEN                  :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char RC9                   :1;
+        unsigned char                 :1;
+    };
+} RCSTAbits_t;
+#define RCSTAbits               (*(volatile RCSTAbits_t *)&SIM_SFR_ACCESS(0xFAB))
+
+#define TXSTA                   SIM_SFR_ACCESS(0xFAC)
+typedef union {
+    struct {
+        unsigned char TX9D                  :1;
+        unsigned char TRMT                  :1;
+        unsigned char BRGH                  :1;
+        unsigned char SENDB                 :1;
+        unsigned char SYNC                  :1;
+        unsigned char TXEN                  :1;
+        unsigned char TX9                   :1;
+        unsigned char CSRC                  :1;
+    };
+} TXSTAbits_t;
+#define TXSTAbits               (*(volatile TXSTAbits_t *)&SIM_SFR_ACCESS(0xFAC))
+
+#define TXREG                   SIM_SFR_ACCESS(0xFAD)
+
+#define RCREG                   SIM_SFR_ACCESS(0xFAE)
+
+#define SPBRG                   SIM_SFR_ACCESS(0xFAF)
+
+#define SPBRGH                  SIM_SFR_ACCESS(0xFB0)
+
+#define T3CON                   SIM_SFR_ACCESS(0xFB1)
+typedef union {
+    struct {
+        unsigned char TMR3ON                :1;
+        unsigned char TMR3CS                :1;
+        unsigned char nT3SYNC               :1;
+        unsigned char T3CCP1                :1;
+        unsigned char T3CKPS                :2;
+        unsigned char T3CCP2                :1;
+        unsigned char RD16                  :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char T3SYNC                :1;
+        unsigned char                 :1;
+        unsigned char T3CKPS0               :1;
+        unsigned char T3CKPS1               :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+    };
+} T3CONbits_t;
+#define T3CONbits               (*(volatile T3CONbits_t *)&SIM_SFR_ACCESS(0xFB1))
+
+#define TMR3L                   SIM_SFR_ACCESS(0xFB2)
+
+#define TMR3H                   SIM_SFR_ACCESS(0xFB3)
+
+#define BAUDCON                 SIM_SFR_ACCESS(0xFB8)
+typedef union {
+    struct {
+        unsigned char ABDEN                 :1;
+        unsigned char WUE                   :1;
+        unsigned char                 :1;
+        unsigned char BRG16                 :1;
+        unsigned char TXCKP                 :1;
+        unsigned char RXDTP                 :1;
+        unsigned char RCIDL                 :1;
+        unsigned char ABDOVF                :1;
+    };
+} BAUDCONbits_t;
+#define BAUDCONbits             (*(volatile BAUDCONbits_t *)&SIM_SFR_ACCESS(0xFB8))
+
+#define CCP2CON                 SIM_SFR_ACCESS(0xFBA)
+typedef union {
+    struct {
+        unsigned char CCP2M                 :4;
+        unsigned char DC2B                  :2;
+    };
+} CCP2CONbits_t;
+#define CCP2CONbits             (*(volatile CCP2CONbits_t *)&SIM_SFR_ACCESS(0xFBA))
+
+#define CCPR2L                  SIM_SFR_ACCESS(0xFBB)
+
+#define CCPR2H                  SIM_SFR_ACCESS(0xFBC)
+
+#define CCP1CON                 SIM_SFR_ACCESS(0xFBD)
+typedef union {
+    struct {
+        unsigned char CCP1M                 :4;
+        unsigned char DC1B                  :2;
+    };
+} CCP1CONbits_t;
+#define CCP1CONbits             (*(volatile CCP1CONbits_t *)&SIM_SFR_ACCESS(0xFBD))
+
+#define CCPR1L                  SIM_SFR_ACCESS(0xFBE)
+
+#define CCPR1H                  SIM_SFR_ACCESS(0xFBF)
+
+#define ADCON2                  SIM_SFR_ACCESS(0xFC0)
+typedef union {
+    struct {
+        unsigned char ADCS                  :3;
+        unsigned char ACQT                  :3;
+        unsigned char                 :1;
+        unsigned char ADFM                  :1;
+    };
+} ADCON2bits_t;
+#define ADCON2bits              (*(volatile ADCON2bits_t *)&SIM_SFR_ACCESS(0xFC0))
+
+#define ADCON1                  SIM_SFR_ACCESS(0xFC1)
+typedef union {
+    struct {
+        unsigned char PCFG                  :4;
+        unsigned char VCFG0                 :1;
+        unsigned char VCFG1                 :1;
+    };
+} ADCON1bits_t;
+#define ADCON1bits              (*(volatile ADCON1bits_t *)&SIM_SFR_ACCESS(0xFC1))
+
+#define ADCON0                  SIM_SFR_ACCESS(0xFC2)
+typedef union {
+    struct {
+        unsigned char ADON                  :1;
+        unsigned char GO_nDONE              :1;
+        unsigned char CHS                   :4;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char GODONE                :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char GO                    :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char DONE                  :1;
+    };
+} ADCON0bits_t;
+#define ADCON0bits              (*(volatile ADCON0bits_t *)&SIM_SFR_ACCESS(0xFC2))
+
+#define ADRESL                  SIM_SFR_ACCESS(0xFC3)
+
+#define ADRESH                  SIM_SFR_ACCESS(0xFC4)
+
+#define SSPCON2                 SIM_SFR_ACCESS(0xFC5)
+typedef union {
+    struct {
+        unsigned char SEN                   :1;
+        unsigned char RSEN                  :1;
+        unsigned char PEN                   :1;
+        unsigned char RCEN                  :1;
+        unsigned char ACKEN                 :1;
+        unsigned char ACKDT                 :1;
+        unsigned char ACKSTAT               :1;
+        unsigned char GCEN                  :1;
+    };
+} SSPCON2bits_t;
+#define SSPCON2bits             (*(volatile SSPCON2bits_t *)&SIM_SFR_ACCESS(0xFC5))
+
+#define SSPCON1                 SIM_SFR_ACCESS(0xFC6)
+typedef union {
+    struct {
+        unsigned char SSPM                  :4;
+        unsigned char CKP                   :1;
+        unsigned char SSPEN                 :1;
+        unsigned char SSPOV                 :1;
+        unsigned char WCOL                  :1;
+    };
+} SSPCON1bits_t;
+#define SSPCON1bits             (*(volatile SSPCON1bits_t *)&SIM_SFR_ACCESS(0xFC6))
+
+#define SSPSTAT                 SIM_SFR_ACCESS(0xFC7)
+typedef union {
+    struct {
+        unsigned char BF                    :1;
+        unsigned char UA                    :1;
+        unsigned char R_nW                  :1;
+        unsigned char S                     :1;
+        unsigned char P                     :1;
+        unsigned char D_nA                  :1;
+        unsigned char CKE                   :1;
+        unsigned char SMP                   :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char START                 :1;
+        unsigned char STOP                  :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+    };
+} SSPSTATbits_t;
+#define SSPSTATbits             (*(volatile SSPSTATbits_t *)&SIM_SFR_ACCESS(0xFC7))
+
+#define SSPADD                  SIM_SFR_ACCESS(0xFC8)
+
+#define SSPBUF                  SIM_SFR_ACCESS(0xFC9)
+
+#define T2CON                   SIM_SFR_ACCESS(0xFCA)
+typedef union {
+    struct {
+        unsigned char T2CKPS                :2;
+        unsigned char TMR2ON                :1;
+        unsigned char TOUTPS                :4;
+    };
+} T2CONbits_t;
+#define T2CONbits               (*(volatile T2CONbits_t *)&SIM_SFR_ACCESS(0xFCA))
+
+#define PR2                     SIM_SFR_ACCESS(0xFCB)
+
+#define TMR2                    SIM_SFR_ACCESS(0xFCC)
+
+#define T1CON                   SIM_SFR_ACCESS(0xFCD)
+typedef union {
+    struct {
+        unsigned char TMR1ON                :1;
+        unsigned char TMR1CS                :1;
+        unsigned char nT1SYNC               :1;
+        unsigned char T1OSCEN               :1;
+        unsigned char T1CKPS                :2;
+        unsigned char T1RUN                 :1;
+        unsigned char RD16                  :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char T1SYNC                :1;
+        unsigned char                 :1;
+        unsigned char T1CKPS0               :1;
+        unsigned char T1CKPS1               :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+    };
+} T1CONbits_t;
+#define T1CONbits               (*(volatile T1CONbits_t *)&SIM_SFR_ACCESS(0xFCD))
+
+#define TMR1L                   SIM_SFR_ACCESS(0xFCE)
+
+#define TMR1H                   SIM_SFR_ACCESS(0xFCF)
+
+#define RCON                    SIM_SFR_ACCESS(0xFD0)
+typedef union {
+    struct {
+        unsigned char nBOR                  :1;
+        unsigned char nPOR                  :1;
+        unsigned char nPD                   :1;
+        unsigned char nTO                   :1;
+        unsigned char nRI                   :1;
+        unsigned char                 :1;
+        unsigned char SBOREN                :1;
+        unsigned char IPEN                  :1;
+    };
+} RCONbits_t;
+#define RCONbits                (*(volatile RCONbits_t *)&SIM_SFR_ACCESS(0xFD0))
+
+#define T0CON                   SIM_SFR_ACCESS(0xFD5)
+typedef union {
+    struct {
+        unsigned char T0PS                  :3;
+        unsigned char PSA                   :1;
+        unsigned char T0SE                  :1;
+        unsigned char T0CS                  :1;
+        unsigned char T08BIT                :1;
+        unsigned char TMR0ON                :1;
+    };
+} T0CONbits_t;
+#define T0CONbits               (*(volatile T0CONbits_t *)&SIM_SFR_ACCESS(0xFD5))
+
+#define TMR0L                   SIM_SFR_ACCESS(0xFD6)
+
+#define TMR0H                   SIM_SFR_ACCESS(0xFD7)
+
+#define INTCON3                 SIM_SFR_ACCESS(0xFF0)
+typedef union {
+    struct {
+        unsigned char INT1IF                :1;
+        unsigned char INT2IF                :1;
+        unsigned char                 :1;
+        unsigned char INT1IE                :1;
+        unsigned char INT2IE                :1;
+        unsigned char                 :1;
+        unsigned char INT1IP                :1;
+        unsigned char INT2IP                :1;
+    };
+} INTCON3bits_t;
+#define INTCON3bits             (*(volatile INTCON3bits_t *)&SIM_SFR_ACCESS(0xFF0))
+
+#define INTCON2                 SIM_SFR_ACCESS(0xFF1)
+typedef union {
+    struct {
+        unsigned char RBIP                  :1;
+        unsigned char                 :1;
+        unsigned char TMR0IP                :1;
+        unsigned char                 :1;
+        unsigned char INTEDG2               :1;
+        unsigned char INTEDG1               :1;
+        unsigned char INTEDG0               :1;
+        unsigned char nRBPU                 :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char T0IP                  :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char RBPU                  :1;
+    };
+} INTCON2bits_t;
+#define INTCON2bits             (*(volatile INTCON2bits_t *)&SIM_SFR_ACCESS(0xFF1))
+
+#define INTCON                  SIM_SFR_ACCESS(0xFF2)
+typedef union {
+    struct {
+        unsigned char RBIF                  :1;
+        unsigned char INT0IF                :1;
+        unsigned char TMR0IF                :1;
+        unsigned char RBIE                  :1;
+        unsigned char INT0IE                :1;
+        unsigned char TMR0IE                :1;
+        unsigned char PEIE                  :1;
+        unsigned char GIE                   :1;
+    };
+    struct {
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char T0IF                  :1;
+        unsigned char                 :1;
+        unsigned char                 :1;
+        unsigned char T0IE                  :1;
+        unsigned char GIEL                  :1;
+        unsigned char GIEH                  :1;
+    };
+} INTCONbits_t;
+#define INTCONbits              (*(volatile INTCONbits_t *)&SIM_SFR_ACCESS(0xFF2))
+
+/* 16-bit views (low byte first, as on the target) */
+#define TMR0                    (*(volatile unsigned short *)&SIM_SFR_ACCESS(0xFD6))
+#define TMR1                    (*(volatile unsigned short *)&SIM_SFR_ACCESS(0xFCE))
+#define TMR3                    (*(volatile unsigned short *)&SIM_SFR_ACCESS(0xFB2))
+#define CCPR1                   (*(volatile unsigned short *)&SIM_SFR_ACCESS(0xFBE))
+#define CCPR2                   (*(volatile unsigned short *)&SIM_SFR_ACCESS(0xFBB))
+#define ADRES                   (*(volatile unsigned short *)&SIM_SFR_ACCESS(0xFC3))
+
+/*---------------  Section: Function Declarations --------------- */
+volatile unsigned char *sim_sfr_access(unsigned int address);
+volatile unsigned char *sim_sfr_indirect(volatile unsigned char *pointer);
+
+void sim_reset(void);
+void sim_sync(void);
+void sim_delay_cycles(unsigned long cycles);
+unsigned long long sim_get_cycles(void);
+unsigned long sim_get_calls(void);
+void sim_set_tick_hook(void (*hook)(void));
+
+void sim_pin_input(unsigned char port, unsigned char pin, unsigned char logic);
+void sim_ccp_capture_edge(unsigned char ccp, unsigned char rising);
+
+void sim_uart_rx_push(unsigned char data);
+unsigned int sim_uart_tx_pop(unsigned char *buffer, unsigned int size);
+
+void sim_spi_set_miso(const unsigned char *data, unsigned int size);
+void sim_i2c_set_rx(const unsigned char *data, unsigned int size);
+void sim_i2c_set_nack(unsigned char nack);
+
+void sim_adc_set_input(unsigned char channel, unsigned short value);
+unsigned char sim_eeprom_peek(unsigned int address);
+
+#endif	/* PIC18F4620_SIM_H */
@@ -7,6 +7,7 @@
 
 /* --------------- Section : Includes --------------- */
 #include "i2c.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
 /* --------------- Section : Helper Functions Declarations --------------- */
 static void I2C_Interrupt_Cfg(const i2c_t *i2c_obj);
 /* --------------- Section : Global Variables --------------- */
@@ -362,9 +363,6 @@ static void I2C_Interrupt_Cfg(const i2c_t *i2c_obj)
         // 1- Enable Global & Peripheral Interrupts
         INTERRUPT_GIEH_ENABLE();    /* Enable Global Interrupts */
         INTERRUPT_GIEL_ENABLE();    /* Enable Peripheral Interrupts */
-        /* Clear the interrupt flag and enable the interrupts */
-        INTI_I2C_INTERRUPT_ENABLE();
-        INTI_I2C_CLR_FLAG();
         /* Assign the Interrupt handlers */
         I2C_Default_Interrupt_Handler = i2c_obj -> i2c_default_interrupt_handler;
         I2C_Default_Write_Collision_Handler = i2c_obj->i2c_write_collision_handler;
@@ -383,6 +381,11 @@ static void I2C_Interrupt_Cfg(const i2c_t *i2c_obj)
         INTERRUPT_GIEH_ENABLE();
         INTERRUPT_GIEL_ENABLE();
 #endif
+        /* Route the I2C interrupt to its vector */
+        Interrupt_Manager_Register(INTERRUPT_SOURCE_MSSP, I2C_ISR);
+        /* Clear the interrupt flag and enable the interrupts, once routed */
+        INTI_I2C_CLR_FLAG();
+        INTI_I2C_INTERRUPT_ENABLE();
 #endif
 }
 
@@ -9,7 +9,7 @@
 #define	I2C_H
 
 /* --------------- Section : Includes --------------- */
-#include <pic18f4620.h>
+#include "../compiler.h"
 #include "../Interrupt/INT_interrupts/MCAL_INTI.h"
 /* --------------- Section: Macro Declarations --------------- */
 #define I2C_MODULE_ENABLE               STD_ENABLE 
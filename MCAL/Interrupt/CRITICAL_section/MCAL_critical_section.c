@@ -0,0 +1,122 @@
+/* 
+ * File:   MCAL_critical_section.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+/* --------------- Section : Includes --------------- */
+#include "MCAL_critical_section.h"
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ * @brief : Holds off both interrupt vectors.
+ *          Keep the section short, every source waits until its exit.
+ * @return The state to be passed to Critical_Section_Exit().
+ */
+critical_state_t Critical_Section_Enter(void)
+{
+    critical_state_t l_state = (critical_state_t)(INTCON & (CRITICAL_SECTION_GIEH_MASK | CRITICAL_SECTION_GIEL_MASK));
+    
+    /* An interrupt accepted while clearing GIEH returns with GIEH set again */
+    do
+    {
+        INTERRUPT_GIEH_DISABLE();
+    } while(INTCONbits.GIEH);
+    
+    return l_state;
+}
+
+/**
+ * @brief : Holds off the low priority vector only,
+ *          the high priority sources are still served.
+ *          (Without the priority feature there is one vector, 
+ *           so it's the same as Critical_Section_Enter())
+ * @return The state to be passed to Critical_Section_Exit().
+ */
+critical_state_t Critical_Section_Enter_Low(void)
+{
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    critical_state_t l_state = (critical_state_t)(INTCON & (CRITICAL_SECTION_GIEH_MASK | CRITICAL_SECTION_GIEL_MASK));
+    
+    do
+    {
+        INTERRUPT_GIEL_DISABLE();
+    } while(INTCONbits.GIEL);
+    
+    return l_state;
+#else
+    return Critical_Section_Enter();
+#endif
+}
+
+/**
+ * @brief : Restores the interrupts state saved by Critical_Section_Enter()
+ *          or Critical_Section_Enter_Low().
+ * @param state : The state returned by the matching enter.
+ */
+void Critical_Section_Exit(critical_state_t state)
+{
+    /* The low vector first, so the high one is the last to open */
+    if(state & CRITICAL_SECTION_GIEL_MASK)
+        { INTERRUPT_GIEL_ENABLE(); }
+    else
+        { /* Nothing */ }
+    
+    if(state & CRITICAL_SECTION_GIEH_MASK)
+        { INTERRUPT_GIEH_ENABLE(); }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : Masks one interrupt source only, 
+ *          for the data shared with that source ISR.
+ *          The other sources are still served, except for the few
+ *          cycles of the enable register update (the ISRs of other
+ *          sources write the same PIE registers, e.g. TXIE).
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @return The state to be passed to Critical_Section_Unmask_Source().
+ */
+critical_state_t Critical_Section_Mask_Source(interrupt_source_t source)
+{
+    critical_state_t l_state = STD_FALSE;
+    critical_state_t l_global_state = ZERO_INIT;
+    volatile uint8_t *l_enable_register = NULL;
+    uint8_t l_enable_mask = ZERO_INIT;
+    
+    if(E_OK == Interrupt_Manager_Get_Enable(source, &l_enable_register, &l_enable_mask))
+    {
+        /* The read-modify-write of a variable register isn't a single BCF */
+        l_global_state = Critical_Section_Enter();
+        l_state = (*l_enable_register & l_enable_mask) ? STD_TRUE : STD_FALSE;
+        *l_enable_register &= (uint8_t)~l_enable_mask;
+        Critical_Section_Exit(l_global_state);
+    }
+    else
+        { /* Nothing */ }
+    
+    return l_state;
+}
+
+/**
+ * @brief : Restores the enable bit of an interrupt source
+ *          saved by Critical_Section_Mask_Source().
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param state : The state returned by the matching mask.
+ */
+void Critical_Section_Unmask_Source(interrupt_source_t source, critical_state_t state)
+{
+    critical_state_t l_global_state = ZERO_INIT;
+    volatile uint8_t *l_enable_register = NULL;
+    uint8_t l_enable_mask = ZERO_INIT;
+    
+    if((STD_TRUE == state) && (E_OK == Interrupt_Manager_Get_Enable(source, &l_enable_register, &l_enable_mask)))
+    {
+        l_global_state = Critical_Section_Enter();
+        *l_enable_register |= l_enable_mask;
+        Critical_Section_Exit(l_global_state);
+    }
+    else
+        { /* Nothing */ }
+}
@@ -0,0 +1,35 @@
+/* 
+ * File:   MCAL_critical_section.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef MCAL_CRITICAL_SECTION_H
+#define	MCAL_CRITICAL_SECTION_H
+
+/* --------------- Section : Includes --------------- */
+#include "../MCAL_interrupt_manager.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The saved GIEH/GIEL bits, same positions as INTCON<7:6> */
+#define CRITICAL_SECTION_GIEH_MASK      0x80
+#define CRITICAL_SECTION_GIEL_MASK      0x40
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+/* 
+ * The interrupts state saved on the entry of a critical section,
+ * restored on its exit, so the sections can be nested.
+ */
+typedef uint8_t critical_state_t;
+
+/* --------------- Section: Function Declarations --------------- */
+critical_state_t Critical_Section_Enter(void);
+critical_state_t Critical_Section_Enter_Low(void);
+void Critical_Section_Exit(critical_state_t state);
+critical_state_t Critical_Section_Mask_Source(interrupt_source_t source);
+void Critical_Section_Unmask_Source(interrupt_source_t source, critical_state_t state);
+
+#endif	/* MCAL_CRITICAL_SECTION_H */
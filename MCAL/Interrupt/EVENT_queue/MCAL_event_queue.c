@@ -0,0 +1,152 @@
+/* 
+ * File:   MCAL_event_queue.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+/* --------------- Section : Includes --------------- */
+#include "MCAL_event_queue.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+#define EVENT_QUEUE_INDEX_MASK          (EVENT_QUEUE_SIZE - 1)
+
+/* --------------- Section : Global Variables --------------- */
+static event_handler_t event_handlers[INTERRUPT_SOURCES_NUMBER];
+
+/* 
+ * One ring per vector so every ring has a single producer,
+ * the high priority vector can preempt the low priority one.
+ */
+static event_ring_t event_high_ring;
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+static event_ring_t event_low_ring;
+#endif
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static Std_ReturnType event_ring_push(event_ring_t *_ring, uint8_t source, uint16_t payload);
+static uint8_t event_ring_drain(event_ring_t *_ring);
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ * @brief : Assigns the deferred work of an interrupt source.
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param handler : Called by event_dispatch() with the event payload.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType event_register_handler(interrupt_source_t source, event_handler_t handler)
+{
+    Std_ReturnType ret = E_OK;
+    if(source >= INTERRUPT_SOURCES_NUMBER)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        event_handlers[source] = handler;
+    }
+    return ret;
+}
+
+/**
+ * @brief : Posts an event from an interrupt service routine,
+ *          the event goes to the ring of the running vector.
+ *          (Told by the flag of the high vector wrapper, not by GIEH
+ *           which a low routine clears in its critical sections)
+ * @note  : Only called from the interrupt context.
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param payload : A value passed to the deferred handler.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The ring is full, the event is dropped
+ */
+Std_ReturnType event_post(interrupt_source_t source, uint16_t payload)
+{
+    Std_ReturnType ret = E_OK;
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    if(INTERRUPT_MANAGER_IN_HIGH_VECTOR())
+        { ret = event_ring_push(&event_high_ring, (uint8_t)source, payload); }
+    else
+        { ret = event_ring_push(&event_low_ring, (uint8_t)source, payload); }
+#else
+    ret = event_ring_push(&event_high_ring, (uint8_t)source, payload);
+#endif
+    return ret;
+}
+
+/**
+ * @brief : Calls the deferred handlers of the posted events,
+ *          the events of the high priority vector first.
+ *          Called from the main loop.
+ * @return The number of the dispatched events.
+ */
+uint8_t event_dispatch(void)
+{
+    uint8_t l_events_number = ZERO_INIT;
+    l_events_number = event_ring_drain(&event_high_ring);
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    l_events_number += event_ring_drain(&event_low_ring);
+#endif
+    return l_events_number;
+}
+
+/**
+ * @brief : Reads the number of the events dropped on full rings.
+ * @return The dropped events number (saturates at 255).
+ */
+uint8_t event_get_dropped(void)
+{
+    uint16_t l_dropped = event_high_ring.dropped;
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    l_dropped += event_low_ring.dropped;
+#endif
+    return (l_dropped > 0xFF) ? 0xFF : (uint8_t)l_dropped;
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+static Std_ReturnType event_ring_push(event_ring_t *_ring, uint8_t source, uint16_t payload)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_head = _ring->head;
+    uint8_t l_next_head = (uint8_t)((l_head + 1) & EVENT_QUEUE_INDEX_MASK);
+    if(l_next_head == _ring->tail)
+    {
+        if(0xFF != _ring->dropped)
+            { _ring->dropped++; }
+        else
+            { /* Nothing */ }
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* The event is written before it is published by the head */
+        _ring->events[l_head].source = source;
+        _ring->events[l_head].payload = payload;
+        _ring->head = l_next_head;
+    }
+    return ret;
+}
+
+static uint8_t event_ring_drain(event_ring_t *_ring)
+{
+    uint8_t l_events_number = ZERO_INIT;
+    uint8_t l_tail = _ring->tail;
+    uint8_t l_source = ZERO_INIT;
+    uint16_t l_payload = ZERO_INIT;
+    while(l_tail != _ring->head)
+    {
+        l_source = _ring->events[l_tail].source;
+        l_payload = _ring->events[l_tail].payload;
+        /* Release the slot before the handler, it can take long */
+        l_tail = (uint8_t)((l_tail + 1) & EVENT_QUEUE_INDEX_MASK);
+        _ring->tail = l_tail;
+        if((l_source < INTERRUPT_SOURCES_NUMBER) && (NULL != event_handlers[l_source]))
+            { event_handlers[l_source](l_payload); }
+        else
+            { /* Nothing */ }
+        l_events_number++;
+    }
+    return l_events_number;
+}
@@ -0,0 +1,50 @@
+/* 
+ * File:   MCAL_event_queue.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef MCAL_EVENT_QUEUE_H
+#define	MCAL_EVENT_QUEUE_H
+
+/* --------------- Section : Includes --------------- */
+#include "../MCAL_interrupt_manager.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The events number of one ring (a power of 2, one slot is kept empty) */
+#define EVENT_QUEUE_SIZE                16
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+/* 
+ * The deferred work of an interrupt source,
+ * called by event_dispatch() in the thread context.
+ */
+typedef void (*event_handler_t)(uint16_t payload);
+
+typedef struct {
+    uint16_t payload;
+    uint8_t source;         /* @ref interrupt_source_t */
+} event_t;
+
+/* 
+ * A single producer / single consumer ring :
+ *  head is only written by the ISRs of one vector,
+ *  tail is only written by event_dispatch().
+ */
+typedef struct {
+    volatile event_t events[EVENT_QUEUE_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint8_t dropped;
+} event_ring_t;
+
+/* --------------- Section: Function Declarations --------------- */
+Std_ReturnType event_register_handler(interrupt_source_t source, event_handler_t handler);
+Std_ReturnType event_post(interrupt_source_t source, uint16_t payload);
+uint8_t event_dispatch(void);
+uint8_t event_get_dropped(void);
+
+#endif	/* MCAL_EVENT_QUEUE_H */
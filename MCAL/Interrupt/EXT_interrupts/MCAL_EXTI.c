@@ -7,20 +7,38 @@
 
 /* -------------- Section : Includes -------------- */
 #include "MCAL_EXTI.h"
+#include "../MCAL_interrupt_manager.h"
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+#include "../EVENT_queue/MCAL_event_queue.h"
+#endif
 
 /* -------------- Section : Pointers To ISRs --------------*/
 static interrupt_handler_t INT0_INTERRUPT_HANDLER = NULL;
 static interrupt_handler_t INT1_INTERRUPT_HANDLER = NULL;
 static interrupt_handler_t INT2_INTERRUPT_HANDLER = NULL;
 
-static interrupt_handler_t RB4_INTERRUPT_HIGH_HANDLER = NULL;
-static interrupt_handler_t RB4_INTERRUPT_LOW_HANDLER = NULL;
-static interrupt_handler_t RB5_INTERRUPT_HIGH_HANDLER = NULL;
-static interrupt_handler_t RB5_INTERRUPT_LOW_HANDLER = NULL;
-static interrupt_handler_t RB6_INTERRUPT_HIGH_HANDLER = NULL;
-static interrupt_handler_t RB6_INTERRUPT_LOW_HANDLER = NULL;
-static interrupt_handler_t RB7_INTERRUPT_HIGH_HANDLER = NULL;
-static interrupt_handler_t RB7_INTERRUPT_LOW_HANDLER = NULL;
+/* 
+ * The ON_CHANGE handlers indexed by [RBx pin - RB4][new level of the pin],
+ * the new level is (STD_LOW) for a High to Low change 
+ * and (STD_HIGH) for a Low to High change.
+ */
+static interrupt_handler_t RBx_INTERRUPT_HANDLERS[EXTI_RBx_PINS_NUMBER][2] = {{NULL}};
+
+/* -------------- Section : ON_CHANGE Decoding State --------------*/
+/* The last level of PORTB seen by the ON_CHANGE ISR */
+static volatile uint8_t RBx_previous_state = ZERO_INIT;
+/* The RB4..RB7 pins configured with EXTI_RBx_init() */
+static volatile uint8_t RBx_enabled_pins = ZERO_INIT;
+
+/* The PORTB bit of every ON_CHANGE pin */
+static const uint8_t RBx_pin_mask[EXTI_RBx_PINS_NUMBER] = {
+    0x10, 0x20, 0x40, 0x80
+};
+
+/* The lowest changed ON_CHANGE pin for every value of PORTB<7:4> */
+static const uint8_t RBx_first_changed_pin[16] = {
+    0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0
+};
 
 
 /* -------------- Section : Helper Functions Declaration -------------- */
@@ -37,6 +55,12 @@ static Std_ReturnType EXTI_INTx_setInterruptHandler(const EXTI_INTx_t* int_obj);
 
 static Std_ReturnType EXTI_RBx_pin_init(const EXTI_RBx_t* int_obj);
 static Std_ReturnType EXTI_RBx_setInterruptHandler(const EXTI_RBx_t* int_obj);
+static void EXTI_RBx_dispatch(uint8_t port_state, uint8_t changed_pins);
+
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+static void EXTI_INTx_deferred_handler(uint16_t payload);
+static void EXTI_RBx_deferred_handler(uint16_t payload);
+#endif
 
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
 static Std_ReturnType EXTI_INTx_priority_init(const EXTI_INTx_t* int_obj);
@@ -124,10 +148,16 @@ Std_ReturnType EXTI_INTx_deInit(const EXTI_INTx_t* int_obj)
 Std_ReturnType EXTI_RBx_init(const EXTI_RBx_t* int_obj)
 {
     Std_ReturnType ret = E_OK;
+    uint8_t l_pin_mask = ZERO_INIT;
     if(NULL == int_obj)
     {
         ret = E_NOT_OK;
     }
+    /* The 3-bit pin field can't be above PIN7_INDEX */
+    else if(int_obj->mcu_pin.pin < PIN4_INDEX)
+    {
+        ret = E_NOT_OK;
+    }
     else
     {
         /* 1.Disable EXTI */
@@ -150,7 +180,13 @@ Std_ReturnType EXTI_RBx_init(const EXTI_RBx_t* int_obj)
         /* 5.Configure EXTI CallBack */
         ret = EXTI_RBx_setInterruptHandler(int_obj);
         
-        /* 6.Enable EXTI */
+        /* 6.Take the current level of this pin as the reference of its next change,
+         *   the references of the other pins are kept (the interrupt is disabled) */
+        l_pin_mask = RBx_pin_mask[int_obj->mcu_pin.pin - PIN4_INDEX];
+        RBx_previous_state = (uint8_t)((RBx_previous_state & (uint8_t)~l_pin_mask) | (PORTB & l_pin_mask));
+        RBx_enabled_pins |= l_pin_mask;
+        
+        /* 7.Enable EXTI */
         EXTI_RBx_ENABLE();
     }
     return ret;
@@ -170,9 +206,21 @@ Std_ReturnType EXTI_RBx_deInit(const EXTI_RBx_t* int_obj)
     {
         ret = E_NOT_OK;
     }
+    /* The 3-bit pin field can't be above PIN7_INDEX */
+    else if(int_obj->mcu_pin.pin < PIN4_INDEX)
+    {
+        ret = E_NOT_OK;
+    }
     else
     {
-        EXTI_RBx_DISABLE();
+        /* Stop decoding this pin, The ON_CHANGE interrupt is shared by RB4..RB7 */
+        RBx_enabled_pins &= (uint8_t)~RBx_pin_mask[int_obj->mcu_pin.pin - PIN4_INDEX];
+        if(ZERO_INIT == RBx_enabled_pins)
+        {
+            EXTI_RBx_DISABLE();
+        }
+        else
+            { /* Nothing */ }
     }
     return ret;
 }
@@ -186,8 +234,13 @@ void INT0_ISR(void)
     
     /* Second : Write Your Code */
     
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* Third : Defer the CallBack Function For INT0 to the main loop */
+    event_post(INTERRUPT_SOURCE_INT0, EXTI_INT0);
+#else
     /* Third : Call the CallBack Function For INT0 */
     if(INT0_INTERRUPT_HANDLER) { INT0_INTERRUPT_HANDLER(); }
+#endif
 }
 
 void INT1_ISR(void)
@@ -197,8 +250,13 @@ void INT1_ISR(void)
     
     /* Second : Write Your Code */
     
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* Third : Defer the CallBack Function For INT1 to the main loop */
+    event_post(INTERRUPT_SOURCE_INT1, EXTI_INT1);
+#else
     /* Third : Call the CallBack Function For INT1 */
     if(INT1_INTERRUPT_HANDLER) { INT1_INTERRUPT_HANDLER(); }
+#endif
 }
 void INT2_ISR(void)
 {
@@ -207,79 +265,95 @@ void INT2_ISR(void)
     
     /* Second : Write Your Code */
     
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* Third : Defer the CallBack Function For INT2 to the main loop */
+    event_post(INTERRUPT_SOURCE_INT2, EXTI_INT2);
+#else
     /* Third : Call the CallBack Function For INT2 */
     if(INT2_INTERRUPT_HANDLER) { INT2_INTERRUPT_HANDLER(); }
+#endif
 }
 
-void RB4_ISR(uint8_t mode)
+void RBx_ISR(void)
 {
-    /* First : Clear the flag. */
+    /* First : Read PORTB once, Reading it ends the mismatch condition */
+    uint8_t l_port_state = PORTB;
+    uint8_t l_changed_pins = ZERO_INIT;
+    
+    /* Second : Clear the flag. */
     EXTI_RBx_CLR_FLAG();
     
-    /* Second : Write Your Code */
+    /* Third : Find the configured pins that changed since the last interrupt */
+    l_changed_pins = (uint8_t)((l_port_state ^ RBx_previous_state) & RBx_enabled_pins);
+    RBx_previous_state = l_port_state;
     
-    /* Third : Call the CallBack Function For INT2 */
-    if (STD_HIGH == mode)
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* Fourth : Defer the CallBack Functions of the changed pins to the main loop */
+    if(l_changed_pins)
     {
-        if(RB4_INTERRUPT_HIGH_HANDLER) { RB4_INTERRUPT_HIGH_HANDLER(); };
-    }   
-    else if(STD_LOW == mode)
-    {
-        if(RB4_INTERRUPT_LOW_HANDLER)  { RB4_INTERRUPT_LOW_HANDLER(); };
+        event_post(INTERRUPT_SOURCE_RBx, (uint16_t)(((uint16_t)l_changed_pins << 8) | l_port_state));
     }
     else
-        {/* Nothing */}
-}
-void RB5_ISR(uint8_t mode)
-{
-    /* First : Clear the flag. */
-    EXTI_RBx_CLR_FLAG();
-    
-    /* Second : Write Your Code */
-    
-    /* Third : Call the CallBack Function For INT2 */
-    if(RB5_INTERRUPT_HIGH_HANDLER) { RB5_INTERRUPT_HIGH_HANDLER(); };
-    if(RB5_INTERRUPT_LOW_HANDLER)  { RB5_INTERRUPT_LOW_HANDLER(); };
+        { /* Nothing */ }
+#else
+    /* Fourth : Call the CallBack Functions of the changed pins */
+    EXTI_RBx_dispatch(l_port_state, l_changed_pins);
+#endif
 }
-void RB6_ISR(uint8_t mode)
+/* -------------- End Of ISRs -------------- */
+
+/**
+ * Calls the ON_CHANGE handler of every changed pin with its new level.
+ * @param port_state : The level of PORTB read by the ISR.
+ * @param changed_pins : The changed pins of PORTB<7:4>.
+ */
+static void EXTI_RBx_dispatch(uint8_t port_state, uint8_t changed_pins)
 {
-    /* First : Clear the flag. */
-    EXTI_RBx_CLR_FLAG();
+    uint8_t l_pin = ZERO_INIT;
+    uint8_t l_level = ZERO_INIT;
     
-    /* Second : Write Your Code */
-    
-    /* Third : Call the CallBack Function For INT2 */
-    if (STD_HIGH == mode)
+    while(changed_pins)
     {
-        if(RB6_INTERRUPT_HIGH_HANDLER) { RB6_INTERRUPT_HIGH_HANDLER(); };
-    }   
-    else if(STD_LOW == mode)
-    {
-        if(RB6_INTERRUPT_LOW_HANDLER)  { RB6_INTERRUPT_LOW_HANDLER(); };
+        l_pin = RBx_first_changed_pin[changed_pins >> 4];
+        l_level = (port_state & RBx_pin_mask[l_pin]) ? STD_HIGH : STD_LOW;
+        changed_pins &= (uint8_t)~RBx_pin_mask[l_pin];
+        
+        if(RBx_INTERRUPT_HANDLERS[l_pin][l_level]) { RBx_INTERRUPT_HANDLERS[l_pin][l_level](); }
     }
-    else
-        {/* Nothing */}
 }
-void RB7_ISR(uint8_t mode)
+
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/**
+ * The deferred part of the INTx interrupts, called by event_dispatch().
+ * @param payload : The interrupt source (@ref EXTI_INTx_src_t).
+ */
+static void EXTI_INTx_deferred_handler(uint16_t payload)
 {
-    /* First : Clear the flag. */
-    EXTI_RBx_CLR_FLAG();
-    
-    /* Second : Write Your Code */
-    
-    /* Third : Call the CallBack Function For INT2 */
-    if (STD_HIGH == mode)
-    {
-        if(RB7_INTERRUPT_HIGH_HANDLER) { RB7_INTERRUPT_HIGH_HANDLER(); };
-    }   
-    else if(STD_LOW == mode)
-    {
-        if(RB7_INTERRUPT_LOW_HANDLER)  { RB7_INTERRUPT_LOW_HANDLER(); };
+    switch(payload)
+    {
+        case EXTI_INT0:
+            if(INT0_INTERRUPT_HANDLER) { INT0_INTERRUPT_HANDLER(); }
+            break;
+        case EXTI_INT1:
+            if(INT1_INTERRUPT_HANDLER) { INT1_INTERRUPT_HANDLER(); }
+            break;
+        case EXTI_INT2:
+            if(INT2_INTERRUPT_HANDLER) { INT2_INTERRUPT_HANDLER(); }
+            break;
+        default:
+            break;
     }
-    else
-        {/* Nothing */}    
 }
-/* -------------- End Of ISRs -------------- */
+
+/**
+ * The deferred part of the ON_CHANGE interrupt, called by event_dispatch().
+ * @param payload : (The changed pins << 8) | The level of PORTB.
+ */
+static void EXTI_RBx_deferred_handler(uint16_t payload)
+{
+    EXTI_RBx_dispatch((uint8_t)payload, (uint8_t)(payload >> 8));
+}
+#endif
 
 /* -------------- Section : Helper Functions Definitions -------------- */
 
@@ -568,6 +642,10 @@ static Std_ReturnType EXTI_INT0_setInterruptHandler(void (*EXTI_handler)(void))
     else
     {
         INT0_INTERRUPT_HANDLER = EXTI_handler;
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        event_register_handler(INTERRUPT_SOURCE_INT0, EXTI_INTx_deferred_handler);
+#endif
+        ret = Interrupt_Manager_Register(INTERRUPT_SOURCE_INT0, INT0_ISR);
     }
     return ret;
 }
@@ -589,6 +667,10 @@ static Std_ReturnType EXTI_INT1_setInterruptHandler(void (*EXTI_handler)(void))
     else
     {
         INT1_INTERRUPT_HANDLER = EXTI_handler;
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        event_register_handler(INTERRUPT_SOURCE_INT1, EXTI_INTx_deferred_handler);
+#endif
+        ret = Interrupt_Manager_Register(INTERRUPT_SOURCE_INT1, INT1_ISR);
     }
     return ret;  
 }
@@ -610,6 +692,10 @@ static Std_ReturnType EXTI_INT2_setInterruptHandler(void (*EXTI_handler)(void))
     else
     {
         INT2_INTERRUPT_HANDLER = EXTI_handler;
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        event_register_handler(INTERRUPT_SOURCE_INT2, EXTI_INTx_deferred_handler);
+#endif
+        ret = Interrupt_Manager_Register(INTERRUPT_SOURCE_INT2, INT2_ISR);
     }
     return ret;
 }
@@ -726,20 +812,15 @@ static Std_ReturnType EXTI_RBx_setInterruptHandler(const EXTI_RBx_t* int_obj)
         switch(int_obj->mcu_pin.pin)
         {
             case PIN4_INDEX:
-                RB4_INTERRUPT_HIGH_HANDLER = int_obj->EXTI_HIGH_Handler;
-                RB4_INTERRUPT_LOW_HANDLER = int_obj->EXTI_LOW_Handler;
-                break;
             case PIN5_INDEX:
-                RB5_INTERRUPT_HIGH_HANDLER = int_obj->EXTI_HIGH_Handler;
-                RB5_INTERRUPT_LOW_HANDLER = int_obj->EXTI_LOW_Handler;
-                break;
             case PIN6_INDEX:
-                RB6_INTERRUPT_HIGH_HANDLER = int_obj->EXTI_HIGH_Handler;
-                RB6_INTERRUPT_LOW_HANDLER = int_obj->EXTI_LOW_Handler;
-                break;
             case PIN7_INDEX:
-                RB7_INTERRUPT_HIGH_HANDLER = int_obj->EXTI_HIGH_Handler;
-                RB7_INTERRUPT_LOW_HANDLER = int_obj->EXTI_LOW_Handler;
+                RBx_INTERRUPT_HANDLERS[int_obj->mcu_pin.pin - PIN4_INDEX][STD_HIGH] = int_obj->EXTI_HIGH_Handler;
+                RBx_INTERRUPT_HANDLERS[int_obj->mcu_pin.pin - PIN4_INDEX][STD_LOW] = int_obj->EXTI_LOW_Handler;
+#if EXTI_DEFERRED_FEATURE==INTERRUPT_ENABLE
+                event_register_handler(INTERRUPT_SOURCE_RBx, EXTI_RBx_deferred_handler);
+#endif
+                ret = Interrupt_Manager_Register(INTERRUPT_SOURCE_RBx, RBx_ISR);
                 break;
             default:
                 ret = E_NOT_OK;
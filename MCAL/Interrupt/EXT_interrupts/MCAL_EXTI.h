@@ -59,6 +59,9 @@
 #define EXTI_RBx_DISABLE()              (INTCONbits.RBIE = INTERRUPT_DISABLE)
 #define EXTI_RBx_CLR_FLAG()             (INTCONbits.RBIF = STD_LOW)
 
+/* The number of the ON_CHANGE pins (RB4..RB7) */
+#define EXTI_RBx_PINS_NUMBER            4U
+
 /* Handling the priority of the ON_CHANGE pins on Port B */
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
 
@@ -26,6 +26,15 @@
 #define EUSART_RX_INTERRUPT_FEATURE                 INTERRUPT_ENABLE
 
 #define SPI_INTERRUPT_FEATURE                       INTERRUPT_ENABLE
+#define I2C_INTERRUPT_FEATURE                       INTERRUPT_ENABLE
+
+/* 
+ * Deliver the driver callbacks from event_dispatch() (thread context)
+ * instead of calling them inside the interrupt service routine.
+ */
+#define EUSART_RX_DEFERRED_FEATURE                  INTERRUPT_DISABLE
+#define ADC_DEFERRED_FEATURE                        INTERRUPT_DISABLE
+#define CCP_DEFERRED_FEATURE                        INTERRUPT_DISABLE
 /* -------- Section: Macro Functions Declarations -------- */
 
 /* ===========================================================================*/
@@ -145,6 +154,8 @@
 #define INTI_CCP1_INTERRRUPT_DISABLE()              (PIE1bits.CCP1IE = STD_LOW)     
 /* Clear the Interrupt flag for the CCP 1 */
 #define INTI_CCP1_CLR_FLAG()                        (PIR1bits.CCP1IF = STD_LOW)
+/* Set the Interrupt flag for the CCP 1 (a software request) */
+#define INTI_CCP1_SET_FLAG()                        (PIR1bits.CCP1IF = STD_HIGH)
 
 /* Handle The Interrupt priority feature for the CCP 1 module */
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
@@ -166,6 +177,8 @@
 #define INTI_CCP2_INTERRRUPT_DISABLE()              (PIE2bits.CCP2IE = STD_LOW)     
 /* Clear the Interrupt flag for the CCP 2 */
 #define INTI_CCP2_CLR_FLAG()                        (PIR2bits.CCP2IF = STD_LOW)
+/* Set the Interrupt flag for the CCP 2 (a software request) */
+#define INTI_CCP2_SET_FLAG()                        (PIR2bits.CCP2IF = STD_HIGH)
 
 /* Handle The Interrupt priority feature for the CCP2 module */
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
@@ -279,5 +292,37 @@
 
 /* ===========================================================================*/
 
+/* -------- Section: I2C INTERRUPT CONFIGURATIONs -------- */
+#if I2C_INTERRUPT_FEATURE == INTERRUPT_ENABLE
+
+/* 
+ * Enable the Interrupts for the I2C module.
+ * (The MSSP interrupt, shared with the SPI module)
+ */
+#define INTI_I2C_INTERRUPT_ENABLE()                 (PIE1bits.SSPIE = STD_ENABLE)
+
+/* 
+ * Disable the Interrupts for the I2C module.
+ */
+#define INTI_I2C_INTERRUPT_DISABLE()                (PIE1bits.SSPIE = STD_DISABLE)
+
+/* 
+ * Clear the Interrupt flag for the I2C module.
+ */
+#define INTI_I2C_CLR_FLAG()                         (PIR1bits.SSPIF = STD_LOW)
+
+/* 
+ * Handle The Interrupt priority feature for the I2C module.
+ */
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+#define INTI_I2C_INTERRUPT_PRIORITY_HIGH()          (IPR1bits.SSPIP = STD_HIGH)
+#define INTI_I2C_INTERRUPT_PRIORITY_LOW()           (IPR1bits.SSPIP = STD_LOW)
+#endif
+
+#endif
+/* -------- Section: End of I2C INTERRUPT CONFIGURATIONs -------- */
+
+/* ===========================================================================*/
+
 #endif	/* MCAL_INTI_H */
 
@@ -22,6 +22,50 @@
 #define INTERRUPT_PRIORITY_FEATURE              INTERRUPT_ENABLE
 #define EXTI_INTx_ARE_ENABLED                   INTERRUPT_ENABLE
 #define EXTI_RBx_ARE_ENABLED                    INTERRUPT_ENABLE
+/* Deliver the external interrupts callbacks from event_dispatch() */
+#define EXTI_DEFERRED_FEATURE                   INTERRUPT_DISABLE
+
+/* 
+ * Profiling of the registered interrupt sources, the time stamps
+ * are taken from TIMER1 which must be left free running
+ * (Timer mode, no preload, prescaler 1 : one tick per instruction cycle,
+ *  16-bit read mode : TMR1H is latched by the TMR1L read)
+ */
+#define INTERRUPT_PROFILING_FEATURE             INTERRUPT_DISABLE
+
+/* 
+ * The dispatch order of the registered interrupt sources,
+ * the source with the lower rank is checked first.
+ * (Every source must have a unique rank 0 --> 15)
+ */
+#define INTERRUPT_DISPATCH_RANK_EUSART_RX       0
+#define INTERRUPT_DISPATCH_RANK_CCP1            1
+#define INTERRUPT_DISPATCH_RANK_CCP2            2
+#define INTERRUPT_DISPATCH_RANK_INT0            3
+#define INTERRUPT_DISPATCH_RANK_INT1            4
+#define INTERRUPT_DISPATCH_RANK_INT2            5
+#define INTERRUPT_DISPATCH_RANK_RBx             6
+#define INTERRUPT_DISPATCH_RANK_MSSP            7
+#define INTERRUPT_DISPATCH_RANK_TMR0            8
+#define INTERRUPT_DISPATCH_RANK_TMR1            9
+#define INTERRUPT_DISPATCH_RANK_TMR2            10
+#define INTERRUPT_DISPATCH_RANK_TMR3            11
+#define INTERRUPT_DISPATCH_RANK_EUSART_TX       12
+#define INTERRUPT_DISPATCH_RANK_ADC             13
+#define INTERRUPT_DISPATCH_RANK_EEPROM          14
+#define INTERRUPT_DISPATCH_RANK_BUS_COLLISION   15
+
+/* 
+ * The vectors test the flag, enable and priority bits of every source 
+ * directly (BTFSS/BTFSC) in the rank order, the chain is generated at compile
+ * time from the ranks above. Disabled : the vectors walk the tables of the
+ * registered sources through the register pointers (the baseline of 
+ * BENCHMARK/interrupt_dispatch_test.c, HOST_SIM flag to routine with the 16
+ * sources registered : 9..24 cycles against 18..93 for the tables).
+ */
+#ifndef INTERRUPT_DISPATCH_CHAIN_FEATURE
+#define INTERRUPT_DISPATCH_CHAIN_FEATURE        INTERRUPT_ENABLE
+#endif
 
 /* -------------- Section: Macro Functions Declarations -------------- */
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
@@ -52,7 +96,4 @@ typedef enum {
     PRIORITY_HIGH = STD_HIGH      
 } interrupt_priority_t;
 
-/* -------------- Section: Function Declarations -------------- */
-
 #endif	/* MCAL_INTERRUPT_CFG_H */
-
@@ -1,4 +1,4 @@
-/* 
+/*
  * File:   MCAL_interrupt_manager.c
  * Author: Mostafa Asaad
  *
@@ -7,118 +7,623 @@
 
 /* Section : Includes */
 #include "MCAL_interrupt_manager.h"
+#include "CRITICAL_section/MCAL_critical_section.h"
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+#include "../USART/usart.h"
+#endif
+
+/* Section: Macro Functions Declarations */
+#define INTERRUPT_BIT_MASK(_BIT_POSN_)          ((uint8_t)(1 << (_BIT_POSN_)))
 
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+/* 
+ * The dispatch chain : every rank slot holds one test per source, the
+ * rank comparison is a constant so only the test of the source with this
+ * rank is left, then the vector reads the bits directly.
+ * The vector calls the first pending routine in the rank order and returns,
+ * so the sources after it cost nothing, another pending source brings the
+ * CPU back to the vector.
+ */
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
-void __interrupt() InterruptManagerHigh(void)
-{    
-    if (INTERRUPT_OCCURED == PIR1bits.ADIF)
+/* (_HIGH_ is a constant, the other side of ?: is dropped) */
+#define INTERRUPT_CHAIN_ON_VECTOR(_IP_REG_, _IP_BIT_, _HIGH_) \
+        ((STD_TRUE == (_HIGH_)) ? ((_IP_REG_) & INTERRUPT_BIT_MASK(_IP_BIT_)) : !((_IP_REG_) & INTERRUPT_BIT_MASK(_IP_BIT_)))
+#else
+#define INTERRUPT_CHAIN_ON_VECTOR(_IP_REG_, _IP_BIT_, _HIGH_)   (STD_TRUE)
+#endif
+
+#define INTERRUPT_CHAIN_PENDING(_IE_REG_, _IE_BIT_, _IF_REG_, _IF_BIT_, _IP_REG_, _IP_BIT_, _HIGH_) \
+        (((_IE_REG_) & INTERRUPT_BIT_MASK(_IE_BIT_)) && ((_IF_REG_) & INTERRUPT_BIT_MASK(_IF_BIT_)) && \
+         INTERRUPT_CHAIN_ON_VECTOR(_IP_REG_, _IP_BIT_, _HIGH_))
+
+/* The bits of every source : enable, flag and priority (the same bits as interrupt_source_entry_init()) */
+#define INTERRUPT_CHAIN_PENDING_INT0(_HIGH_)            (((INTCON) & INTERRUPT_BIT_MASK(4)) && ((INTCON) & INTERRUPT_BIT_MASK(1)) && (STD_TRUE == (_HIGH_)))
+#define INTERRUPT_CHAIN_PENDING_INT1(_HIGH_)            INTERRUPT_CHAIN_PENDING(INTCON3, 3, INTCON3, 0, INTCON3, 6, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_INT2(_HIGH_)            INTERRUPT_CHAIN_PENDING(INTCON3, 4, INTCON3, 1, INTCON3, 7, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_RBx(_HIGH_)             INTERRUPT_CHAIN_PENDING(INTCON, 3, INTCON, 0, INTCON2, 0, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_TMR0(_HIGH_)            INTERRUPT_CHAIN_PENDING(INTCON, 5, INTCON, 2, INTCON2, 2, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_TMR1(_HIGH_)            INTERRUPT_CHAIN_PENDING(PIE1, 0, PIR1, 0, IPR1, 0, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_TMR2(_HIGH_)            INTERRUPT_CHAIN_PENDING(PIE1, 1, PIR1, 1, IPR1, 1, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_TMR3(_HIGH_)            INTERRUPT_CHAIN_PENDING(PIE2, 1, PIR2, 1, IPR2, 1, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_CCP1(_HIGH_)            INTERRUPT_CHAIN_PENDING(PIE1, 2, PIR1, 2, IPR1, 2, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_CCP2(_HIGH_)            INTERRUPT_CHAIN_PENDING(PIE2, 0, PIR2, 0, IPR2, 0, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_ADC(_HIGH_)             INTERRUPT_CHAIN_PENDING(PIE1, 6, PIR1, 6, IPR1, 6, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_EUSART_TX(_HIGH_)       INTERRUPT_CHAIN_PENDING(PIE1, 4, PIR1, 4, IPR1, 4, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_EUSART_RX(_HIGH_)       INTERRUPT_CHAIN_PENDING(PIE1, 5, PIR1, 5, IPR1, 5, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_MSSP(_HIGH_)            INTERRUPT_CHAIN_PENDING(PIE1, 3, PIR1, 3, IPR1, 3, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_BUS_COLLISION(_HIGH_)   INTERRUPT_CHAIN_PENDING(PIE2, 3, PIR2, 3, IPR2, 3, _HIGH_)
+#define INTERRUPT_CHAIN_PENDING_EEPROM(_HIGH_)          INTERRUPT_CHAIN_PENDING(PIE2, 4, PIR2, 4, IPR2, 4, _HIGH_)
+
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+#define INTERRUPT_CHAIN_CALL(_SOURCE_)                                                          \
+        l_call_time = interrupt_profile_timestamp();                                            \
+        interrupt_handlers[_SOURCE_]();                                                         \
+        interrupt_profile_record((_SOURCE_), (uint16_t)(l_call_time - l_vector_time),           \
+                                 (uint16_t)(interrupt_profile_timestamp() - l_call_time));
+#define INTERRUPT_CHAIN_PROFILE_LOCALS()                                                        \
+        uint16_t l_vector_time = interrupt_profile_timestamp();                                 \
+        uint16_t l_call_time = ZERO_INIT;
+#else
+#define INTERRUPT_CHAIN_CALL(_SOURCE_)                                                          \
+        interrupt_handlers[_SOURCE_]();
+#define INTERRUPT_CHAIN_PROFILE_LOCALS()
+#endif
+
+/* One link of the if / else if chain (an unregistered source is passed over) */
+#define INTERRUPT_CHAIN_TRY(_SOURCE_, _RANK_, _HIGH_)                                           \
+        if((INTERRUPT_DISPATCH_RANK_##_SOURCE_ == (_RANK_)) && INTERRUPT_CHAIN_PENDING_##_SOURCE_(_HIGH_) && \
+           (NULL != interrupt_handlers[INTERRUPT_SOURCE_##_SOURCE_]))                          \
+            { INTERRUPT_CHAIN_CALL(INTERRUPT_SOURCE_##_SOURCE_) }                               \
+        else
+
+#define INTERRUPT_CHAIN_RANK(_RANK_, _HIGH_)                                                    \
+        INTERRUPT_CHAIN_TRY(INT0, _RANK_, _HIGH_)           INTERRUPT_CHAIN_TRY(INT1, _RANK_, _HIGH_)       \
+        INTERRUPT_CHAIN_TRY(INT2, _RANK_, _HIGH_)           INTERRUPT_CHAIN_TRY(RBx, _RANK_, _HIGH_)        \
+        INTERRUPT_CHAIN_TRY(TMR0, _RANK_, _HIGH_)           INTERRUPT_CHAIN_TRY(TMR1, _RANK_, _HIGH_)       \
+        INTERRUPT_CHAIN_TRY(TMR2, _RANK_, _HIGH_)           INTERRUPT_CHAIN_TRY(TMR3, _RANK_, _HIGH_)       \
+        INTERRUPT_CHAIN_TRY(CCP1, _RANK_, _HIGH_)           INTERRUPT_CHAIN_TRY(CCP2, _RANK_, _HIGH_)       \
+        INTERRUPT_CHAIN_TRY(ADC, _RANK_, _HIGH_)            INTERRUPT_CHAIN_TRY(EUSART_TX, _RANK_, _HIGH_)  \
+        INTERRUPT_CHAIN_TRY(EUSART_RX, _RANK_, _HIGH_)      INTERRUPT_CHAIN_TRY(MSSP, _RANK_, _HIGH_)       \
+        INTERRUPT_CHAIN_TRY(BUS_COLLISION, _RANK_, _HIGH_)  INTERRUPT_CHAIN_TRY(EEPROM, _RANK_, _HIGH_)
+
+/* The body of a vector, _HIGH_ : (STD_TRUE) for the high vector, (STD_FALSE) for the low one */
+#define INTERRUPT_CHAIN_DISPATCH(_HIGH_)                                                        \
+        do {                                                                                    \
+            INTERRUPT_CHAIN_PROFILE_LOCALS()                                                    \
+            INTERRUPT_CHAIN_RANK(0, _HIGH_)     INTERRUPT_CHAIN_RANK(1, _HIGH_)                 \
+            INTERRUPT_CHAIN_RANK(2, _HIGH_)     INTERRUPT_CHAIN_RANK(3, _HIGH_)                 \
+            INTERRUPT_CHAIN_RANK(4, _HIGH_)     INTERRUPT_CHAIN_RANK(5, _HIGH_)                 \
+            INTERRUPT_CHAIN_RANK(6, _HIGH_)     INTERRUPT_CHAIN_RANK(7, _HIGH_)                 \
+            INTERRUPT_CHAIN_RANK(8, _HIGH_)     INTERRUPT_CHAIN_RANK(9, _HIGH_)                 \
+            INTERRUPT_CHAIN_RANK(10, _HIGH_)    INTERRUPT_CHAIN_RANK(11, _HIGH_)                \
+            INTERRUPT_CHAIN_RANK(12, _HIGH_)    INTERRUPT_CHAIN_RANK(13, _HIGH_)                \
+            INTERRUPT_CHAIN_RANK(14, _HIGH_)    INTERRUPT_CHAIN_RANK(15, _HIGH_)                \
+            { /* Nothing */ }                                                                   \
+        } while(0)
+#endif
+
+/* Section : Global Variables */
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+volatile uint8_t interrupt_high_vector_active = STD_FALSE;
+#endif
+
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+/* The routines of the registered sources, the priority bits do the routing */
+static interrupt_handler_t interrupt_handlers[INTERRUPT_SOURCES_NUMBER];
+#else
+/* The routing of the registered sources, one table per vector */
+static interrupt_table_t interrupt_high_table;
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+static interrupt_table_t interrupt_low_table;
+#endif
+#endif
+
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+static interrupt_profile_t interrupt_profile_table[INTERRUPT_SOURCES_NUMBER];
+
+static const uint8_t *const interrupt_source_names[INTERRUPT_SOURCES_NUMBER] = {
+    (const uint8_t *)"INT0",      (const uint8_t *)"INT1",      (const uint8_t *)"INT2",
+    (const uint8_t *)"RBx",       (const uint8_t *)"TMR0",      (const uint8_t *)"TMR1",
+    (const uint8_t *)"TMR2",      (const uint8_t *)"TMR3",      (const uint8_t *)"CCP1",
+    (const uint8_t *)"CCP2",      (const uint8_t *)"ADC",       (const uint8_t *)"EUSART_TX",
+    (const uint8_t *)"EUSART_RX", (const uint8_t *)"MSSP",      (const uint8_t *)"BCL",
+    (const uint8_t *)"EEPROM"
+};
+#endif
+
+/* Section : Helper Functions Declarations */
+static Std_ReturnType interrupt_source_entry_init(interrupt_entry_t *_entry, interrupt_source_t source);
+static void interrupt_entry_set(interrupt_entry_t *_entry,
+                                volatile uint8_t *flag_register, uint8_t flag_bit,
+                                volatile uint8_t *enable_register, uint8_t enable_bit,
+                                volatile uint8_t *priority_register, uint8_t priority_bit,
+                                uint8_t rank);
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_DISABLE
+static uint8_t interrupt_table_remove(interrupt_table_t *_table, interrupt_source_t source,
+                                      interrupt_entry_t *_entry);
+static void interrupt_table_insert(interrupt_table_t *_table, const interrupt_entry_t *_entry);
+static void interrupt_manager_route(const interrupt_entry_t *_entry);
+static void interrupt_manager_dispatch(const interrupt_table_t *_table);
+#endif
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+static uint16_t interrupt_profile_timestamp(void);
+static void interrupt_profile_record(interrupt_source_t source, uint16_t latency, uint16_t duration);
+#endif
+
+/* Section : Function Definitions */
+/**
+ * @brief : Registers the interrupt service routine of a source,
+ *          the vector calls it only while the source is enabled
+ *          and its flag is set.
+ *          The source is routed to the vector selected by its
+ *          priority bit, so the driver assigns the priority first.
+ *          Registering the same source again replaces its routine.
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param handler : The driver interrupt service routine.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType Interrupt_Manager_Register(interrupt_source_t source, interrupt_handler_t handler)
+{
+    Std_ReturnType ret = E_OK;
+    interrupt_entry_t l_entry;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if((NULL == handler) || (source >= INTERRUPT_SOURCES_NUMBER))
     {
-        INTI_ADC_ISR();
+        ret = E_NOT_OK;
     }
     else
-        { /* Nothing */ }
-    
-    if (INTERRUPT_OCCURED == INTCONbits.T0IF)
     {
-        INTI_TMR0_ISR();
+        ret = interrupt_source_entry_init(&l_entry, source);
+        l_entry.handler = handler;
+
+        /* The tables are walked by the vectors, keep them out while they change */
+        l_critical_state = Critical_Section_Enter();
+
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+        interrupt_handlers[source] = handler;
+#else
+        /* Remove the old registration of the source then route it */
+        interrupt_table_remove(&interrupt_high_table, source, NULL);
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+        interrupt_table_remove(&interrupt_low_table, source, NULL);
+#endif
+        interrupt_manager_route(&l_entry);
+#endif
+
+        Critical_Section_Exit(l_critical_state);
     }
-    else
-        { /* Nothing */ }
-    
-    if (INTERRUPT_OCCURED == PIR1bits.TMR1IF)
+    return ret;
+}
+
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+/**
+ * @brief : Moves a source to the high or the low priority vector,
+ *          the priority bit of the source is updated as well.
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param priority : (PRIORITY_HIGH) or (PRIORITY_LOW).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                       (INT0 can't be moved to the low priority)
+ */
+Std_ReturnType Interrupt_Manager_Set_Priority(interrupt_source_t source, interrupt_priority_t priority)
+{
+    Std_ReturnType ret = E_OK;
+    interrupt_entry_t l_entry;
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_DISABLE
+    uint8_t l_registered = STD_FALSE;
+#endif
+    critical_state_t l_critical_state = ZERO_INIT;
+    if(source >= INTERRUPT_SOURCES_NUMBER)
     {
-        INTI_TMR1_ISR();
+        ret = E_NOT_OK;
     }
     else
-        { /* Nothing */ }
-    
-    if (INTERRUPT_OCCURED == PIR1bits.TMR2IF)
     {
-        INTI_TMR2_ISR();
+        ret = interrupt_source_entry_init(&l_entry, source);
+        if(NULL == l_entry.priority_register)
+        {
+            /* INT0 is always at high priority */
+            ret = (PRIORITY_HIGH == priority) ? E_OK : E_NOT_OK;
+        }
+        else
+        {
+            l_critical_state = Critical_Section_Enter();
+
+            if(PRIORITY_HIGH == priority)
+                { *(l_entry.priority_register) |= l_entry.priority_mask; }
+            else
+                { *(l_entry.priority_register) &= (uint8_t)~(l_entry.priority_mask); }
+
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_DISABLE
+            l_registered = interrupt_table_remove(&interrupt_high_table, source, &l_entry);
+            l_registered |= interrupt_table_remove(&interrupt_low_table, source, &l_entry);
+            if(STD_TRUE == l_registered)
+                { interrupt_manager_route(&l_entry); }
+            else
+                { /* Nothing */ }
+#endif
+
+            Critical_Section_Exit(l_critical_state);
+        }
     }
-    else
-        { /* Nothing */ }
-    
-    if (INTERRUPT_OCCURED == PIR2bits.TMR3IF)
+    return ret;
+}
+#endif
+
+/**
+ * @brief : Gets the enable bit of an interrupt source.
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param enable_register : Receives the address of the enable register.
+ * @param enable_mask : Receives the mask of the enable bit.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType Interrupt_Manager_Get_Enable(interrupt_source_t source, volatile uint8_t **enable_register,
+                                            uint8_t *enable_mask)
+{
+    Std_ReturnType ret = E_OK;
+    interrupt_entry_t l_entry;
+    if((NULL == enable_register) || (NULL == enable_mask) || (source >= INTERRUPT_SOURCES_NUMBER))
     {
-        INTI_TMR3_ISR();
+        ret = E_NOT_OK;
     }
     else
-        { /* Nothing */ }
-    
-    if ((INTERRUPT_ENABLE == PIE1bits.CCP1IE) && (INTERRUPT_OCCURED == PIR1bits.CCP1IF))
     {
-        CCP1_ISR();
+        ret = interrupt_source_entry_init(&l_entry, source);
+        *enable_register = l_entry.enable_register;
+        *enable_mask = l_entry.enable_mask;
     }
-    else
-        { /* Nothing */ }
-    
-    if (INTERRUPT_OCCURED == PIR2bits.CCP2IF)
+    return ret;
+}
+
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+void __interrupt() InterruptManagerHigh(void)
+{
+    /* The routines may clear GIEH (critical sections), the context is told by this flag */
+    interrupt_high_vector_active = STD_TRUE;
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+    INTERRUPT_CHAIN_DISPATCH(STD_TRUE);
+#else
+    interrupt_manager_dispatch(&interrupt_high_table);
+#endif
+    interrupt_high_vector_active = STD_FALSE;
+}
+
+void __interrupt(low_priority) InterruptManagerLow(void)
+{
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+    INTERRUPT_CHAIN_DISPATCH(STD_FALSE);
+#else
+    interrupt_manager_dispatch(&interrupt_low_table);
+#endif
+}
+#else
+void __interrupt() InterruptManager(void)      /* IVT */  /* Address = 0x08 */
+{
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_ENABLE
+    INTERRUPT_CHAIN_DISPATCH(STD_TRUE);
+#else
+    interrupt_manager_dispatch(&interrupt_high_table);
+#endif
+}
+#endif
+
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+/**
+ * @brief : Reads the profile of an interrupt source.
+ * @param source : The interrupt source (@ref interrupt_source_t).
+ * @param profile : Receives a consistent copy of the profile.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType Interrupt_Profile_Get(interrupt_source_t source, interrupt_profile_t *profile)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if((NULL == profile) || (source >= INTERRUPT_SOURCES_NUMBER))
     {
-        CCP2_ISR();
+        ret = E_NOT_OK;
     }
     else
-        { /* Nothing */ }
-    
-    if ((INTERRUPT_ENABLE == PIE1bits.TXIE) && (INTERRUPT_OCCURED == PIR1bits.TXIF))
     {
-        USART_TX_ISR();
+        l_critical_state = Critical_Section_Enter();
+        *profile = interrupt_profile_table[source];
+        Critical_Section_Exit(l_critical_state);
     }
-    else
-        { /* Nothing */ }
-    
-    if ((INTERRUPT_ENABLE == PIE1bits.RCIE) && (INTERRUPT_OCCURED == PIR1bits.RCIF))
+    return ret;
+}
+
+/**
+ * @brief : Clears the profiles of all the interrupt sources.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ */
+Std_ReturnType Interrupt_Profile_Reset(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Enter();
+    for(l_index = ZERO_INIT; l_index < INTERRUPT_SOURCES_NUMBER; l_index++)
     {
-        USART_RX_ISR();
+        interrupt_profile_table[l_index].duration_sum = ZERO_INIT;
+        interrupt_profile_table[l_index].hits = ZERO_INIT;
+        interrupt_profile_table[l_index].duration_min = ZERO_INIT;
+        interrupt_profile_table[l_index].duration_max = ZERO_INIT;
+        interrupt_profile_table[l_index].latency_max = ZERO_INIT;
     }
-    else
-        { /* Nothing */ }
-    if ((INTERRUPT_ENABLE == PIE1bits.SSPIE) && (INTERRUPT_OCCURED == PIR1bits.SSPIF))
+    Critical_Section_Exit(l_critical_state);
+    return ret;
+}
+
+/**
+ * @brief : Writes the profiles of the sources which fired over the
+ *          EUSART (blocking), one line per source :
+ *          "<source> hits min avg max latency" in TIMER1 ticks.
+ *          The EUSART must be initialized by the application.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType Interrupt_Profile_Dump(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+    interrupt_profile_t l_profile;
+    for(l_index = ZERO_INIT; l_index < INTERRUPT_SOURCES_NUMBER; l_index++)
     {
-        SPI_ISR();
+        ret |= Interrupt_Profile_Get((interrupt_source_t)l_index, &l_profile);
+        if(ZERO_INIT != l_profile.hits)
+        {
+            ret |= USART_ASYNC_Write_String_With_Blocking(interrupt_source_names[l_index]);
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_profile.hits);
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_profile.duration_min);
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)(l_profile.duration_sum / l_profile.hits));
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_profile.duration_max);
+            ret |= USART_ASYNC_Write_Byte_With_Blocking(' ');
+            ret |= USART_ASYNC_Write_Number_With_Blocking((sint32_t)l_profile.latency_max);
+            ret |= USART_ASYNC_Write_String_With_Blocking((const uint8_t *)"\r\n");
+        }
+        else
+            { /* Nothing */ }
     }
-    else
-        { /* Nothing */ }
+    return ret;
 }
+#endif
 
-void __interrupt(low_priority) InterruptManagerLow(void)
+/* Section : Helper Functions Definitions */
+#if INTERRUPT_DISPATCH_CHAIN_FEATURE==INTERRUPT_DISABLE
+/**
+ * @brief : Calls the routines of the registered sources which are
+ *          enabled and have their flag set, in the rank order.
+ * @param _table : The table of the running vector.
+ */
+static void interrupt_manager_dispatch(const interrupt_table_t *_table)
 {
-    
-}
+    uint8_t l_index = ZERO_INIT;
+    const interrupt_entry_t *l_entry = NULL;
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+    uint16_t l_vector_time = interrupt_profile_timestamp();
+    uint16_t l_call_time = ZERO_INIT;
+#endif
+    for(l_index = ZERO_INIT; l_index < _table->size; l_index++)
+    {
+        l_entry = &(_table->entries[l_index]);
+        if((SFR_INDIRECT(l_entry->enable_register) & l_entry->enable_mask) &&
+           (SFR_INDIRECT(l_entry->flag_register) & l_entry->flag_mask))
+        {
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+            l_call_time = interrupt_profile_timestamp();
+            l_entry->handler();
+            interrupt_profile_record(l_entry->source, (uint16_t)(l_call_time - l_vector_time),
+                                     (uint16_t)(interrupt_profile_timestamp() - l_call_time));
 #else
-void __interrupt() InterruptManager(void)      /* IVT */  /* Address = 0x08 */    
+            l_entry->handler();
+#endif
+        }
+        else
+            { /* Nothing */ }
+    }
+}
+
+/**
+ * @brief : Adds an entry to the table of the vector selected by
+ *          the priority bit of its source.
+ */
+static void interrupt_manager_route(const interrupt_entry_t *_entry)
 {
-    if((INTERRUPT_ENABLE == INTCONbits.INT0IE) && (INTERRUPT_OCCURED == INTCONbits.INT0IF))
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    if((NULL == _entry->priority_register) ||
+       (*(_entry->priority_register) & _entry->priority_mask))
     {
-        INT0_ISR();
+        interrupt_table_insert(&interrupt_high_table, _entry);
     }
-    else 
-        { /* Nothing */ }
-    
-    if((INTERRUPT_ENABLE == INTCON3bits.INT1IE) && (INTERRUPT_OCCURED == INTCON3bits.INT1IF))
+    else
     {
-        INT1_ISR();
+        interrupt_table_insert(&interrupt_low_table, _entry);
     }
-    else
-        { /* Nothing */ }
-    
-    if((INTERRUPT_ENABLE == INTCON3bits.INT2IE) && (INTERRUPT_OCCURED == INTCON3bits.INT2IF))
+#else
+    interrupt_table_insert(&interrupt_high_table, _entry);
+#endif
+}
+
+/**
+ * @brief : Removes the entry of a source from a table.
+ * @param _entry : Receives the removed entry (can be NULL).
+ * @return (STD_TRUE) if the source was in the table.
+ */
+static uint8_t interrupt_table_remove(interrupt_table_t *_table, interrupt_source_t source,
+                                      interrupt_entry_t *_entry)
+{
+    uint8_t l_removed = STD_FALSE;
+    uint8_t l_index = ZERO_INIT;
+    for(l_index = ZERO_INIT; l_index < _table->size; l_index++)
     {
-        INT2_ISR();
+        if(source == _table->entries[l_index].source)
+        {
+            if(NULL != _entry)
+                { *_entry = _table->entries[l_index]; }
+            else
+                { /* Nothing */ }
+            _table->size--;
+            for( ; l_index < _table->size; l_index++)
+            {
+                _table->entries[l_index] = _table->entries[l_index + 1];
+            }
+            l_removed = STD_TRUE;
+        }
+        else
+            { /* Nothing */ }
     }
-    else
-        { /* Nothing */ }
-    
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCURED == INTCONbits.RBIF))
+    return l_removed;
+}
+
+/**
+ * @brief : Inserts an entry in a table at its dispatch rank.
+ */
+static void interrupt_table_insert(interrupt_table_t *_table, const interrupt_entry_t *_entry)
+{
+    uint8_t l_index = _table->size;
+    while((l_index > ZERO_INIT) && (_table->entries[l_index - 1].rank > _entry->rank))
     {
-        
+        _table->entries[l_index] = _table->entries[l_index - 1];
+        l_index--;
     }
-    else
-        { /* Nothing */ }
-    
-    if ( (INTERRUPT_ENABLE == INTCONbits.T0IE) && (INTERRUPT_OCCURED == INTCONbits.T0IF) )
+    _table->entries[l_index] = *_entry;
+    _table->size++;
+}
+#endif
+
+static void interrupt_entry_set(interrupt_entry_t *_entry,
+                                volatile uint8_t *flag_register, uint8_t flag_bit,
+                                volatile uint8_t *enable_register, uint8_t enable_bit,
+                                volatile uint8_t *priority_register, uint8_t priority_bit,
+                                uint8_t rank)
+{
+    _entry->flag_register = flag_register;
+    _entry->flag_mask = INTERRUPT_BIT_MASK(flag_bit);
+    _entry->enable_register = enable_register;
+    _entry->enable_mask = INTERRUPT_BIT_MASK(enable_bit);
+    _entry->priority_register = priority_register;
+    _entry->priority_mask = INTERRUPT_BIT_MASK(priority_bit);
+    _entry->rank = rank;
+}
+
+/**
+ * @brief : Fills the flag, enable and priority bits locations of a source.
+ * @param _entry : The entry to be filled.
+ * @param source : The interrupt source.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+static Std_ReturnType interrupt_source_entry_init(interrupt_entry_t *_entry, interrupt_source_t source)
+{
+    Std_ReturnType ret = E_OK;
+    _entry->source = source;
+    switch(source)
+    {
+        case INTERRUPT_SOURCE_INT0 :        /* INT0IF : INTCON<1>, INT0IE : INTCON<4>, always high */
+            interrupt_entry_set(_entry, &INTCON, 1, &INTCON, 4, NULL, 0, INTERRUPT_DISPATCH_RANK_INT0);
+            break;
+        case INTERRUPT_SOURCE_INT1 :        /* INT1IF : INTCON3<0>, INT1IE : INTCON3<3>, INT1IP : INTCON3<6> */
+            interrupt_entry_set(_entry, &INTCON3, 0, &INTCON3, 3, &INTCON3, 6, INTERRUPT_DISPATCH_RANK_INT1);
+            break;
+        case INTERRUPT_SOURCE_INT2 :        /* INT2IF : INTCON3<1>, INT2IE : INTCON3<4>, INT2IP : INTCON3<7> */
+            interrupt_entry_set(_entry, &INTCON3, 1, &INTCON3, 4, &INTCON3, 7, INTERRUPT_DISPATCH_RANK_INT2);
+            break;
+        case INTERRUPT_SOURCE_RBx :         /* RBIF : INTCON<0>, RBIE : INTCON<3>, RBIP : INTCON2<0> */
+            interrupt_entry_set(_entry, &INTCON, 0, &INTCON, 3, &INTCON2, 0, INTERRUPT_DISPATCH_RANK_RBx);
+            break;
+        case INTERRUPT_SOURCE_TMR0 :        /* TMR0IF : INTCON<2>, TMR0IE : INTCON<5>, TMR0IP : INTCON2<2> */
+            interrupt_entry_set(_entry, &INTCON, 2, &INTCON, 5, &INTCON2, 2, INTERRUPT_DISPATCH_RANK_TMR0);
+            break;
+        case INTERRUPT_SOURCE_TMR1 :
+            interrupt_entry_set(_entry, &PIR1, 0, &PIE1, 0, &IPR1, 0, INTERRUPT_DISPATCH_RANK_TMR1);
+            break;
+        case INTERRUPT_SOURCE_TMR2 :
+            interrupt_entry_set(_entry, &PIR1, 1, &PIE1, 1, &IPR1, 1, INTERRUPT_DISPATCH_RANK_TMR2);
+            break;
+        case INTERRUPT_SOURCE_TMR3 :
+            interrupt_entry_set(_entry, &PIR2, 1, &PIE2, 1, &IPR2, 1, INTERRUPT_DISPATCH_RANK_TMR3);
+            break;
+        case INTERRUPT_SOURCE_CCP1 :
+            interrupt_entry_set(_entry, &PIR1, 2, &PIE1, 2, &IPR1, 2, INTERRUPT_DISPATCH_RANK_CCP1);
+            break;
+        case INTERRUPT_SOURCE_CCP2 :
+            interrupt_entry_set(_entry, &PIR2, 0, &PIE2, 0, &IPR2, 0, INTERRUPT_DISPATCH_RANK_CCP2);
+            break;
+        case INTERRUPT_SOURCE_ADC :
+            interrupt_entry_set(_entry, &PIR1, 6, &PIE1, 6, &IPR1, 6, INTERRUPT_DISPATCH_RANK_ADC);
+            break;
+        case INTERRUPT_SOURCE_EUSART_TX :
+            interrupt_entry_set(_entry, &PIR1, 4, &PIE1, 4, &IPR1, 4, INTERRUPT_DISPATCH_RANK_EUSART_TX);
+            break;
+        case INTERRUPT_SOURCE_EUSART_RX :
+            interrupt_entry_set(_entry, &PIR1, 5, &PIE1, 5, &IPR1, 5, INTERRUPT_DISPATCH_RANK_EUSART_RX);
+            break;
+        case INTERRUPT_SOURCE_MSSP :
+            interrupt_entry_set(_entry, &PIR1, 3, &PIE1, 3, &IPR1, 3, INTERRUPT_DISPATCH_RANK_MSSP);
+            break;
+        case INTERRUPT_SOURCE_BUS_COLLISION :
+            interrupt_entry_set(_entry, &PIR2, 3, &PIE2, 3, &IPR2, 3, INTERRUPT_DISPATCH_RANK_BUS_COLLISION);
+            break;
+        case INTERRUPT_SOURCE_EEPROM :
+            interrupt_entry_set(_entry, &PIR2, 4, &PIE2, 4, &IPR2, 4, INTERRUPT_DISPATCH_RANK_EEPROM);
+            break;
+        default :
+            ret = E_NOT_OK;
+            break;
+    }
+    return ret;
+}
+
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+/**
+ * @brief : Reads the free running TIMER1 without tearing, reading TMR1L
+ *          latches TMR1H (16-bit read mode) so the low byte goes first.
+ * @return The TIMER1 count.
+ */
+static uint16_t interrupt_profile_timestamp(void)
+{
+    uint8_t l_low_byte = TMR1L;
+    uint8_t l_high_byte = TMR1H;
+    return (uint16_t)(((uint16_t)l_high_byte << 8) | l_low_byte);
+}
+
+/**
+ * @brief : Adds one call to the profile of a source.
+ *          (A low priority routine preempted by the high vector
+ *           is charged with the preempting time as well)
+ */
+static void interrupt_profile_record(interrupt_source_t source, uint16_t latency, uint16_t duration)
+{
+    interrupt_profile_t *l_profile = &interrupt_profile_table[source];
+    /* The profile is frozen once the hits counter saturates */
+    if(0xFFFF != l_profile->hits)
     {
-        INTI_TMR0_ISR();
+        if((ZERO_INIT == l_profile->hits) || (duration < l_profile->duration_min))
+            { l_profile->duration_min = duration; }
+        else
+            { /* Nothing */ }
+        if(duration > l_profile->duration_max)
+            { l_profile->duration_max = duration; }
+        else
+            { /* Nothing */ }
+        if(latency > l_profile->latency_max)
+            { l_profile->latency_max = latency; }
+        else
+            { /* Nothing */ }
+        l_profile->duration_sum += duration;
+        l_profile->hits++;
     }
     else
         { /* Nothing */ }
@@ -15,17 +15,96 @@
 /* Section: Macro Declarations */
 
 /* Section: Macro Functions Declarations */
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+/* (STD_TRUE) while the high priority vector runs, even when it preempts the low one */
+#define INTERRUPT_MANAGER_IN_HIGH_VECTOR()      (STD_TRUE == interrupt_high_vector_active)
+#endif
 
 /* Section: Data Type Declarations */
+/* The interrupt sources of the manager */
+typedef enum {
+    INTERRUPT_SOURCE_INT0 = 0,
+    INTERRUPT_SOURCE_INT1,
+    INTERRUPT_SOURCE_INT2,
+    INTERRUPT_SOURCE_RBx,
+    INTERRUPT_SOURCE_TMR0,
+    INTERRUPT_SOURCE_TMR1,
+    INTERRUPT_SOURCE_TMR2,
+    INTERRUPT_SOURCE_TMR3,
+    INTERRUPT_SOURCE_CCP1,
+    INTERRUPT_SOURCE_CCP2,
+    INTERRUPT_SOURCE_ADC,
+    INTERRUPT_SOURCE_EUSART_TX,
+    INTERRUPT_SOURCE_EUSART_RX,
+    INTERRUPT_SOURCE_MSSP,
+    INTERRUPT_SOURCE_BUS_COLLISION,
+    INTERRUPT_SOURCE_EEPROM,
+    INTERRUPT_SOURCES_NUMBER
+} interrupt_source_t;
+
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+/* 
+ * The profile of one interrupt source, the times are in TIMER1 ticks.
+ * (latency_max : the worst time from the vector entry to the routine call)
+ */
+typedef struct {
+    uint32_t duration_sum;
+    uint16_t hits;
+    uint16_t duration_min;
+    uint16_t duration_max;
+    uint16_t latency_max;
+} interrupt_profile_t;
+#endif
+
+/* 
+ * A registered interrupt source, the flag and the enable bits
+ * are checked through the register pointers so the dispatcher
+ * handles every source the same way.
+ * (priority_register is NULL for INT0, always at high priority)
+ * (The tables are used by the vectors only when
+ *  INTERRUPT_DISPATCH_CHAIN_FEATURE is disabled)
+ */
+typedef struct {
+    interrupt_handler_t handler;
+    volatile uint8_t *flag_register;
+    volatile uint8_t *enable_register;
+    volatile uint8_t *priority_register;
+    uint8_t flag_mask;
+    uint8_t enable_mask;
+    uint8_t priority_mask;
+    uint8_t rank;
+    interrupt_source_t source;
+} interrupt_entry_t;
+
+/* The registered sources of one vector, sorted by their dispatch rank */
+typedef struct {
+    interrupt_entry_t entries[INTERRUPT_SOURCES_NUMBER];
+    uint8_t size;
+} interrupt_table_t;
+
+/* Section: Global Variables Declarations */
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+/* Set by the high priority vector for its whole run (read it with INTERRUPT_MANAGER_IN_HIGH_VECTOR()) */
+extern volatile uint8_t interrupt_high_vector_active;
+#endif
 
 /* Section: Function Declarations */
+Std_ReturnType Interrupt_Manager_Register(interrupt_source_t source, interrupt_handler_t handler);
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+Std_ReturnType Interrupt_Manager_Set_Priority(interrupt_source_t source, interrupt_priority_t priority);
+#endif
+Std_ReturnType Interrupt_Manager_Get_Enable(interrupt_source_t source, volatile uint8_t **enable_register,
+                                            uint8_t *enable_mask);
+#if INTERRUPT_PROFILING_FEATURE==INTERRUPT_ENABLE
+Std_ReturnType Interrupt_Profile_Get(interrupt_source_t source, interrupt_profile_t *profile);
+Std_ReturnType Interrupt_Profile_Reset(void);
+Std_ReturnType Interrupt_Profile_Dump(void);
+#endif
+
 void INT0_ISR(void);
 void INT1_ISR(void);
 void INT2_ISR(void);
-void RB4_ISR(uint8_t mode);
-void RB5_ISR(uint8_t mode);
-void RB6_ISR(uint8_t mode);
-void RB7_ISR(uint8_t mode);
+void RBx_ISR(void);
 
 #if ADC_INTERRUPT_FEATURE==INTERRUPT_ENABLE
 void INTI_ADC_ISR(void);
@@ -67,5 +146,9 @@ void USART_RX_ISR(void);
 void SPI_ISR(void);
 #endif
 
+#if I2C_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+void I2C_ISR(void);
+#endif
+
 #endif	/* MCAL_INTERRUPT_MANAGER_H */
 
@@ -6,6 +6,8 @@
  */
 
 #include "spi.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
 
 #if SPI_INTERRUPT_FEATURE == INTERRUPT_ENABLE
 static interrupt_handler_t SPI_Interrupt_Handler = NULL;
@@ -188,6 +190,10 @@ Std_ReturnType SPI_Read_Byte_NoBlocking(uint8_t *_data)
     }
     else
     {
+#if SPI_INTERRUPT_FEATURE == INTERRUPT_ENABLE
+        /* The SPI ISR must not take the byte between the check and the read */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_MSSP);
+#endif
         if(PIR1bits.SSPIF)
         {
             *_data = SSPBUF;
@@ -195,6 +201,9 @@ Std_ReturnType SPI_Read_Byte_NoBlocking(uint8_t *_data)
         }
         else
             { ret = E_NOT_OK; }
+#if SPI_INTERRUPT_FEATURE == INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_MSSP, l_critical_state);
+#endif
     }
     return ret;
 }
@@ -231,12 +240,19 @@ Std_ReturnType SPI_Write_Byte_Blocking( uint8_t _data)
 Std_ReturnType SPI_Write_Byte_NoBlocking( uint8_t _data)
 {
     Std_ReturnType ret = E_OK;
+#if SPI_INTERRUPT_FEATURE == INTERRUPT_ENABLE
+    /* The flag is cleared here, keep the SPI ISR out until the buffer is written */
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_MSSP);
+#endif
     
     if((STD_HIGH == SSPSTATbits.BF) || (STD_LOW == PIR1bits.SSPIF))
     {
         PIR1bits.SSPIF = STD_LOW;
         SSPBUF = _data;
     }
+#if SPI_INTERRUPT_FEATURE == INTERRUPT_ENABLE
+    Critical_Section_Unmask_Source(INTERRUPT_SOURCE_MSSP, l_critical_state);
+#endif
     return ret;
 }
 /**
@@ -306,8 +322,6 @@ void SPI_ISR(void)
 #if SPI_INTERRUPT_FEATURE == INTERRUPT_ENABLE
 static void SPI_Interrupt_Init(const SPI_Slave_t *_spi)
 {
-    /* Enable the Interrupts for the SPI module */
-    INTI_SPI_INTERRUPT_ENABLE();
     /* Assign the Interrupt handler */
     SPI_Interrupt_Handler = _spi -> SPI_InterruptHandler;
     
@@ -331,5 +345,9 @@ static void SPI_Interrupt_Init(const SPI_Slave_t *_spi)
         INTERRUPT_GIEH_ENABLE();
         INTERRUPT_GIEL_ENABLE();
 #endif
+    /* Route the SPI interrupt to its vector */
+    Interrupt_Manager_Register(INTERRUPT_SOURCE_MSSP, SPI_ISR);
+    /* Enable the Interrupts for the SPI module, once routed */
+    INTI_SPI_INTERRUPT_ENABLE();
 }
 #endif
\ No newline at end of file
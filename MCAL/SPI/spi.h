@@ -8,8 +8,8 @@
 #ifndef HAL_SPI_H
 #define	HAL_SPI_H
 /*---------------------- Section : Includes ----------------------*/
-#include "pic18f4620.h"
-#include "../mcal_std_types.h"
+#include "../compiler.h"
+#include "../MCAL_std_types.h"
 #include "../DIO/DIO.h"
 #include "../Interrupt/INT_interrupts/MCAL_INTI.h"
 /*---------------------- Section : Macro Declarations------------ */
@@ -0,0 +1,326 @@
+/*
+ * File:   sw_timer.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+/* --------------- Section : Includes --------------- */
+#include "sw_timer.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+
+#if TMR0_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+/* --------------- Section: Macro Declarations --------------- */
+#define SW_TIMER_WHEEL_MASK             (SW_TIMER_WHEEL_SLOTS - 1U)
+
+/* --------------- Section : Global Variables --------------- */
+/* The slot lists heads, a timer is kept in the slot of the level its delay fits */
+static sw_timer_link_t sw_timer_wheel[SW_TIMER_WHEEL_LEVELS][SW_TIMER_WHEEL_SLOTS];
+/* The TIMER0 interrupts since sw_timer_init() */
+static volatile uint32_t sw_timer_ticks = ZERO_INIT;
+/* The expired timers waiting for sw_timer_dispatch(), oldest first */
+static sw_timer_t *sw_timer_deferred_head = NULL;
+static sw_timer_t *sw_timer_deferred_tail = NULL;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void sw_timer_tick(void);
+static void sw_timer_insert(sw_timer_t *_sw_timer);
+static void sw_timer_unlink(sw_timer_t *_sw_timer);
+static void sw_timer_cascade(uint8_t level, uint8_t index);
+static void sw_timer_expire(sw_timer_t *_sw_timer);
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ * @brief : Initializes the software timers service,
+ *          every TIMER0 interrupt is one software timers tick.
+ * @param _timer : The TIMER0 configurations of the tick,
+ *                 its interrupt handler is replaced by the service.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType sw_timer_init(const Timer0_t *_timer)
+{
+    Std_ReturnType ret = E_OK;
+    Timer0_t l_tick_timer;
+    uint8_t l_level = ZERO_INIT;
+    uint8_t l_index = ZERO_INIT;
+    if(NULL == _timer)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_level = ZERO_INIT; l_level < SW_TIMER_WHEEL_LEVELS; l_level++)
+        {
+            for(l_index = ZERO_INIT; l_index < SW_TIMER_WHEEL_SLOTS; l_index++)
+            {
+                sw_timer_wheel[l_level][l_index].next = &sw_timer_wheel[l_level][l_index];
+                sw_timer_wheel[l_level][l_index].prev = &sw_timer_wheel[l_level][l_index];
+            }
+        }
+        sw_timer_ticks = ZERO_INIT;
+        sw_timer_deferred_head = NULL;
+        sw_timer_deferred_tail = NULL;
+
+        l_tick_timer = *_timer;
+        l_tick_timer.TMR0_INTERRUPT_HANDLER = sw_timer_tick;
+        ret = timer0_init(&l_tick_timer);
+    }
+    return ret;
+}
+
+/**
+ * @brief : Starts a software timer, a running timer is restarted.
+ * @param _sw_timer : The software timer, its callback and context are set.
+ * @param delay : The ticks to the first expiry (1 --> 65535).
+ * @param period : The ticks between the next expiries (ZERO_INIT : one-shot).
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType sw_timer_start(sw_timer_t *_sw_timer, uint16_t delay, uint16_t period)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if((NULL == _sw_timer) || (NULL == _sw_timer->callback) || (ZERO_INIT == delay))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR0);
+        if(STD_TRUE == _sw_timer->active)
+            { sw_timer_unlink(_sw_timer); }
+        else
+            { /* Nothing */ }
+        _sw_timer->pending = STD_FALSE;
+        _sw_timer->period = period;
+        _sw_timer->expiry = sw_timer_ticks + delay;
+        sw_timer_insert(_sw_timer);
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR0, l_critical_state);
+    }
+    return ret;
+}
+
+/**
+ * @brief : Stops a software timer, its deferred callback is cancelled as well.
+ * @param _sw_timer : The software timer.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType sw_timer_stop(sw_timer_t *_sw_timer)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if(NULL == _sw_timer)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR0);
+        if(STD_TRUE == _sw_timer->active)
+            { sw_timer_unlink(_sw_timer); }
+        else
+            { /* Nothing */ }
+        _sw_timer->pending = STD_FALSE;
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR0, l_critical_state);
+    }
+    return ret;
+}
+
+/**
+ * @brief : Checks a software timer.
+ * @param _sw_timer : The software timer.
+ * @return (STD_TRUE) : The timer waits for an expiry.
+ *         (STD_FALSE) : The timer is stopped or a one-shot timer expired.
+ */
+uint8_t sw_timer_is_active(const sw_timer_t *_sw_timer)
+{
+    return ((NULL != _sw_timer) && (STD_TRUE == _sw_timer->active)) ? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief : Reads the software timers clock.
+ * @return The ticks since sw_timer_init().
+ */
+uint32_t sw_timer_get_ticks(void)
+{
+    uint32_t l_ticks = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR0);
+    l_ticks = sw_timer_ticks;
+    Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR0, l_critical_state);
+    return l_ticks;
+}
+
+/**
+ * @brief : Calls the callbacks of the expired (SW_TIMER_CONTEXT_DEFERRED) timers.
+ *          Called from the main loop.
+ * @return The number of the called callbacks.
+ */
+uint8_t sw_timer_dispatch(void)
+{
+    uint8_t l_callbacks_number = ZERO_INIT;
+    uint8_t l_pending = STD_FALSE;
+    sw_timer_t *l_sw_timer = NULL;
+    critical_state_t l_critical_state = ZERO_INIT;
+    do
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR0);
+        l_sw_timer = sw_timer_deferred_head;
+        if(NULL != l_sw_timer)
+        {
+            sw_timer_deferred_head = l_sw_timer->deferred_next;
+            if(NULL == sw_timer_deferred_head)
+                { sw_timer_deferred_tail = NULL; }
+            else
+                { /* Nothing */ }
+            l_sw_timer->queued = STD_FALSE;
+            l_pending = l_sw_timer->pending;
+            l_sw_timer->pending = STD_FALSE;
+        }
+        else
+            { /* Nothing */ }
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR0, l_critical_state);
+
+        /* The callback runs with the TIMER0 interrupt enabled */
+        if((NULL != l_sw_timer) && (STD_TRUE == l_pending))
+        {
+            l_sw_timer->callback();
+            l_callbacks_number++;
+        }
+        else
+            { /* Nothing */ }
+    } while(NULL != l_sw_timer);
+    return l_callbacks_number;
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+/**
+ * @brief : The TIMER0 interrupt handler, advances the wheel by one tick.
+ *          The cost is the expired timers of the tick, plus one slot
+ *          cascade every 16 ticks whatever the active timers number is.
+ */
+static void sw_timer_tick(void)
+{
+    sw_timer_link_t l_expired;
+    sw_timer_link_t *l_slot = NULL;
+    uint8_t l_level = ZERO_INIT;
+    uint8_t l_index = ZERO_INIT;
+    uint32_t l_ticks = ++sw_timer_ticks;
+
+    /* 1. On a level 0 turn, move the timers of the next level slot down */
+    for(l_level = 1; (l_level < SW_TIMER_WHEEL_LEVELS) && (ZERO_INIT == (l_ticks & SW_TIMER_WHEEL_MASK)); l_level++)
+    {
+        l_ticks >>= SW_TIMER_WHEEL_BITS;
+        l_index = (uint8_t)(l_ticks & SW_TIMER_WHEEL_MASK);
+        sw_timer_cascade(l_level, l_index);
+    }
+
+    /* 2. Take the expired slot out, the callbacks may start or stop timers */
+    l_slot = &sw_timer_wheel[0][sw_timer_ticks & SW_TIMER_WHEEL_MASK];
+    if(l_slot->next != l_slot)
+    {
+        l_expired.next = l_slot->next;
+        l_expired.prev = l_slot->prev;
+        l_expired.next->prev = &l_expired;
+        l_expired.prev->next = &l_expired;
+        l_slot->next = l_slot;
+        l_slot->prev = l_slot;
+
+        /* 3. Expire the timers of the slot */
+        while(l_expired.next != &l_expired)
+        {
+            sw_timer_expire((sw_timer_t *)l_expired.next);
+        }
+    }
+    else
+        { /* Nothing */ }
+}
+
+/**
+ * @brief : Puts a timer in the slot of its expiry,
+ *          the level is the smallest one spanning the remaining ticks.
+ */
+static void sw_timer_insert(sw_timer_t *_sw_timer)
+{
+    uint32_t l_remaining = _sw_timer->expiry - sw_timer_ticks;
+    uint32_t l_expiry = _sw_timer->expiry;
+    uint8_t l_level = ZERO_INIT;
+    sw_timer_link_t *l_slot = NULL;
+
+    while((l_remaining >= SW_TIMER_WHEEL_SLOTS) && (l_level < (SW_TIMER_WHEEL_LEVELS - 1U)))
+    {
+        l_remaining >>= SW_TIMER_WHEEL_BITS;
+        l_expiry >>= SW_TIMER_WHEEL_BITS;
+        l_level++;
+    }
+    l_slot = &sw_timer_wheel[l_level][l_expiry & SW_TIMER_WHEEL_MASK];
+
+    _sw_timer->link.next = l_slot;
+    _sw_timer->link.prev = l_slot->prev;
+    l_slot->prev->next = &(_sw_timer->link);
+    l_slot->prev = &(_sw_timer->link);
+    _sw_timer->active = STD_TRUE;
+}
+
+static void sw_timer_unlink(sw_timer_t *_sw_timer)
+{
+    _sw_timer->link.prev->next = _sw_timer->link.next;
+    _sw_timer->link.next->prev = _sw_timer->link.prev;
+    _sw_timer->active = STD_FALSE;
+}
+
+/**
+ * @brief : Reinserts the timers of a slot, they go to a lower level.
+ */
+static void sw_timer_cascade(uint8_t level, uint8_t index)
+{
+    sw_timer_link_t *l_slot = &sw_timer_wheel[level][index];
+    sw_timer_t *l_sw_timer = NULL;
+    while(l_slot->next != l_slot)
+    {
+        l_sw_timer = (sw_timer_t *)l_slot->next;
+        sw_timer_unlink(l_sw_timer);
+        sw_timer_insert(l_sw_timer);
+    }
+}
+
+static void sw_timer_expire(sw_timer_t *_sw_timer)
+{
+    sw_timer_unlink(_sw_timer);
+
+    /* 1. A periodic timer is rearmed from its expiry, so it doesn't drift */
+    if(ZERO_INIT != _sw_timer->period)
+    {
+        _sw_timer->expiry += _sw_timer->period;
+        sw_timer_insert(_sw_timer);
+    }
+    else
+        { /* Nothing */ }
+
+    /* 2. Deliver the expiry */
+    if(SW_TIMER_CONTEXT_ISR == _sw_timer->context)
+    {
+        _sw_timer->callback();
+    }
+    else
+    {
+        _sw_timer->pending = STD_TRUE;
+        if(STD_FALSE == _sw_timer->queued)
+        {
+            _sw_timer->queued = STD_TRUE;
+            _sw_timer->deferred_next = NULL;
+            if(NULL == sw_timer_deferred_tail)
+                { sw_timer_deferred_head = _sw_timer; }
+            else
+                { sw_timer_deferred_tail->deferred_next = _sw_timer; }
+            sw_timer_deferred_tail = _sw_timer;
+        }
+        else
+            { /* Nothing, The missed expiries are merged in one callback */ }
+    }
+}
+#endif
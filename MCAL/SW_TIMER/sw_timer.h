@@ -0,0 +1,81 @@
+/*
+ * File:   sw_timer.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef SW_TIMER_H
+#define	SW_TIMER_H
+
+/* --------------- Section : Includes --------------- */
+#include "../TIMER0/timer0.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/*
+ * A hierarchical timing wheel : (SW_TIMER_WHEEL_LEVELS) levels of
+ * (2^SW_TIMER_WHEEL_BITS) slots, level (n) slot spans 2^(n * bits) ticks.
+ * 4 levels of 16 slots cover the (uint16_t) delays.
+ */
+#define SW_TIMER_WHEEL_BITS             4U
+#define SW_TIMER_WHEEL_LEVELS           4U
+#define SW_TIMER_WHEEL_SLOTS            (1U << SW_TIMER_WHEEL_BITS)
+
+/* The callback context of a software timer */
+#define SW_TIMER_CONTEXT_ISR            STD_LOW
+#define SW_TIMER_CONTEXT_DEFERRED       STD_HIGH
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef void (*sw_timer_callback_t)(void);
+
+/* The links of a wheel slot list, the slot heads are links as well */
+typedef struct sw_timer_link {
+    struct sw_timer_link *next;
+    struct sw_timer_link *prev;
+} sw_timer_link_t;
+
+typedef struct sw_timer {
+    /*
+     * Private, keep it the first member.
+     */
+    sw_timer_link_t link;
+    /*
+     * Private, the next timer waiting for sw_timer_dispatch().
+     */
+    struct sw_timer *deferred_next;
+    /*
+     * Called on every expiry of the timer.
+     */
+    sw_timer_callback_t callback;
+    /*
+     * Private, the tick of the next expiry.
+     */
+    uint32_t expiry;
+    /*
+     * Private, the reload of a periodic timer (ZERO_INIT : one-shot).
+     */
+    uint16_t period;
+    /*
+     * The callback context :
+     *  (SW_TIMER_CONTEXT_ISR) : from the TIMER0 ISR, keep it short.
+     *  or
+     *  (SW_TIMER_CONTEXT_DEFERRED) : from sw_timer_dispatch() in the main loop.
+     */
+    uint8_t context             : 1;
+    uint8_t active              : 1;    /* Private */
+    uint8_t queued              : 1;    /* Private */
+    uint8_t pending             : 1;    /* Private */
+    uint8_t sw_timer_reserved   : 4;
+} sw_timer_t;
+
+/* --------------- Section: Function Declarations --------------- */
+Std_ReturnType sw_timer_init(const Timer0_t *_timer);
+Std_ReturnType sw_timer_start(sw_timer_t *_sw_timer, uint16_t delay, uint16_t period);
+Std_ReturnType sw_timer_stop(sw_timer_t *_sw_timer);
+uint8_t sw_timer_is_active(const sw_timer_t *_sw_timer);
+uint32_t sw_timer_get_ticks(void);
+uint8_t sw_timer_dispatch(void);
+
+#endif	/* SW_TIMER_H */
@@ -6,11 +6,15 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "timer0.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
 /* --------------- Section : Global Variables --------------- */
 #if TMR0_INTERRUPT_FEATURE==INTERRUPT_ENABLE
 static interrupt_handler_t TMR0_interrupt_handler = NULL;
 #endif
 static uint16_t g_preloaded_value = ZERO_INIT;
+/* The preloaded value plus the ticks lost by the reload of the ISR */
+static uint16_t g_reload_value = ZERO_INIT;
 
 /*---------------  Section: Function Definitions --------------- */
 /**
@@ -96,16 +100,29 @@ Std_ReturnType timer0_init(const Timer0_t *_timer)
                             break;                
         }
 #endif
-        // 4- Clear The Timer0 interrupt flag & Enable its interrupt.
+        // 4- Assign the interrupt handler, routed before the source is enabled.
+        TMR0_interrupt_handler = _timer->TMR0_INTERRUPT_HANDLER;
+        Interrupt_Manager_Register(INTERRUPT_SOURCE_TMR0, INTI_TMR0_ISR);
+        // 5- Clear The Timer0 interrupt flag & Enable its interrupt.
         INTI_TMR0_CLR_FLAG();
         INTI_TMR0_INTERRRUPT_ENABLE();
-        TMR0_interrupt_handler = _timer->TMR0_INTERRUPT_HANDLER;
 #endif
      
         /* 6. Write the preloaded value */
         TMR0_WRITE_HIGH_BYTE((_timer->timer0_preloaded_value) >> 8);
         TMR0_WRITE_LOW_BYTE((uint8_t) (_timer->timer0_preloaded_value));
         g_preloaded_value = _timer->timer0_preloaded_value;
+        g_reload_value = g_preloaded_value;
+        if(TMR0_COUNTER_MODE == _timer->timer0_mode)
+        { /* Nothing, the external clock isn't in instruction cycles */ }
+        else if(TMR0_PRESCALER_ENABLE == _timer->prescaler_enable)
+        {
+            g_reload_value += TMR0_RELOAD_COMPENSATION(2U << (_timer->prescaler_value));
+        }
+        else
+        {
+            g_reload_value += TMR0_RELOAD_COMPENSATION(1U);
+        }
         /* 7. Enable the timer0 module */
         TMR0_MODULE_ENABLE();
     }
@@ -155,8 +172,15 @@ Std_ReturnType timer0_write_value(const Timer0_t *_timer, uint16_t _val)
     }
     else
     {
+#if TMR0_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        /* TMR0H is buffered, keep the reload of the ISR out of the two bytes write */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR0);
+#endif
         TMR0_WRITE_HIGH_BYTE((_val) >> 8);
         TMR0_WRITE_LOW_BYTE((uint8_t) (_val));
+#if TMR0_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR0, l_critical_state);
+#endif
     }
     return ret;
 }
@@ -180,8 +204,15 @@ Std_ReturnType timer0_read_value(const Timer0_t *_timer, uint16_t *_val)
     else
     {
         uint8_t l_tmr0_low_byte = ZERO_INIT, l_tmr0_high_byte = ZERO_INIT;
+#if TMR0_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        /* The high byte is latched in TMR0H, the reload of the ISR overwrites it */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR0);
+#endif
         l_tmr0_low_byte = TMR0_READ_LOW_BYTE();
         l_tmr0_high_byte = TMR0_READ_HIGH_BYTE();
+#if TMR0_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR0, l_critical_state);
+#endif
         *_val = (uint16_t)((l_tmr0_high_byte << 8) + (l_tmr0_low_byte));
     }
     return ret;
@@ -192,14 +223,25 @@ Std_ReturnType timer0_read_value(const Timer0_t *_timer, uint16_t *_val)
  */
 void INTI_TMR0_ISR(void)
 {
+    uint16_t l_count = ZERO_INIT;
     /* 1. Clear the interrupt flag */
     INTI_TMR0_CLR_FLAG();
     
-    /* 2. ReWrite The timer0 module with preloaded value */
-    TMR0_WRITE_HIGH_BYTE( (g_preloaded_value) >> 8);
-    TMR0_WRITE_LOW_BYTE ( (uint8_t) (g_preloaded_value));
+    /* 2. Add the preloaded value to the ticks counted since the overflow,
+     *    the interrupt latency doesn't stretch the period this way.
+     *    (In the 8-bit mode only the low byte matters) */
+    if(ZERO_INIT != g_preloaded_value)
+    {
+        l_count = TMR0_READ_LOW_BYTE();     /* Latches TMR0H */
+        l_count |= (uint16_t)((uint16_t)TMR0_READ_HIGH_BYTE() << 8);
+        l_count += g_reload_value;
+        TMR0_WRITE_HIGH_BYTE((uint8_t)(l_count >> 8));
+        TMR0_WRITE_LOW_BYTE((uint8_t)l_count);
+    }
+    else
+    { /* Nothing */ }
     
-    /* 2. Call The ISR */
+    /* 3. Call The ISR */
     if (TMR0_interrupt_handler)
     {
         TMR0_interrupt_handler(); 
@@ -10,6 +10,19 @@
 /* --------------- Section : Includes --------------- */
 #include "../Interrupt/INT_interrupts/MCAL_INTI.h"
 /* --------------- Section: Macro Declarations --------------- */
+/*
+ * The instruction cycles lost by the reload of the ISR, from the read of
+ * the count to the write of the new one (+ 2 inhibited cycles of TMR0) (XC8 listing of INTI_TMR0_ISR).
+ * With the prescaler the write also clears the prescaler counter, the part
+ * of a tick counted before it is lost : 0 --> (prescaler - 1) cycles per
+ * period (about -3900 ppm for 1 ms at 1:8 in BENCHMARK/timer_drift_test.c).
+ * For an exact prescaled period use TIMER2 on PR2 or TIMER1/TIMER3 on the
+ * CCP special event trigger.
+ */
+#ifndef TMR0_RELOAD_COMPENSATION_CYCLES
+#define TMR0_RELOAD_COMPENSATION_CYCLES     12U
+#endif
+
 #define TMR0_TIMER_MODE             STD_HIGH
 #define TMR0_COUNTER_MODE           STD_LOW
 
@@ -86,6 +99,9 @@
 
 #define TMR0_READ_LOW_BYTE()            (TMR0L)
 #define TMR0_READ_HIGH_BYTE()           (TMR0H)
+
+/* The reload compensation in timer0 ticks of a prescaler (_P_), rounded */
+#define TMR0_RELOAD_COMPENSATION(_P_)  ((TMR0_RELOAD_COMPENSATION_CYCLES + ((_P_) >> 1)) / (_P_))
 /*
  * @brief : Timer0 8Bit/16Bit Configurations.
  * @note  : (T0CON) Timer0 Control Register bit<6> => T08BIT: Timer0 8-Bit/16-Bit 
@@ -0,0 +1,247 @@
+/* 
+ * File:   monotonic_clock.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "monotonic_clock.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+/* --------------- Section: Macro Declarations --------------- */
+/* The instruction clock is (FOSC / 4) */
+#define MONOTONIC_CLOCK_US_PER_SECOND       1000000UL
+
+/* The ticks of one TIMER1 wrap */
+#define MONOTONIC_CLOCK_WRAP_TICKS          0x10000UL
+
+/* --------------- Section: Data Type Declarations --------------- */
+/* The clock at the last overflow. The microseconds are counted apart, the
+ * microseconds of a 32-bit ticks count wrap long before 2^32 us */
+typedef struct {
+    uint16_t overflows;             /* The upper 16 bits of the ticks */
+    uint32_t us;                    /* The microseconds of the overflows */
+    uint32_t us_remainder;          /* and their remainder, in (1 / tick_us_den) us */
+} monotonic_clock_count_t;
+
+/* --------------- Section : Global Variables --------------- */
+static volatile monotonic_clock_count_t monotonic_clock_count;
+/* The count being written by the overflow routine (counting is STD_TRUE),
+ * a reader preempting the routine takes this one */
+static volatile monotonic_clock_count_t monotonic_clock_count_next;
+static volatile uint8_t monotonic_clock_counting = STD_FALSE;
+static uint8_t monotonic_clock_started = STD_FALSE;
+/* One tick is (tick_us_num / tick_us_den) microseconds, reduced at the init */
+static uint32_t monotonic_clock_tick_us_num = 1;
+static uint32_t monotonic_clock_tick_us_den = 1;
+/* The microseconds of one wrap and their remainder (in 1 / tick_us_den us) */
+static uint32_t monotonic_clock_wrap_us = ZERO_INIT;
+static uint32_t monotonic_clock_wrap_us_remainder = ZERO_INIT;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void monotonic_clock_overflow(void);
+static uint16_t monotonic_clock_read(monotonic_clock_count_t *count);
+static void monotonic_clock_add_wrap(monotonic_clock_count_t *count);
+static uint32_t monotonic_clock_gcd(uint32_t a, uint32_t b);
+
+/*---------------  Section: Function Definitions --------------- */
+Std_ReturnType monotonic_clock_init(const Timer1_t *_timer)
+{
+    Std_ReturnType ret = E_OK;
+    Timer1_t l_clock_timer;
+    uint32_t l_gcd = ZERO_INIT;
+    if (NULL == _timer)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 1. The tick length : (4 * prescaler / FOSC) seconds */
+        monotonic_clock_tick_us_num = (4UL << (_timer->prescaler_value)) * MONOTONIC_CLOCK_US_PER_SECOND;
+        monotonic_clock_tick_us_den = _XTAL_FREQ;
+        l_gcd = monotonic_clock_gcd(monotonic_clock_tick_us_num, monotonic_clock_tick_us_den);
+        monotonic_clock_tick_us_num /= l_gcd;
+        monotonic_clock_tick_us_den /= l_gcd;
+        monotonic_clock_wrap_us = monotonic_clock_ticks_to_us(MONOTONIC_CLOCK_WRAP_TICKS);
+        monotonic_clock_wrap_us_remainder = ((MONOTONIC_CLOCK_WRAP_TICKS % monotonic_clock_tick_us_den)
+                                             * monotonic_clock_tick_us_num) % monotonic_clock_tick_us_den;
+        
+        /* 2. A free running timer with one 16-bit read of TMR1 */
+        l_clock_timer = *_timer;
+        l_clock_timer.TMR1_INTERRUPT_HANDLER = monotonic_clock_overflow;
+        l_clock_timer.timer1_preloaded_value = ZERO_INIT;
+        l_clock_timer.timer1_rw_mode = TMR1_RW_REG_MODE_16BIT;
+        monotonic_clock_count.overflows = ZERO_INIT;
+        monotonic_clock_count.us = ZERO_INIT;
+        monotonic_clock_count.us_remainder = ZERO_INIT;
+        monotonic_clock_counting = STD_FALSE;
+        ret = timer1_init(&l_clock_timer);
+        monotonic_clock_started = (E_OK == ret) ? STD_TRUE : STD_FALSE;
+    }
+    return ret;
+}
+
+uint32_t monotonic_clock_get_ticks(void)
+{
+    monotonic_clock_count_t l_count;
+    uint16_t l_low = monotonic_clock_read(&l_count);
+    return (((uint32_t)l_count.overflows << 16) | l_low);
+}
+
+uint32_t monotonic_clock_get_us(void)
+{
+    monotonic_clock_count_t l_count;
+    uint16_t l_low = monotonic_clock_read(&l_count);
+    /* The ticks since the overflow, split on the denominator like ticks_to_us() */
+    uint32_t l_fraction = (((uint32_t)l_low % monotonic_clock_tick_us_den) * monotonic_clock_tick_us_num)
+                        + l_count.us_remainder;
+    return l_count.us + (((uint32_t)l_low / monotonic_clock_tick_us_den) * monotonic_clock_tick_us_num)
+         + (l_fraction / monotonic_clock_tick_us_den);
+}
+
+uint32_t monotonic_clock_ticks_to_us(uint32_t ticks)
+{
+    /* Split on the denominator, so the product doesn't overflow before the wrap */
+    return ((ticks / monotonic_clock_tick_us_den) * monotonic_clock_tick_us_num)
+         + (((ticks % monotonic_clock_tick_us_den) * monotonic_clock_tick_us_num) / monotonic_clock_tick_us_den);
+}
+
+uint32_t monotonic_clock_us_to_ticks(uint32_t us)
+{
+    /* Split on the numerator as well, the remainder part is rounded up */
+    return ((us / monotonic_clock_tick_us_num) * monotonic_clock_tick_us_den)
+         + ((((us % monotonic_clock_tick_us_num) * monotonic_clock_tick_us_den) + monotonic_clock_tick_us_num - 1UL)
+            / monotonic_clock_tick_us_num);
+}
+
+uint32_t monotonic_clock_extend(uint16_t stamp)
+{
+    uint32_t l_now = monotonic_clock_get_ticks();
+    /* The 16-bit difference is right across the wrap of TMR1 */
+    return l_now - (uint16_t)((uint16_t)l_now - stamp);
+}
+
+uint8_t monotonic_clock_is_running(void)
+{
+    return ((STD_TRUE == monotonic_clock_started) && (STD_HIGH == T1CONbits.TMR1ON)) ? STD_TRUE : STD_FALSE;
+}
+
+uint32_t monotonic_clock_get_tick_hz(void)
+{
+    /* One second of microseconds converted like ticks_to_us() the other way */
+    return ((MONOTONIC_CLOCK_US_PER_SECOND / monotonic_clock_tick_us_num) * monotonic_clock_tick_us_den)
+         + (((MONOTONIC_CLOCK_US_PER_SECOND % monotonic_clock_tick_us_num) * monotonic_clock_tick_us_den)
+            / monotonic_clock_tick_us_num);
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+/**
+ * @brief : The timer 1 interrupt handler, counts the overflow. TIMER1 runs
+ *          it before clearing the flag (a free running timer), the flag is
+ *          cleared here while the new count is published : a reader of a
+ *          higher priority sees the overflow pending or counted, never
+ *          neither (the clock 65536 ticks back) nor both.
+ */
+static void monotonic_clock_overflow(void)
+{
+    monotonic_clock_count_t l_count = monotonic_clock_count;
+    monotonic_clock_add_wrap(&l_count);
+    monotonic_clock_count_next = l_count;
+    monotonic_clock_counting = STD_TRUE;
+    INTI_TMR1_CLR_FLAG();
+    monotonic_clock_count = l_count;
+    monotonic_clock_counting = STD_FALSE;
+}
+
+/**
+ * @brief : Reads the count and TMR1 as one, from the main loop or from
+ *          any interrupt.
+ * @param count : The count at the read, with a pending overflow added.
+ * @return The TMR1 value.
+ */
+static uint16_t monotonic_clock_read(monotonic_clock_count_t *count)
+{
+    uint16_t l_low = ZERO_INIT;
+    uint8_t l_overflow_pending = STD_LOW;
+    uint8_t l_masked = STD_TRUE;
+    critical_state_t l_critical_state = ZERO_INIT;
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    /* Nothing preempts the high vector, its readers (the capture and the
+     * compare routines) don't pay for the mask */
+    l_masked = INTERRUPT_MANAGER_IN_HIGH_VECTOR() ? STD_FALSE : STD_TRUE;
+#endif
+    if(STD_TRUE == l_masked)
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR1);
+    }
+    else
+        { /* Nothing */ }
+    
+    /* The count can't change while the source is masked (or the high vector
+     * runs), but this read may preempt the overflow routine itself : it
+     * stays frozen in between */
+    if(STD_TRUE == monotonic_clock_counting)
+    {
+        /* The overflow is in the new count, whatever the flag is */
+        *count = monotonic_clock_count_next;
+        l_low = TMR1_READ();
+    }
+    else
+    {
+        *count = monotonic_clock_count;
+        do
+        {
+            l_overflow_pending = PIR1bits.TMR1IF;
+            /* Reading TMR1L latches TMR1H, the two halves come from the same count */
+            l_low = TMR1_READ();
+            /* An overflow between the flag and the count reads, read again */
+        } while(l_overflow_pending != PIR1bits.TMR1IF);
+        
+        /* The overflow came before the read but its routine didn't count it yet */
+        if(STD_HIGH == l_overflow_pending)
+        {
+            monotonic_clock_add_wrap(count);
+        }
+        else
+            { /* Nothing */ }
+    }
+    
+    if(STD_TRUE == l_masked)
+    {
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR1, l_critical_state);
+    }
+    else
+        { /* Nothing */ }
+    return l_low;
+}
+
+/**
+ * @brief : Adds one TIMER1 wrap to a count.
+ */
+static void monotonic_clock_add_wrap(monotonic_clock_count_t *count)
+{
+    count->overflows++;
+    count->us += monotonic_clock_wrap_us;
+    count->us_remainder += monotonic_clock_wrap_us_remainder;
+    if(count->us_remainder >= monotonic_clock_tick_us_den)
+    {
+        count->us_remainder -= monotonic_clock_tick_us_den;
+        count->us++;
+    }
+    else
+        { /* Nothing */ }
+}
+
+static uint32_t monotonic_clock_gcd(uint32_t a, uint32_t b)
+{
+    uint32_t l_remainder = ZERO_INIT;
+    while(ZERO_INIT != b)
+    {
+        l_remainder = a % b;
+        a = b;
+        b = l_remainder;
+    }
+    return a;
+}
+#endif
@@ -0,0 +1,95 @@
+/* 
+ * File:   monotonic_clock.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef MONOTONIC_CLOCK_H
+#define	MONOTONIC_CLOCK_H
+
+/* --------------- Section : Includes --------------- */
+#include "timer1.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+
+/*---------------  Section: Function Declarations --------------- */
+/**
+ * 
+ * @Brief  A software interface starts the monotonic clock on timer 1,
+ *         timer 1 runs free (no preloaded value) and its overflows 
+ *         extend it to 32 bits.
+ * @param _timer : A pointer to a Timer1 object (the clock source and the prescaler),
+ *                 its interrupt handler and preloaded value are replaced by the clock.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType monotonic_clock_init(const Timer1_t *_timer);
+
+/**
+ * 
+ * @Brief  A software interface reads the monotonic clock, safe from the
+ *         main loop and from the interrupts of both priorities (a read
+ *         preempting the timer 1 overflow routine included).
+ * @return The timer 1 ticks since monotonic_clock_init() (wraps at 2^32).
+ */
+uint32_t monotonic_clock_get_ticks(void);
+
+/**
+ * 
+ * @Brief  A software interface reads the monotonic clock in microseconds,
+ *         the microseconds are counted apart from the ticks (the microseconds
+ *         of a 32-bit ticks count would wrap before 2^32).
+ * @return The microseconds since monotonic_clock_init() (wraps at 2^32).
+ */
+uint32_t monotonic_clock_get_us(void);
+
+/**
+ * 
+ * @Brief  A software interface converts a number of timer 1 ticks
+ *         (a difference of two readings) to microseconds.
+ * @param ticks : The timer 1 ticks.
+ * @return The microseconds of the ticks.
+ */
+uint32_t monotonic_clock_ticks_to_us(uint32_t ticks);
+
+/**
+ * 
+ * @Brief  A software interface converts a number of microseconds
+ *         to timer 1 ticks, rounded up (a wait is never shorter).
+ * @param us : The microseconds.
+ * @return The timer 1 ticks of the microseconds.
+ */
+uint32_t monotonic_clock_us_to_ticks(uint32_t us);
+
+/**
+ * 
+ * @Brief  A software interface extends a 16-bit stamp of TMR1 (a CCP
+ *         capture on timer 1) to the monotonic clock, the stamp is taken
+ *         less than one timer 1 wrap before the call.
+ * @param stamp : The TMR1 value.
+ * @return The monotonic clock ticks at the stamp.
+ */
+uint32_t monotonic_clock_extend(uint16_t stamp);
+
+/**
+ * 
+ * @Brief  A software interface checks the monotonic clock runs
+ *         (monotonic_clock_init() done and timer 1 on).
+ * @return (STD_TRUE) : The clock runs, (STD_FALSE) : The readings stay still.
+ */
+uint8_t monotonic_clock_is_running(void);
+
+/**
+ * 
+ * @Brief  A software interface reads the rate of the monotonic clock.
+ * @return The timer 1 ticks of one second.
+ */
+uint32_t monotonic_clock_get_tick_hz(void);
+
+#endif	/* MONOTONIC_CLOCK_H */
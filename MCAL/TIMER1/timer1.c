@@ -6,11 +6,29 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "timer1.h"
+#include "../TIMER16/timer16.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
 /* --------------- Section : Global Variables --------------- */
+static timer16_state_t timer1_state;
+
+static const timer16_descriptor_t timer1_descriptor = {
+    .control_register = TMR1_T1CON_ADDRESS,
+    .count_low_register = TMR1_TMR1L_ADDRESS,
+    .count_high_register = TMR1_TMR1H_ADDRESS,
+    .flag_register = TMR1_PIR1_ADDRESS,
+    .enable_register = TMR1_PIE1_ADDRESS,
+    .priority_register = TMR1_IPR1_ADDRESS,
+    .interrupt_mask = TMR1_INTERRUPT_BIT_MASK,
+    .reload_compensation_cycles = TMR1_RELOAD_COMPENSATION_CYCLES,
+    .source = INTERRUPT_SOURCE_TMR1,
 #if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
-static interrupt_handler_t TMR1_interrupt_handler = NULL;
+    .isr = INTI_TMR1_ISR,
+#else
+    .isr = NULL,
 #endif
-static uint16_t g_preloaded_value = ZERO_INIT;
+    .state = &timer1_state
+};
 
 /*---------------  Section: Function Definitions --------------- */
 /**
@@ -24,81 +42,25 @@ static uint16_t g_preloaded_value = ZERO_INIT;
 Std_ReturnType timer1_init(const Timer1_t *_timer)
 {
     Std_ReturnType ret = E_OK;
+    Timer16_t l_timer = {ZERO_INIT};
     if (NULL == _timer)
     {
         ret = E_NOT_OK;
     }
     else
     {
-        /* 1. Disable Timer 1 Module */  
-        TMR1_MODULE_DISABLE();
-        
-        /* 2. Configure the module mode */
-        switch (_timer->timer1_mode)
-        {
-            case TMR1_TIMER_MODE : TMR1_INTERNAL_CLK_MODE();
-                                break;
-            case TMR1_COUNTER_MODE: 
-                TMR1_EXTERNEL_CLK_MODE();
-                switch (_timer->timer1_counter_synch_mode)
-                {
-                    case TMR1_COUNTER_SYNCH : TMR1_COUNTER_SET_SYNCH();
-                                            break;  
-                    case TMR1_COUNTER_ASYNCH : TMR1_COUNTER_SET_ASYNCH();
-                                            break;
-                    default : /* Nothing*/
-                                            break;
-                }
-                break;
-            default : TMR1_INTERNAL_CLK_MODE();
-                  break;                
-        }
-        
-        /* 3. Configure the Prescaler Assignment and Rate */
-        TMR1_PRESCALER_SET_RATIO(_timer->prescaler_value);
-        
-        /* 4. Configure the timer1 r/w register size */
-        switch (_timer->timer1_rw_mode)
-        {
-            case TMR1_RW_REG_MODE_8BIT : TMR1_RW_SET_MODE_8BIT();
-                                    break;
-            case TMR1_RW_REG_MODE_16BIT : TMR1_RW_SET_MODE_16BIT();
-                                    break;
-            default : TMR1_RW_SET_MODE_16BIT();
-                                    break;            
-        }
-        
-        /* 5. Configure The Interrupts */
 #if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
-        // 1- Enable Global & Peripheral Interrupts
-        INTERRUPT_GIEH_ENABLE();    /* Enable Global Interrupts */
-        INTERRUPT_GIEL_ENABLE();    /* Enable Peripheral Interrupts */
-        // 2- Enable The priority.
+        l_timer.TMR_INTERRUPT_HANDLER = _timer->TMR1_INTERRUPT_HANDLER;
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
-        INTERRUPT_PRIORITY_ENABLE();
-            // 3- Assign the Specified priority. 
-        switch (_timer->priority)
-        {
-            case PRIORITY_HIGH : INTI_TMR1_INTERRUPT_PRIORITY_HIGH();
-                            break;
-            case PRIORITY_LOW : INTI_TMR1_INTERRUPT_PRIORITY_LOW();
-                            break;
-            default : INTI_TMR1_INTERRUPT_PRIORITY_HIGH();
-                            break;                
-        }
+        l_timer.priority = _timer->priority;
 #endif
-        // 4- Clear The Timer1 interrupt flag & Enable its interrupt.
-        INTI_TMR1_CLR_FLAG();
-        INTI_TMR1_INTERRRUPT_ENABLE();
-        // 5- Assign the interrupt handler.
-        TMR1_interrupt_handler = _timer->TMR1_INTERRUPT_HANDLER;
 #endif
-        
-        /* 6. Write the preloaded value */
-        g_preloaded_value = _timer->timer1_preloaded_value;
-        TMR1_WRITE(g_preloaded_value);
-        /* 7. Enable the timer1 module */
-        TMR1_MODULE_ENABLE();
+        l_timer.preloaded_value = _timer->timer1_preloaded_value;
+        l_timer.prescaler_value = _timer->prescaler_value;
+        l_timer.timer_mode = _timer->timer1_mode;
+        l_timer.counter_synch_mode = _timer->timer1_counter_synch_mode;
+        l_timer.rw_mode = _timer->timer1_rw_mode;
+        ret = timer16_init(&timer1_descriptor, &l_timer);
     }
     return ret;
 }
@@ -120,10 +82,7 @@ Std_ReturnType timer1_deInit(const Timer1_t *_timer)
     }
     else
     {
-        /* 1. Disable Timer1 Module */
-        TMR1_MODULE_DISABLE();
-        /* 2. Disable The timer1 interrupt */
-        INTI_TMR1_INTERRRUPT_DISABLE();   
+        ret = timer16_deInit(&timer1_descriptor);
     }
     return ret;
 }
@@ -146,7 +105,14 @@ Std_ReturnType timer1_write_value(const Timer1_t *_timer, uint16_t _val)
     }
     else
     {
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        /* TMR1H is buffered, keep the reload of the ISR out of the two bytes write */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR1);
+#endif
         TMR1_WRITE(_val);
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR1, l_critical_state);
+#endif
     }
     return ret;
 }
@@ -169,7 +135,14 @@ Std_ReturnType timer1_read_value(const Timer1_t *_timer, uint16_t *_val)
     }
     else
     {
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        /* The high byte is latched in TMR1H, the reload of the ISR overwrites it */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR1);
+#endif
         *_val = TMR1_READ();
+#if TMR1_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR1, l_critical_state);
+#endif
     }
     return ret;
 }
@@ -179,17 +152,32 @@ Std_ReturnType timer1_read_value(const Timer1_t *_timer, uint16_t *_val)
  */
 void INTI_TMR1_ISR (void)
 {
-    /* 1. Clear the Interrupt Flag */
-    INTI_TMR1_CLR_FLAG();
-    
-    /* 2. ReWrite The timer1 module with preloaded value */
-    TMR1_WRITE(g_preloaded_value);
+    if(ZERO_INIT != timer1_state.preloaded_value)
+    {
+        /* 1. Clear the Interrupt Flag */
+        INTI_TMR1_CLR_FLAG();
+        
+        /* 2. Add the preloaded value to the ticks counted since the overflow,
+         *    the interrupt latency doesn't stretch the period this way. */
+        TMR1_WRITE((uint16_t)(TMR1_READ() + timer1_state.reload_value));
+    }
+    else
+    { /* Nothing */ }
     
     /* 3. Call the ISR */
-    if (TMR1_interrupt_handler)
+    if (timer1_state.handler)
     {
-        TMR1_interrupt_handler();
+        timer1_state.handler();
     }
     else
     { /* Nothing */}
-}
\ No newline at end of file
+    
+    /* 4. A free running timer (already rolled over to zero) clears the flag
+     *    after its handler, the monotonic clock counts the overflow first */
+    if(ZERO_INIT == timer1_state.preloaded_value)
+    {
+        INTI_TMR1_CLR_FLAG();
+    }
+    else
+    { /* Nothing */ }
+}
@@ -10,6 +10,20 @@
 /* --------------- Section : Includes --------------- */
 #include "../Interrupt/INT_interrupts/MCAL_INTI.h"
 /* --------------- Section: Macro Declarations --------------- */
+/*
+ * The instruction cycles lost by the reload of the ISR, from the read of
+ * the count to the write of the new one (XC8 listing of INTI_TMR1_ISR).
+ * With the prescaler the write also clears the prescaler counter, the part
+ * of a tick counted before it is lost : 0 --> (prescaler - 1) cycles per
+ * period (BENCHMARK/timer_drift_test.c).
+ * For a period without any reload leave the preloaded value zero and
+ * run a CCP module in (CCP_COMPARE_GEN_EVENT) on timer1, its special
+ * event trigger resets TMR1 on the match in hardware (exact with any prescaler).
+ */
+#ifndef TMR1_RELOAD_COMPENSATION_CYCLES
+#define TMR1_RELOAD_COMPENSATION_CYCLES     10U
+#endif
+
 #define TMR1_TIMER_MODE             STD_LOW
 #define TMR1_COUNTER_MODE           STD_HIGH
 
@@ -25,6 +39,16 @@
 
 #define TMR1_OSC_ENABLE             STD_ENABLE
 #define TMR1_OSC_DISABLE            STD_DISABLE
+
+/* The registers of timer1 by their addresses (its timer16 descriptor) */
+#define TMR1_T1CON_ADDRESS          0xFCDU
+#define TMR1_TMR1L_ADDRESS          0xFCEU
+#define TMR1_TMR1H_ADDRESS          0xFCFU
+#define TMR1_PIR1_ADDRESS           0xF9EU
+#define TMR1_PIE1_ADDRESS           0xF9DU
+#define TMR1_IPR1_ADDRESS           0xF9FU
+/* TMR1IF, TMR1IE and TMR1IP : bit <0> */
+#define TMR1_INTERRUPT_BIT_MASK     0x01U
 /* --------------- Section: Macro Functions Declarations --------------- */
 
 /*
@@ -101,6 +125,7 @@
  */
 #define TMR1_WRITE(_D_)                 (TMR1 = _D_)
 #define TMR1_READ()                     (TMR1)
+
 /* ========================================================================== */
 
 /* --------------- Section: Data Type Declarations --------------- */
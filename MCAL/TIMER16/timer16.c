@@ -0,0 +1,141 @@
+/*
+ * File:   timer16.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "timer16.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void timer16_set_bits(uint16_t _register, uint8_t _mask, uint8_t _set);
+
+/*---------------  Section: Function Definitions --------------- */
+/**
+ *
+ * @Brief : A software interface initializes a 16-bit timer.
+ * @param _descriptor : The registers of the timer.
+ * @param _timer : A pointer to the timer configurations.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType timer16_init(const timer16_descriptor_t *_descriptor, const Timer16_t *_timer)
+{
+    Std_ReturnType ret = E_OK;
+    timer16_state_t *l_state = NULL;
+    uint8_t l_control = ZERO_INIT;
+    if ((NULL == _descriptor) || (NULL == _timer))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_state = _descriptor->state;
+        /* 1. Disable the timer module, configure its mode, prescaler rate and
+         *    r/w register size in one write (keeps the bits not in the layout) */
+        l_control = (uint8_t)(SFR_AT(_descriptor->control_register) & TIMER16_CON_KEEP_MASK);
+        if (TIMER16_COUNTER_MODE == _timer->timer_mode)
+        {
+            l_control = (uint8_t)((l_control & ~TIMER16_CON_SYNC_MASK) | TIMER16_CON_CS_MASK);
+            if (TIMER16_COUNTER_ASYNCH == _timer->counter_synch_mode)
+            {
+                l_control |= TIMER16_CON_SYNC_MASK;
+            }
+            else
+            { /* Nothing */ }
+        }
+        else
+        { /* Nothing, the synchronization is ignored in the timer mode */ }
+        l_control |= (uint8_t)((_timer->prescaler_value << TIMER16_CON_CKPS_POSITION) & TIMER16_CON_CKPS_MASK);
+        if (TIMER16_RW_REG_MODE_8BIT != _timer->rw_mode)
+        {
+            l_control |= TIMER16_CON_RD16_MASK;
+        }
+        else
+        { /* Nothing */ }
+        SFR_AT(_descriptor->control_register) = l_control;
+
+        /* 2. Configure The Interrupts */
+        if (NULL != _descriptor->isr)
+        {
+            // 1- Enable Global & Peripheral Interrupts
+            INTERRUPT_GIEH_ENABLE();    /* Enable Global Interrupts */
+            INTERRUPT_GIEL_ENABLE();    /* Enable Peripheral Interrupts */
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+            // 2- Enable The priority & Assign the Specified priority.
+            INTERRUPT_PRIORITY_ENABLE();
+            timer16_set_bits(_descriptor->priority_register, _descriptor->interrupt_mask,
+                             (PRIORITY_LOW != _timer->priority));
+#endif
+            // 3- Assign the interrupt handler, routed before the source is enabled.
+            l_state->handler = _timer->TMR_INTERRUPT_HANDLER;
+            Interrupt_Manager_Register(_descriptor->source, _descriptor->isr);
+            // 4- Clear The timer interrupt flag & Enable its interrupt.
+            timer16_set_bits(_descriptor->flag_register, _descriptor->interrupt_mask, STD_LOW);
+            timer16_set_bits(_descriptor->enable_register, _descriptor->interrupt_mask, STD_HIGH);
+        }
+        else
+        { /* Nothing */ }
+
+        /* 3. Write the preloaded value (TMRxH is buffered in the 16-bit mode) */
+        l_state->preloaded_value = _timer->preloaded_value;
+        SFR_AT(_descriptor->count_high_register) = (uint8_t)(_timer->preloaded_value >> 8);
+        SFR_AT(_descriptor->count_low_register) = (uint8_t)(_timer->preloaded_value);
+        l_state->reload_value = _timer->preloaded_value;
+        if (TIMER16_TIMER_MODE == _timer->timer_mode)
+        {
+            l_state->reload_value += TIMER16_RELOAD_COMPENSATION(_descriptor->reload_compensation_cycles,
+                                                                 _timer->prescaler_value);
+        }
+        else
+        { /* Nothing, the external clock isn't in instruction cycles */ }
+
+        /* 4. Enable the timer module */
+        timer16_set_bits(_descriptor->control_register, TIMER16_CON_ON_MASK, STD_HIGH);
+    }
+    return ret;
+}
+
+/**
+ *
+ * @Brief : A software interface deInitializes a 16-bit timer.
+ * @param _descriptor : The registers of the timer.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType timer16_deInit(const timer16_descriptor_t *_descriptor)
+{
+    Std_ReturnType ret = E_OK;
+    if (NULL == _descriptor)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 1. Disable the timer module */
+        timer16_set_bits(_descriptor->control_register, TIMER16_CON_ON_MASK, STD_LOW);
+        /* 2. Disable The timer interrupt */
+        timer16_set_bits(_descriptor->enable_register, _descriptor->interrupt_mask, STD_LOW);
+    }
+    return ret;
+}
+
+/* --------------- Section : Helper Functions Definitions --------------- */
+/**
+ * @brief : Sets or clears the bits of a register given by its address.
+ * @param _set : Any non zero value sets the bits.
+ */
+static void timer16_set_bits(uint16_t _register, uint8_t _mask, uint8_t _set)
+{
+    if (_set)
+    {
+        SFR_AT(_register) |= _mask;
+    }
+    else
+    {
+        SFR_AT(_register) &= (uint8_t)~_mask;
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * File:   timer16.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The generic 16-bit timer (TIMER1, TIMER3) <--
+ *
+ * One implementation for the timers sharing the TxCON layout, a timer is
+ * described by a constant register descriptor and a small RAM state.
+ * Only the configuration is generic : the value accesses and the ISR
+ * reload stay in timer1.c / timer3.c on the fixed registers, a register
+ * reached through its address costs the FSR loads in the hot paths.
+ */
+
+#ifndef TIMER16_H
+#define	TIMER16_H
+
+/* --------------- Section : Includes --------------- */
+#include "../compiler.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+/* --------------- Section: Macro Declarations --------------- */
+#define TIMER16_TIMER_MODE              STD_LOW
+#define TIMER16_COUNTER_MODE            STD_HIGH
+
+#define TIMER16_COUNTER_SYNCH           STD_LOW
+#define TIMER16_COUNTER_ASYNCH          STD_HIGH
+
+#define TIMER16_RW_REG_MODE_8BIT        STD_LOW
+#define TIMER16_RW_REG_MODE_16BIT       STD_HIGH
+
+/*
+ * The (TxCON) bits common to T1CON and T3CON.
+ *  <0> TMRxON, <1> TMRxCS, <2> TxSYNC, <5:4> TxCKPS, <7> RD16
+ * (Bits <3> and <6> differ : T1OSCEN/T1RUN and T3CCP1/T3CCP2, never touched)
+ */
+#define TIMER16_CON_ON_MASK             0x01U
+#define TIMER16_CON_CS_MASK             0x02U
+#define TIMER16_CON_SYNC_MASK           0x04U
+#define TIMER16_CON_CKPS_POSITION       4U
+#define TIMER16_CON_CKPS_MASK           0x30U
+#define TIMER16_CON_RD16_MASK           0x80U
+/* T1OSCEN/T3CCP1, T1RUN/T3CCP2 and TxSYNC (kept in the timer mode) */
+#define TIMER16_CON_KEEP_MASK           0x4CU
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+/* The reload compensation in timer ticks of a prescaler 2^(_P_LOG2_), rounded */
+#define TIMER16_RELOAD_COMPENSATION(_CYCLES_, _P_LOG2_) \
+            (((_CYCLES_) + ((1U << (_P_LOG2_)) >> 1)) >> (_P_LOG2_))
+
+/* --------------- Section: Data Type Declarations --------------- */
+/* The RAM part of a timer, read by its ISR */
+typedef struct
+{
+    interrupt_handler_t handler;
+    uint16_t preloaded_value;
+    /* The preloaded value plus the ticks lost by the reload of the ISR */
+    uint16_t reload_value;
+} timer16_state_t;
+
+/* The constant part of a timer, the registers are given by their addresses */
+typedef struct
+{
+    uint16_t control_register;          /* TxCON */
+    uint16_t count_low_register;        /* TMRxL */
+    uint16_t count_high_register;       /* TMRxH */
+    uint16_t flag_register;             /* PIRx */
+    uint16_t enable_register;           /* PIEx */
+    uint16_t priority_register;         /* IPRx */
+    /* The bit of the timer in its PIRx, PIEx and IPRx registers */
+    uint8_t interrupt_mask;
+    uint8_t reload_compensation_cycles;
+    interrupt_source_t source;
+    /* The routine registered to the interrupt manager
+     * (NULL : the interrupt feature of the timer is disabled) */
+    interrupt_handler_t isr;
+    timer16_state_t *state;
+} timer16_descriptor_t;
+
+typedef struct
+{
+    /**
+     * A pointer to the ISR for the timer (Used with the interrupt feature only).
+     */
+    interrupt_handler_t TMR_INTERRUPT_HANDLER;
+#if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
+    /**
+     * The priority of the timer interrupt.
+     *          (PRIORITY_HIGH or PRIORITY_LOW)
+     */
+    interrupt_priority_t priority;
+#endif
+    /**
+     * A uint16_t value to be loaded initially in the timer Register.
+     */
+    uint16_t preloaded_value;
+    /**
+     * The prescaler ratio is 2^(prescaler_value), 0 --> 3.
+     */
+    uint8_t prescaler_value;
+    /**
+     * (TIMER16_TIMER_MODE or TIMER16_COUNTER_MODE)
+     */
+    uint8_t timer_mode                  :1;
+    /**
+     * (TIMER16_COUNTER_SYNCH or TIMER16_COUNTER_ASYNCH)
+     */
+    uint8_t counter_synch_mode          :1;
+    /**
+     * (TIMER16_RW_REG_MODE_8BIT or TIMER16_RW_REG_MODE_16BIT)
+     */
+    uint8_t rw_mode                     :1;
+    uint8_t timer16_reserved            :5;
+} Timer16_t;
+
+/*---------------  Section: Function Declarations --------------- */
+/**
+ *
+ * @Brief : A software interface initializes a 16-bit timer.
+ * @param _descriptor : The registers of the timer.
+ * @param _timer : A pointer to the timer configurations.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType timer16_init(const timer16_descriptor_t *_descriptor, const Timer16_t *_timer);
+
+/**
+ *
+ * @Brief : A software interface deInitializes a 16-bit timer.
+ * @param _descriptor : The registers of the timer.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType timer16_deInit(const timer16_descriptor_t *_descriptor);
+
+#endif	/* TIMER16_H */
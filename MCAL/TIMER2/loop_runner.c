@@ -0,0 +1,249 @@
+/*
+ * File:   loop_runner.c
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+/* --------------- Section : Includes --------------- */
+#include "loop_runner.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+#if LOOP_RUNNER_PROFILING_FEATURE==STD_ENABLE
+#include "../TIMER1/monotonic_clock.h"
+#endif
+
+#if TMR2_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+/* --------------- Section : Global Variables --------------- */
+/* The added loops, sorted by divisor (the rate monotonic order) */
+static loop_runner_loop_t *loop_runner_loops[LOOP_RUNNER_MAX_LOOPS];
+static volatile uint8_t loop_runner_loops_number = ZERO_INIT;
+/* The TIMER2 interrupts since loop_runner_init() */
+static volatile uint32_t loop_runner_ticks = ZERO_INIT;
+
+/* --------------- Section : Helper Functions Declarations --------------- */
+static void loop_runner_tick(void);
+static void loop_runner_record(loop_runner_loop_t *_loop, uint32_t exec_time);
+
+/*---------------  Section: Function Definitions --------------- */
+Std_ReturnType loop_runner_init(const Timer2_t *_timer, uint8_t _period)
+{
+    Std_ReturnType ret = E_OK;
+    Timer2_t l_base_timer;
+    if(NULL == _timer)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* 1. Stop the base ticks while the loops are removed */
+        INTI_TMR2_INTERRRUPT_DISABLE();
+        loop_runner_loops_number = ZERO_INIT;
+        loop_runner_ticks = ZERO_INIT;
+
+        /* 2. The PR2 match resets TMR2 in hardware, nothing is reloaded in the ISR */
+        l_base_timer = *_timer;
+        l_base_timer.TMR2_INTERRUPT_HANDLER = loop_runner_tick;
+        l_base_timer.timer2_preloaded_value = ZERO_INIT;
+        ret = timer2_set_period(&l_base_timer, _period);
+        ret |= timer2_init(&l_base_timer);
+    }
+    return ret;
+}
+
+Std_ReturnType loop_runner_add(loop_runner_loop_t *_loop)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    uint8_t l_index = ZERO_INIT;
+    if((NULL == _loop) || (NULL == _loop->callback) || (ZERO_INIT == _loop->divisor)
+                       || (_loop->offset >= _loop->divisor))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+        for(l_index = ZERO_INIT; l_index < loop_runner_loops_number; l_index++)
+        {
+            if(_loop == loop_runner_loops[l_index])
+            {
+                ret = E_NOT_OK;
+            }
+            else
+                { /* Nothing */ }
+        }
+        if((E_OK == ret) && (loop_runner_loops_number < LOOP_RUNNER_MAX_LOOPS))
+        {
+            _loop->countdown = (uint8_t)(_loop->offset + 1U);
+            _loop->pending = STD_LOW;
+            _loop->running = STD_LOW;
+            _loop->stats.exec_sum = ZERO_INIT;
+            _loop->stats.exec_max = ZERO_INIT;
+            _loop->stats.exec_last = ZERO_INIT;
+            _loop->stats.runs = ZERO_INIT;
+            _loop->stats.overruns = ZERO_INIT;
+            /* Insert after the loops of the same or a smaller divisor */
+            l_index = loop_runner_loops_number;
+            while((l_index > ZERO_INIT) && (loop_runner_loops[l_index - 1U]->divisor > _loop->divisor))
+            {
+                loop_runner_loops[l_index] = loop_runner_loops[l_index - 1U];
+                l_index--;
+            }
+            loop_runner_loops[l_index] = _loop;
+            loop_runner_loops_number++;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+    }
+    return ret;
+}
+
+uint8_t loop_runner_dispatch(void)
+{
+    uint8_t l_runs = ZERO_INIT;
+    uint8_t l_index = ZERO_INIT;
+    loop_runner_loop_t *l_loop = NULL;
+    critical_state_t l_critical_state = ZERO_INIT;
+#if LOOP_RUNNER_PROFILING_FEATURE==STD_ENABLE
+    uint32_t l_start = ZERO_INIT;
+#endif
+    do
+    {
+        /* 1. Take the fastest released loop */
+        l_loop = NULL;
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+        for(l_index = ZERO_INIT; (l_index < loop_runner_loops_number) && (NULL == l_loop); l_index++)
+        {
+            if(STD_HIGH == loop_runner_loops[l_index]->pending)
+            {
+                l_loop = loop_runner_loops[l_index];
+                l_loop->pending = STD_LOW;
+                l_loop->running = STD_HIGH;
+            }
+            else
+                { /* Nothing */ }
+        }
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+
+        /* 2. Run it, the base ticks go on meanwhile */
+        if(NULL != l_loop)
+        {
+#if LOOP_RUNNER_PROFILING_FEATURE==STD_ENABLE
+            l_start = monotonic_clock_get_ticks();
+            l_loop->callback();
+            loop_runner_record(l_loop, monotonic_clock_get_ticks() - l_start);
+#else
+            l_loop->callback();
+            loop_runner_record(l_loop, ZERO_INIT);
+#endif
+            l_runs++;
+        }
+        else
+            { /* Nothing */ }
+    } while(NULL != l_loop);
+    return l_runs;
+}
+
+Std_ReturnType loop_runner_get_stats(const loop_runner_loop_t *_loop, loop_runner_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    critical_state_t l_critical_state = ZERO_INIT;
+    if((NULL == _loop) || (NULL == stats))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+        *stats = _loop->stats;
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+    }
+    return ret;
+}
+
+Std_ReturnType loop_runner_reset_stats(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8_t l_index = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+    for(l_index = ZERO_INIT; l_index < loop_runner_loops_number; l_index++)
+    {
+        loop_runner_loops[l_index]->stats.exec_sum = ZERO_INIT;
+        loop_runner_loops[l_index]->stats.exec_max = ZERO_INIT;
+        loop_runner_loops[l_index]->stats.exec_last = ZERO_INIT;
+        loop_runner_loops[l_index]->stats.runs = ZERO_INIT;
+        loop_runner_loops[l_index]->stats.overruns = ZERO_INIT;
+    }
+    Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+    return ret;
+}
+
+uint32_t loop_runner_get_ticks(void)
+{
+    uint32_t l_ticks = ZERO_INIT;
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+    l_ticks = loop_runner_ticks;
+    Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+    return l_ticks;
+}
+
+/*---------------  Section: Helper Functions Definitions --------------- */
+/**
+ * @brief : The timer 2 interrupt handler, one base tick :
+ *          releases the loops whose countdown ran out.
+ */
+static void loop_runner_tick(void)
+{
+    uint8_t l_index = ZERO_INIT;
+    loop_runner_loop_t *l_loop = NULL;
+    loop_runner_ticks++;
+    for(l_index = ZERO_INIT; l_index < loop_runner_loops_number; l_index++)
+    {
+        l_loop = loop_runner_loops[l_index];
+        l_loop->countdown--;
+        if(ZERO_INIT == l_loop->countdown)
+        {
+            l_loop->countdown = l_loop->divisor;
+            /* The last release didn't complete, drop this one */
+            if((STD_HIGH == l_loop->pending) || (STD_HIGH == l_loop->running))
+            {
+                if(0xFFFF != l_loop->stats.overruns)
+                    { l_loop->stats.overruns++; }
+                else
+                    { /* Nothing */ }
+            }
+            else
+            {
+                l_loop->pending = STD_HIGH;
+            }
+        }
+        else
+            { /* Nothing */ }
+    }
+}
+
+/**
+ * @brief : Adds one run to the statistics of a loop, from the main loop.
+ */
+static void loop_runner_record(loop_runner_loop_t *_loop, uint32_t exec_time)
+{
+    critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR2);
+    _loop->running = STD_LOW;
+    /* The statistics are frozen once the runs counter saturates */
+    if(0xFFFF != _loop->stats.runs)
+    {
+        _loop->stats.exec_last = exec_time;
+        if(exec_time > _loop->stats.exec_max)
+            { _loop->stats.exec_max = exec_time; }
+        else
+            { /* Nothing */ }
+        _loop->stats.exec_sum += exec_time;
+        _loop->stats.runs++;
+    }
+    else
+        { /* Nothing */ }
+    Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR2, l_critical_state);
+}
+#endif
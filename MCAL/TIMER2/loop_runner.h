@@ -0,0 +1,156 @@
+/*
+ * File:   loop_runner.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ *
+ *  --> The fixed rate loops runner <--
+ *
+ * The TIMER2 interrupt (PR2 match + postscaler) is the base rate, a loop
+ * runs every (divisor) base ticks. The released loops are run by
+ * loop_runner_dispatch() from the main loop in the rate monotonic order :
+ * the loop of the smaller divisor first, and the faster loops are checked
+ * again after every loop.
+ *
+ *      TMR2_SOLVER_DECLARE(loop_base, TIMER_SOLVER_CYCLES_HZ(1000));
+ *      Timer2_t base_timer = {
+ *          .prescaler_value = loop_base_PRESCALER,
+ *          .postscaler_value = loop_base_POSTSCALER, ... };
+ *      loop_runner_init(&base_timer, loop_base_PR2);
+ *      loop_runner_add(&current_loop);         (divisor 1  : 1 kHz)
+ *      loop_runner_add(&speed_loop);           (divisor 10 : 100 Hz)
+ *      while(1) { loop_runner_dispatch(); ... }
+ *
+ * A loop released again before its last release completed is an overrun,
+ * the new release is dropped and counted (the rate grid is kept).
+ */
+
+#ifndef LOOP_RUNNER_H
+#define	LOOP_RUNNER_H
+
+/* --------------- Section : Includes --------------- */
+#include "timer2.h"
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The loops a runner holds */
+#ifndef LOOP_RUNNER_MAX_LOOPS
+#define LOOP_RUNNER_MAX_LOOPS               8U
+#endif
+
+/*
+ * The execution times of the loops, the time stamps are taken from the
+ * monotonic clock (TIMER1) which the application starts, at prescaler 1
+ * the times are in instruction cycles (monotonic_clock_init() or bench_init()).
+ */
+#define LOOP_RUNNER_PROFILING_FEATURE       STD_ENABLE
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+
+/* --------------- Section: Data Type Declarations --------------- */
+typedef void (*loop_runner_callback_t)(void);
+
+/*
+ * The statistics of one loop.
+ */
+typedef struct {
+    uint32_t exec_sum;          /* The execution times of all the runs */
+    uint32_t exec_max;
+    uint32_t exec_last;
+    uint16_t runs;              /* The statistics are frozen once it saturates */
+    uint16_t overruns;          /* The releases dropped, the last one didn't complete */
+} loop_runner_stats_t;
+
+typedef struct {
+    /*
+     * Called on every release of the loop.
+     */
+    loop_runner_callback_t callback;
+    /*
+     * The loop runs every (divisor) base ticks (1 --> 255).
+     */
+    uint8_t divisor;
+    /*
+     * The base ticks before the first release (0 --> divisor - 1),
+     * spreads the loops of the same divisor over the base ticks.
+     */
+    uint8_t offset;
+    /*
+     * Private, the base ticks to the next release.
+     */
+    uint8_t countdown;
+    /*
+     * Private, released and not run yet (written by the ISR).
+     */
+    volatile uint8_t pending;
+    /*
+     * Private, in its callback (written by loop_runner_dispatch()).
+     */
+    volatile uint8_t running;
+    /*
+     * Private, read with loop_runner_get_stats().
+     */
+    loop_runner_stats_t stats;
+} loop_runner_loop_t;
+
+/*---------------  Section: Function Declarations --------------- */
+/**
+ *
+ * @Brief  A software interface starts the base rate on timer 2, the
+ *         period is (_period + 1) TMR2 counts times the postscaler.
+ *         The loops added before are removed.
+ * @param _timer : A pointer to a Timer2 object (prescaler, postscaler and priority),
+ *                 its interrupt handler and preloaded value are replaced by the runner.
+ * @param _period : The PR2 value.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType loop_runner_init(const Timer2_t *_timer, uint8_t _period);
+
+/**
+ *
+ * @Brief  A software interface adds a loop to the runner, the loop
+ *         is released from the next base tick on.
+ * @param _loop : The loop, its callback, divisor and offset are set.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ *                       (bad loop, loop already added or the runner is full)
+ */
+Std_ReturnType loop_runner_add(loop_runner_loop_t *_loop);
+
+/**
+ *
+ * @Brief  A software interface runs the released loops, the faster first.
+ *         Call it from the main loop, never from an interrupt.
+ * @return The number of the loops run.
+ */
+uint8_t loop_runner_dispatch(void);
+
+/**
+ *
+ * @Brief  A software interface reads the statistics of a loop.
+ * @param _loop : The loop.
+ * @param stats : Receives a consistent copy of the statistics.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType loop_runner_get_stats(const loop_runner_loop_t *_loop, loop_runner_stats_t *stats);
+
+/**
+ *
+ * @Brief  A software interface clears the statistics of all the loops.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ */
+Std_ReturnType loop_runner_reset_stats(void);
+
+/**
+ *
+ * @Brief  A software interface reads the base ticks since loop_runner_init().
+ * @return The base ticks (wraps at 2^32).
+ */
+uint32_t loop_runner_get_ticks(void);
+
+#endif	/* LOOP_RUNNER_H */
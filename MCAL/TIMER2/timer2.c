@@ -6,11 +6,14 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "timer2.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
 /* --------------- Section : Global Variables --------------- */
 #if TMR2_INTERRUPT_FEATURE==INTERRUPT_ENABLE
 static interrupt_handler_t TMR2_interrupt_handler = NULL;
 #endif
 static uint8_t g_preloaded_value = ZERO_INIT;
+/* The preloaded value plus the ticks lost by the reload of the ISR */
+static uint8_t g_reload_value = ZERO_INIT;
 
 /*---------------  Section: Function Definitions --------------- */
 /**
@@ -58,16 +61,29 @@ Std_ReturnType timer2_init(const Timer2_t *_timer)
                             break;                
         }
 #endif
-        // 4- Clear The Timer1 interrupt flag & Enable its interrupt.
+        // 4- Assign the interrupt handler, routed before the source is enabled.
+        TMR2_interrupt_handler = _timer->TMR2_INTERRUPT_HANDLER;
+        Interrupt_Manager_Register(INTERRUPT_SOURCE_TMR2, INTI_TMR2_ISR);
+        // 5- Clear The Timer2 interrupt flag & Enable its interrupt.
         INTI_TMR2_CLR_FLAG();
         INTI_TMR2_INTERRRUPT_ENABLE();
-        // 5- Assign the interrupt handler.
-        TMR2_interrupt_handler = _timer->TMR2_INTERRUPT_HANDLER;
 #endif
         
         /* 5. Write the preloaded value */
         g_preloaded_value = _timer->timer2_preloaded_value;
         TMR2_WRITE(g_preloaded_value);
+        switch (_timer->prescaler_value)
+        {
+            case TMR2_PRESCALER_RATIO_1 :
+                g_reload_value = g_preloaded_value + TMR2_RELOAD_COMPENSATION(1U);
+                break;
+            case TMR2_PRESCALER_RATIO_4 :
+                g_reload_value = g_preloaded_value + TMR2_RELOAD_COMPENSATION(4U);
+                break;
+            default :
+                g_reload_value = g_preloaded_value + TMR2_RELOAD_COMPENSATION(16U);
+                break;
+        }
         
         /* 6. Enable the timer2 module */
         TMR2_MODULE_ENABLE();
@@ -146,6 +162,31 @@ Std_ReturnType timer2_read_value(const Timer2_t *_timer, uint8_t *_val)
     return ret;
 }
 
+/**
+ * 
+ * @Brief : A software interface writes the period register of the timer 2 module,
+ *          the period is (_period + 1) ticks without any reload in the ISR.
+ *          (Leave the preloaded value zero in this mode)
+ * @param _timer : A pointer to a Timer2 object.
+ * @param _period : The value to be written into the PR2 register.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType timer2_set_period(const Timer2_t *_timer, uint8_t _period)
+{
+    Std_ReturnType ret = E_OK;
+    if (NULL == _timer)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        TMR2_PERIOD_WRITE(_period);
+    }
+    return ret;
+}
+
 /**
  * @brief : Timer2 Module Interrupt Handler.
  */
@@ -154,8 +195,14 @@ void INTI_TMR2_ISR (void)
     /* 1. Clear the Interrupt Flag */
     INTI_TMR2_CLR_FLAG();
     
-    /* 2. ReWrite The timer1 module with preloaded value */
-    TMR2_WRITE(g_preloaded_value);
+    /* 2. Add the preloaded value to the ticks counted since the PR2 match,
+     *    the interrupt latency doesn't stretch the period this way */
+    if(ZERO_INIT != g_preloaded_value)
+    {
+        TMR2_WRITE((uint8_t)(TMR2_READ() + g_reload_value));
+    }
+    else
+    { /* Nothing */ }
     
     /* 3. Call the ISR */
     if (TMR2_interrupt_handler)
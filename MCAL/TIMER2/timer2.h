@@ -10,6 +10,18 @@
 /* --------------- Section : Includes --------------- */
 #include "../Interrupt/INT_interrupts/MCAL_INTI.h"
 /* --------------- Section: Macro Declarations --------------- */
+/*
+ * The instruction cycles lost by the reload of the ISR, from the read of
+ * TMR2 to the write of the new count (XC8 listing of INTI_TMR2_ISR).
+ * With the prescaler the write also clears the prescaler and postscaler
+ * counters, the part of a tick counted before it is lost : 0 --> (prescaler - 1)
+ * cycles per period (about -10000 ppm for 100 us at 1:4 in BENCHMARK/timer_drift_test.c).
+ * Prefer timer2_set_period() (or loop_runner_init() for the control loops),
+ * the PR2 match resets TMR2 in hardware (exact with any prescaler).
+ */
+#ifndef TMR2_RELOAD_COMPENSATION_CYCLES
+#define TMR2_RELOAD_COMPENSATION_CYCLES     3U
+#endif
 
 /* --------------- Section: Macro Functions Declarations --------------- */
 /*
@@ -47,6 +59,16 @@
  */
 #define TMR2_WRITE(_D_)                     (TMR2 = _D_)  
 #define TMR2_READ()                         (TMR2)
+
+/*
+ * @Brief : The Timer2 Period Register, TMR2 is reset on the next tick
+ *          after it matches PR2 (The period is PR2 + 1 ticks).
+ * @note  : (PR2) Timer2 Period Register.
+ */
+#define TMR2_PERIOD_WRITE(_D_)              (PR2 = _D_)
+
+/* The reload compensation in timer2 ticks of a prescaler (_P_), rounded */
+#define TMR2_RELOAD_COMPENSATION(_P_)       ((TMR2_RELOAD_COMPENSATION_CYCLES + ((_P_) >> 1)) / (_P_))
 /* --------------- Section: Data Type Declarations --------------- */
 typedef enum
 {
@@ -148,5 +170,18 @@ Std_ReturnType timer2_write_value(const Timer2_t *_timer, uint8_t _val);
  *          (E_NOT_OK) : The function has issue to perform this action
  */
 Std_ReturnType timer2_read_value(const Timer2_t *_timer, uint8_t *_val);
+
+/**
+ * 
+ * @Brief : A software interface writes the period register of the timer 2 module,
+ *          the period is (_period + 1) ticks without any reload in the ISR.
+ *          (Leave the preloaded value zero in this mode)
+ * @param _timer : A pointer to a Timer2 object.
+ * @param _period : The value to be written into the PR2 register.
+ * @return Status of the function
+ *          (E_OK) : The function done successfully
+ *          (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType timer2_set_period(const Timer2_t *_timer, uint8_t _period);
 #endif	/* TIMER2_H */
 
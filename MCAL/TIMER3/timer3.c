@@ -6,11 +6,30 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "timer3.h"
+#include "../TIMER16/timer16.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
 /* --------------- Section : Global Variables --------------- */
+static timer16_state_t timer3_state;
+
+static const timer16_descriptor_t timer3_descriptor = {
+    .control_register = TMR3_T3CON_ADDRESS,
+    .count_low_register = TMR3_TMR3L_ADDRESS,
+    .count_high_register = TMR3_TMR3H_ADDRESS,
+    .flag_register = TMR3_PIR2_ADDRESS,
+    .enable_register = TMR3_PIE2_ADDRESS,
+    .priority_register = TMR3_IPR2_ADDRESS,
+    .interrupt_mask = TMR3_INTERRUPT_BIT_MASK,
+    .reload_compensation_cycles = TMR3_RELOAD_COMPENSATION_CYCLES,
+    .source = INTERRUPT_SOURCE_TMR3,
 #if TMR3_INTERRUPT_FEATURE==INTERRUPT_ENABLE
-static interrupt_handler_t TMR3_interrupt_handler = NULL;
+    .isr = INTI_TMR3_ISR,
+#else
+    .isr = NULL,
 #endif
-static uint16_t g_preloaded_value = ZERO_INIT;
+    .state = &timer3_state
+};
+
 /*---------------  Section: Function Definitions --------------- */
 /**
  * 
@@ -23,84 +42,25 @@ static uint16_t g_preloaded_value = ZERO_INIT;
 Std_ReturnType timer3_init(const Timer3_t *_timer)
 {
     Std_ReturnType ret = E_OK;
+    Timer16_t l_timer = {ZERO_INIT};
     if (NULL == _timer)
     {
         ret = E_NOT_OK;
     }
     else
     {
-        /* 1. Disable Timer 3 Module */
-        TMR3_MODULE_DISABLE();
-        
-        /* 2. Configure the module mode */
-        switch (_timer->timer3_mode)
-        {
-            case TMR3_TIMER_MODE : TMR3_INTERNAL_CLK_MODE();
-                            break;
-            case TMR3_COUNTER_MODE : 
-                TMR3_EXTERNEL_CLK_MODE();
-                switch (_timer->timer3_counter_synch_mode)
-                {
-                    case TMR3_COUNTER_SYNCH: TMR3_COUNTER_SET_SYNCH();
-                                        break;
-                    case TMR3_COUNTER_ASYNCH: TMR3_COUNTER_SET_ASYNCH();
-                                        break;
-                    default : /* Nothing */
-                                        break;
-                }
-                
-                break;
-            default : TMR3_INTERNAL_CLK_MODE();
-                            break;
-        }
-        
-        /* 3. Configure the Prescaler Assignment and Rate */
-        TMR3_PRESCALER_SET_RATIO(_timer->prescaler_value);
-        
-        /* 4. Configure the timer1 r/w register size */
-        switch (_timer->timer3_rw_mode)
-        {
-            case TMR3_RW_REG_MODE_8BIT : TMR3_RW_SET_MODE_8BIT();
-                                    break;
-            case TMR3_RW_REG_MODE_16BIT : TMR3_RW_SET_MODE_16BIT();
-                                    break;
-            default : TMR3_RW_SET_MODE_16BIT();
-                                    break;
-                
-        }
-        
-        /* 5. Configure The Interrupts */
 #if TMR3_INTERRUPT_FEATURE==INTERRUPT_ENABLE
-        // 1- Enable Global & Peripheral Interrupts
-        INTERRUPT_GIEH_ENABLE();    /* Enable Global Interrupts */
-        INTERRUPT_GIEL_ENABLE();    /* Enable Peripheral Interrupts */
-        // 2- Enable The priority.
+        l_timer.TMR_INTERRUPT_HANDLER = _timer->TMR3_INTERRUPT_HANDLER;
 #if INTERRUPT_PRIORITY_FEATURE==INTERRUPT_ENABLE
-        INTERRUPT_PRIORITY_ENABLE();
-        // 3- Assign the Specified priority. 
-        switch (_timer->priority)
-        {
-            case PRIORITY_HIGH : INTI_TMR3_INTERRUPT_PRIORITY_HIGH();
-                            break;
-            case PRIORITY_LOW : INTI_TMR3_INTERRUPT_PRIORITY_LOW();
-                            break;
-            default : INTI_TMR3_INTERRUPT_PRIORITY_HIGH();
-                                    break;
-        }
+        l_timer.priority = _timer->priority;
 #endif
-        // 4- Clear The Timer 3 interrupt flag & Enable its interrupt
-        INTI_TMR3_CLR_FLAG();
-        INTI_TMR3_INTERRRUPT_ENABLE();
-        // 5- Assign the interrupt handler.
-        TMR3_interrupt_handler = _timer->TMR3_INTERRUPT_HANDLER;
 #endif
-        
-        /* 6. Write the preloaded value */
-        g_preloaded_value = _timer->timer3_preloaded_value;
-        TMR3_WRITE(g_preloaded_value);
-        
-        /* 7. Enable the timer 3 module */
-        TMR3_MODULE_ENABLE();
+        l_timer.preloaded_value = _timer->timer3_preloaded_value;
+        l_timer.prescaler_value = _timer->prescaler_value;
+        l_timer.timer_mode = _timer->timer3_mode;
+        l_timer.counter_synch_mode = _timer->timer3_counter_synch_mode;
+        l_timer.rw_mode = _timer->timer3_rw_mode;
+        ret = timer16_init(&timer3_descriptor, &l_timer);
     }
     return ret;
 }
@@ -122,13 +82,9 @@ Std_ReturnType timer3_deInit(const Timer3_t *_timer)
     }
     else
     {
-        /* 1. Disable Timer 3 Module */
-        TMR3_MODULE_DISABLE();
-        
-        /* 2. Disable The timer 3 interrupt */
-        INTI_TMR3_INTERRRUPT_DISABLE();
+        ret = timer16_deInit(&timer3_descriptor);
     }
-    return ret;   
+    return ret;
 }
 
 /**
@@ -149,7 +105,14 @@ Std_ReturnType timer3_write_value(const Timer3_t *_timer, uint16_t _val)
     }
     else
     {
+#if TMR3_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        /* TMR3H is buffered, keep the reload of the ISR out of the two bytes write */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR3);
+#endif
         TMR3_WRITE(_val);
+#if TMR3_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR3, l_critical_state);
+#endif
     }
     return ret;  
 }
@@ -172,7 +135,14 @@ Std_ReturnType timer3_read_value(const Timer3_t *_timer, uint16_t *_val)
     }
     else
     {
+#if TMR3_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        /* The high byte is latched in TMR3H, the reload of the ISR overwrites it */
+        critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_TMR3);
+#endif
         *_val = TMR3_READ();
+#if TMR3_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+        Critical_Section_Unmask_Source(INTERRUPT_SOURCE_TMR3, l_critical_state);
+#endif
     }
     return ret;  
 }
@@ -185,13 +155,20 @@ void INTI_TMR3_ISR (void)
     /* 1. Clear the Interrupt Flag */
     INTI_TMR3_CLR_FLAG();
     
-    /* 2. ReWrite The timer1 module with preloaded value */
-    TMR3_WRITE(g_preloaded_value);
+    /* 2. Add the preloaded value to the ticks counted since the overflow,
+     *    the interrupt latency doesn't stretch the period this way.
+     *    (A free running timer already rolled over to zero, leave it) */
+    if(ZERO_INIT != timer3_state.preloaded_value)
+    {
+        TMR3_WRITE((uint16_t)(TMR3_READ() + timer3_state.reload_value));
+    }
+    else
+    { /* Nothing */ }
     
     /* 3. Call the ISR */
-    if (TMR3_interrupt_handler)
+    if (timer3_state.handler)
     {
-        TMR3_interrupt_handler();
+        timer3_state.handler();
     }
     else
     { /* Nothing */}
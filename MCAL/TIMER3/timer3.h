@@ -12,6 +12,20 @@
 #include "../compiler.h"
 #include "../Interrupt/INT_interrupts/MCAL_INTI.h"
 /* --------------- Section: Macro Declarations --------------- */
+/*
+ * The instruction cycles lost by the reload of the ISR, from the read of
+ * the count to the write of the new one (XC8 listing of INTI_TMR3_ISR).
+ * With the prescaler the write also clears the prescaler counter, the part
+ * of a tick counted before it is lost : 0 --> (prescaler - 1) cycles per
+ * period (BENCHMARK/timer_drift_test.c).
+ * For a period without any reload leave the preloaded value zero and
+ * run a CCP module in (CCP_COMPARE_GEN_EVENT) on timer3, its special
+ * event trigger resets TMR3 on the match in hardware (exact with any prescaler).
+ */
+#ifndef TMR3_RELOAD_COMPENSATION_CYCLES
+#define TMR3_RELOAD_COMPENSATION_CYCLES     10U
+#endif
+
 #define TMR3_TIMER_MODE             STD_LOW
 #define TMR3_COUNTER_MODE           STD_HIGH
 
@@ -24,6 +38,16 @@
 
 #define TMR3_RW_REG_MODE_8BIT       STD_LOW
 #define TMR3_RW_REG_MODE_16BIT      STD_HIGH
+
+/* The registers of timer3 by their addresses (its timer16 descriptor) */
+#define TMR3_T3CON_ADDRESS          0xFB1U
+#define TMR3_TMR3L_ADDRESS          0xFB2U
+#define TMR3_TMR3H_ADDRESS          0xFB3U
+#define TMR3_PIR2_ADDRESS           0xFA1U
+#define TMR3_PIE2_ADDRESS           0xFA0U
+#define TMR3_IPR2_ADDRESS           0xFA2U
+/* TMR3IF, TMR3IE and TMR3IP : bit <1> */
+#define TMR3_INTERRUPT_BIT_MASK     0x02U
 /* --------------- Section: Macro Functions Declarations --------------- */
 /*
  * @brief : The Timer3 Enabling configuration.
@@ -82,6 +106,7 @@
  */
 #define TMR3_WRITE(_D_)                 (TMR3 = _D_)
 #define TMR3_READ()                     (TMR3)
+
 /* --------------- Section: Data Type Declarations --------------- */
 typedef enum
 {
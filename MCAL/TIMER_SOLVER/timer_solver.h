@@ -0,0 +1,288 @@
+/*
+ * File:   timer_solver.h
+ * Author: Mostafa Asaad
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef TIMER_SOLVER_H
+#define	TIMER_SOLVER_H
+
+/* --------------- Section : Includes --------------- */
+#include "../TIMER0/timer0.h"
+#include "../TIMER1/timer1.h"
+#include "../TIMER2/timer2.h"
+#include "../TIMER3/timer3.h"
+
+/*
+ * Compile-time period solver for timers 0 --> 3.
+ * Every macro is an integer constant expression of (_XTAL_FREQ),
+ * nothing is computed at run time.
+ *
+ *  1. Get the period in instruction cycles (FOSC / 4) :
+ *          TIMER_SOLVER_CYCLES_US(1000)  or  TIMER_SOLVER_CYCLES_HZ(50)
+ *  2. Timers 0, 1 and 3 : the prescaler and the preloaded value.
+ *          #define TICK_CYCLES     TIMER_SOLVER_CYCLES_US(1000)
+ *          TMR0_SOLVER_CHECK(tick_timer, TICK_CYCLES);
+ *          Timer0_t tick_timer = {
+ *              .prescaler_enable = TMR0_SOLVER_PRESCALER_ENABLE(TICK_CYCLES),
+ *              .prescaler_value = TMR0_SOLVER_PRESCALER(TICK_CYCLES),
+ *              .timer0_preloaded_value = TMR0_SOLVER_PRELOAD(TICK_CYCLES),
+ *              .tmr0_register_size = TMR0_16_BIT_MODE, ... };
+ *     The prescalers are powers of 2, so the smallest prescaler the
+ *     period fits in has the smallest error.
+ *  3. Timer 2 : the prescaler, the postscaler and the PR2/preloaded value,
+ *     all the 48 prescaler/postscaler pairs are searched for the smallest error.
+ *          TMR2_SOLVER_DECLARE(pwm_timer, TIMER_SOLVER_CYCLES_HZ(1000));
+ *          Timer2_t pwm_timer = {
+ *              .prescaler_value = pwm_timer_PRESCALER,
+ *              .postscaler_value = pwm_timer_POSTSCALER,
+ *              .timer2_preloaded_value = pwm_timer_PRELOAD, ... };
+ *     (_NAME_##_PR2 is the PR2 value of the same period when TMR2 starts from zero)
+ *
+ *  4. Timer 2 as the CCP PWM time base : the PWM period ignores the
+ *     postscaler, the smallest prescaler the period fits in leaves the
+ *     largest PR2 and so the finest duty cycle.
+ *          #define MOTOR_PWM_HZ    20000UL
+ *          TMR2_PWM_SOLVER_CHECK(motor_pwm, MOTOR_PWM_HZ);
+ *          Timer2_t pwm_timer = {
+ *              .prescaler_value = TMR2_PWM_SOLVER_PRESCALER(MOTOR_PWM_HZ), ... };
+ *          ccp_t motor_pwm = {
+ *              .ccp_pwm_pr2 = TMR2_PWM_SOLVER_PR2(MOTOR_PWM_HZ), ... };
+ *     TMR2_PWM_SOLVER_FREQUENCY_HZ() is the frequency reached and
+ *     TMR2_PWM_SOLVER_RESOLUTION_BITS() the duty cycle bits it leaves.
+ *
+ * An unreachable period stops the build with a negative array size
+ * error : the values themselves hold the check (an unnamed array), the
+ * ..._CHECK() macros add the (..._is_unreachable) type naming the timer.
+ * (The frequency or the period must be a constant expression)
+ */
+
+/* --------------- Section: Macro Declarations --------------- */
+/* The instruction cycles (FOSC / 4) of one millisecond */
+#define TIMER_SOLVER_CYCLES_PER_MS          (_XTAL_FREQ / 4000UL)
+
+#define TIMER_SOLVER_TMR_16BIT_COUNTS       65536UL
+#define TIMER_SOLVER_TMR2_COUNTS            256UL
+
+/* The timer 2 search key : (error << 6) | (prescaler index << 4) | postscaler index */
+#define TMR2_SOLVER_KEY_UNREACHABLE         0x7FFF
+
+/* --------------- Section: Macro Functions Declarations --------------- */
+/* The period in instruction cycles, rounded to the nearest cycle */
+#define TIMER_SOLVER_CYCLES_US(_PERIOD_US_)                                     \
+    ((((_PERIOD_US_) / 1000UL) * TIMER_SOLVER_CYCLES_PER_MS)                    \
+     + ((((_PERIOD_US_) % 1000UL) * TIMER_SOLVER_CYCLES_PER_MS + 500UL) / 1000UL))
+
+#define TIMER_SOLVER_CYCLES_HZ(_FREQ_HZ_)                                       \
+    (((_XTAL_FREQ / 4UL) + ((_FREQ_HZ_) / 2UL)) / ((_FREQ_HZ_) * 1UL))
+
+/* The counts of (_DIV_) cycles nearest to (_CYCLES_) */
+#define TIMER_SOLVER_COUNTS(_CYCLES_, _DIV_)    (((_CYCLES_) + ((_DIV_) / 2UL)) / (_DIV_))
+
+/* Stops the build when (_COND_) is false */
+#define TIMER_SOLVER_STATIC_ASSERT(_COND_, _NAME_)  typedef char _NAME_[(_COND_) ? 1 : -1]
+
+/* The same inside an expression, its value is 0 */
+#define TIMER_SOLVER_ASSERT_ZERO(_COND_)        (0UL * sizeof(char[(_COND_) ? 1 : -1]))
+
+/* ------------------------------ Timer 0 ------------------------------ */
+/* log2 of the smallest prescaler (1 --> 256) fitting the 16-bit timer, 9 : unreachable */
+#define TMR0_SOLVER_RATIO_LOG2(_CYCLES_)                                        \
+    (((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 0)) ? 0 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 1)) ? 1 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 2)) ? 2 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 3)) ? 3 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 4)) ? 4 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 5)) ? 5 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 6)) ? 6 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 7)) ? 7 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 8)) ? 8 : 9)
+
+#define TMR0_SOLVER_REACHABLE(_CYCLES_)                                         \
+    (((_CYCLES_) > 0) && (TMR0_SOLVER_RATIO_LOG2(_CYCLES_) <= 8))
+
+#define TMR0_SOLVER_PRESCALER_ENABLE(_CYCLES_)                                  \
+    ((0 == TMR0_SOLVER_RATIO_LOG2(_CYCLES_)) ? TMR0_PRESCALER_DISABLE : TMR0_PRESCALER_ENABLE)
+
+/* (timer0_prescalar_ratio_t), TMR0_PRESCALAR_RATIO_2 is 0 */
+#define TMR0_SOLVER_PRESCALER(_CYCLES_)                                         \
+    (((0 == TMR0_SOLVER_RATIO_LOG2(_CYCLES_)) ? TMR0_PRESCALAR_RATIO_2          \
+                                              : (TMR0_SOLVER_RATIO_LOG2(_CYCLES_) - 1))  \
+     + TIMER_SOLVER_ASSERT_ZERO(TMR0_SOLVER_REACHABLE(_CYCLES_)))
+
+#define TMR0_SOLVER_PRELOAD(_CYCLES_)                                           \
+    ((uint16_t)(TIMER_SOLVER_TMR_16BIT_COUNTS                                   \
+     - TIMER_SOLVER_COUNTS((_CYCLES_), (1UL << TMR0_SOLVER_RATIO_LOG2(_CYCLES_)))  \
+     + TIMER_SOLVER_ASSERT_ZERO(TMR0_SOLVER_REACHABLE(_CYCLES_))))
+
+#define TMR0_SOLVER_CHECK(_NAME_, _CYCLES_)                                     \
+    TIMER_SOLVER_STATIC_ASSERT(TMR0_SOLVER_REACHABLE(_CYCLES_), _NAME_##_is_unreachable)
+
+/* --------------------------- Timers 1 and 3 --------------------------- */
+/* log2 of the smallest prescaler (1 --> 8) fitting the 16-bit timer, 4 : unreachable */
+#define TMR13_SOLVER_RATIO_LOG2(_CYCLES_)                                       \
+    (((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 0)) ? 0 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 1)) ? 1 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 2)) ? 2 :                 \
+     ((_CYCLES_) <= (TIMER_SOLVER_TMR_16BIT_COUNTS << 3)) ? 3 : 4)
+
+#define TMR13_SOLVER_REACHABLE(_CYCLES_)                                        \
+    (((_CYCLES_) > 0) && (TMR13_SOLVER_RATIO_LOG2(_CYCLES_) <= 3))
+
+/* (timer1_prescaler_ratio_t) / (timer3_prescaler_ratio_t), the ratio is (1 << value) */
+#define TMR1_SOLVER_PRESCALER(_CYCLES_)                                         \
+    (TMR13_SOLVER_RATIO_LOG2(_CYCLES_) + TIMER_SOLVER_ASSERT_ZERO(TMR13_SOLVER_REACHABLE(_CYCLES_)))
+#define TMR3_SOLVER_PRESCALER(_CYCLES_)         TMR1_SOLVER_PRESCALER(_CYCLES_)
+
+#define TMR1_SOLVER_PRELOAD(_CYCLES_)                                           \
+    ((uint16_t)(TIMER_SOLVER_TMR_16BIT_COUNTS                                   \
+     - TIMER_SOLVER_COUNTS((_CYCLES_), (1UL << TMR13_SOLVER_RATIO_LOG2(_CYCLES_)))  \
+     + TIMER_SOLVER_ASSERT_ZERO(TMR13_SOLVER_REACHABLE(_CYCLES_))))
+#define TMR3_SOLVER_PRELOAD(_CYCLES_)           TMR1_SOLVER_PRELOAD(_CYCLES_)
+
+#define TMR1_SOLVER_CHECK(_NAME_, _CYCLES_)                                     \
+    TIMER_SOLVER_STATIC_ASSERT(TMR13_SOLVER_REACHABLE(_CYCLES_), _NAME_##_is_unreachable)
+#define TMR3_SOLVER_CHECK(_NAME_, _CYCLES_)     TMR1_SOLVER_CHECK(_NAME_, _CYCLES_)
+
+/* ------------------------------ Timer 2 ------------------------------ */
+/* The divider of a search index : prescaler (1, 4, 16) * postscaler (1 --> 16) */
+#define TMR2_SOLVER_DIVIDER(_INDEX_)                                            \
+    ((1UL << (2U * ((_INDEX_) >> 4))) * (((_INDEX_) & 0x0FUL) + 1UL))
+
+#define TMR2_SOLVER_COUNTS(_CYCLES_, _INDEX_)                                   \
+    TIMER_SOLVER_COUNTS((_CYCLES_), TMR2_SOLVER_DIVIDER(_INDEX_))
+
+#define TMR2_SOLVER_ERROR(_CYCLES_, _INDEX_)                                    \
+    (((TMR2_SOLVER_COUNTS(_CYCLES_, _INDEX_) * TMR2_SOLVER_DIVIDER(_INDEX_)) >= (_CYCLES_))  \
+     ? ((TMR2_SOLVER_COUNTS(_CYCLES_, _INDEX_) * TMR2_SOLVER_DIVIDER(_INDEX_)) - (_CYCLES_)) \
+     : ((_CYCLES_) - (TMR2_SOLVER_COUNTS(_CYCLES_, _INDEX_) * TMR2_SOLVER_DIVIDER(_INDEX_))))
+
+/* The key of a search index, the smallest key is the smallest error */
+#define TMR2_SOLVER_KEY(_CYCLES_, _INDEX_)                                      \
+    (((TMR2_SOLVER_COUNTS(_CYCLES_, _INDEX_) >= 1UL)                            \
+      && (TMR2_SOLVER_COUNTS(_CYCLES_, _INDEX_) <= TIMER_SOLVER_TMR2_COUNTS))   \
+     ? (int)((TMR2_SOLVER_ERROR(_CYCLES_, _INDEX_) << 6) | (_INDEX_))           \
+     : TMR2_SOLVER_KEY_UNREACHABLE)
+
+#define TMR2_SOLVER_MIN(_A_, _B_)               (((_A_) <= (_B_)) ? (_A_) : (_B_))
+
+/* One search step, every step keeps the best key so far as an enumeration constant */
+#define TMR2_SOLVER_STEP(_NAME_, _CYCLES_, _INDEX_, _PREV_)                     \
+    _NAME_##_KEY_##_INDEX_ = TMR2_SOLVER_MIN(_NAME_##_KEY_##_PREV_, TMR2_SOLVER_KEY((_CYCLES_), _INDEX_##UL))
+
+#define TMR2_SOLVER_DECLARE(_NAME_, _CYCLES_)                                   \
+    enum {                                                                      \
+        _NAME_##_KEY_0 = TMR2_SOLVER_KEY((_CYCLES_), 0UL),                      \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 1, 0),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 2, 1),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 3, 2),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 4, 3),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 5, 4),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 6, 5),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 7, 6),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 8, 7),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 9, 8),                               \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 10, 9),                              \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 11, 10),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 12, 11),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 13, 12),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 14, 13),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 15, 14),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 16, 15),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 17, 16),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 18, 17),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 19, 18),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 20, 19),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 21, 20),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 22, 21),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 23, 22),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 24, 23),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 25, 24),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 26, 25),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 27, 26),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 28, 27),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 29, 28),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 30, 29),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 31, 30),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 32, 31),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 33, 32),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 34, 33),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 35, 34),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 36, 35),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 37, 36),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 38, 37),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 39, 38),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 40, 39),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 41, 40),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 42, 41),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 43, 42),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 44, 43),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 45, 44),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 46, 45),                             \
+        TMR2_SOLVER_STEP(_NAME_, _CYCLES_, 47, 46),                             \
+        _NAME_##_BEST = (_NAME_##_KEY_47 & 0x3F),                               \
+        _NAME_##_PRESCALER = (_NAME_##_BEST >> 4),                              \
+        _NAME_##_POSTSCALER = (_NAME_##_BEST & 0x0F),                           \
+        _NAME_##_COUNTS = (int)TMR2_SOLVER_COUNTS((_CYCLES_), (unsigned long)_NAME_##_BEST),  \
+        _NAME_##_PR2 = (_NAME_##_COUNTS - 1),                                   \
+        _NAME_##_PRELOAD = (int)(TIMER_SOLVER_TMR2_COUNTS - _NAME_##_COUNTS)    \
+    };                                                                          \
+    TIMER_SOLVER_STATIC_ASSERT(_NAME_##_KEY_47 != TMR2_SOLVER_KEY_UNREACHABLE, _NAME_##_is_unreachable)
+
+/* ------------------------- Timer 2 CCP PWM ------------------------- */
+/* The PWM period in instruction cycles, TMR2 counts them at prescaler 1 */
+#define TMR2_PWM_SOLVER_CYCLES(_FREQ_HZ_)       TIMER_SOLVER_CYCLES_HZ(_FREQ_HZ_)
+
+/* log4 of the smallest prescaler (1, 4, 16) fitting PR2, 3 : unreachable */
+#define TMR2_PWM_SOLVER_RATIO_LOG4(_FREQ_HZ_)                                   \
+    ((TIMER_SOLVER_COUNTS(TMR2_PWM_SOLVER_CYCLES(_FREQ_HZ_), 1UL) <= TIMER_SOLVER_TMR2_COUNTS) ? 0 :  \
+     (TIMER_SOLVER_COUNTS(TMR2_PWM_SOLVER_CYCLES(_FREQ_HZ_), 4UL) <= TIMER_SOLVER_TMR2_COUNTS) ? 1 :  \
+     (TIMER_SOLVER_COUNTS(TMR2_PWM_SOLVER_CYCLES(_FREQ_HZ_), 16UL) <= TIMER_SOLVER_TMR2_COUNTS) ? 2 : 3)
+
+/* The prescaler ratio (1, 4 or 16) */
+#define TMR2_PWM_SOLVER_RATIO(_FREQ_HZ_)        (1UL << (2U * TMR2_PWM_SOLVER_RATIO_LOG4(_FREQ_HZ_)))
+
+/* The TMR2 counts of one PWM period (PR2 + 1) */
+#define TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_)                                       \
+    TIMER_SOLVER_COUNTS(TMR2_PWM_SOLVER_CYCLES(_FREQ_HZ_), TMR2_PWM_SOLVER_RATIO(_FREQ_HZ_))
+
+#define TMR2_PWM_SOLVER_REACHABLE(_FREQ_HZ_)                                    \
+    (((_FREQ_HZ_) > 0) && (TMR2_PWM_SOLVER_RATIO_LOG4(_FREQ_HZ_) <= 2)         \
+     && (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 1UL))
+
+/* (timer2_prescaler_ratio_t) */
+#define TMR2_PWM_SOLVER_PRESCALER(_FREQ_HZ_)                                    \
+    (TMR2_PWM_SOLVER_RATIO_LOG4(_FREQ_HZ_) + TIMER_SOLVER_ASSERT_ZERO(TMR2_PWM_SOLVER_REACHABLE(_FREQ_HZ_)))
+
+#define TMR2_PWM_SOLVER_PR2(_FREQ_HZ_)                                          \
+    ((uint8_t)(TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) - 1UL                         \
+     + TIMER_SOLVER_ASSERT_ZERO(TMR2_PWM_SOLVER_REACHABLE(_FREQ_HZ_))))
+
+/* The frequency reached, rounded to the nearest Hz */
+#define TMR2_PWM_SOLVER_FREQUENCY_HZ(_FREQ_HZ_)                                 \
+    TIMER_SOLVER_COUNTS((_XTAL_FREQ / 4UL),                                     \
+        (TMR2_PWM_SOLVER_RATIO(_FREQ_HZ_) * TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_)))
+
+/* The full duty cycle of CCP_PWM_SetDutyRaw(), 4 * (PR2 + 1) */
+#define TMR2_PWM_SOLVER_DUTY_RAW_MAX(_FREQ_HZ_) (4UL * TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_))
+
+/* The whole duty cycle bits, log2(4 * (PR2 + 1)) rounded down (2 --> 10) */
+#define TMR2_PWM_SOLVER_RESOLUTION_BITS(_FREQ_HZ_)                              \
+    ((TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 256UL) ? 10 :                        \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 128UL) ? 9 :                         \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 64UL) ? 8 :                          \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 32UL) ? 7 :                          \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 16UL) ? 6 :                          \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 8UL) ? 5 :                           \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 4UL) ? 4 :                           \
+     (TMR2_PWM_SOLVER_COUNTS(_FREQ_HZ_) >= 2UL) ? 3 : 2)
+
+#define TMR2_PWM_SOLVER_CHECK(_NAME_, _FREQ_HZ_)                                \
+    TIMER_SOLVER_STATIC_ASSERT(TMR2_PWM_SOLVER_REACHABLE(_FREQ_HZ_), _NAME_##_is_unreachable)
+
+/* --------------- Section: Data Type Declarations --------------- */
+
+/*---------------  Section: Function Declarations --------------- */
+
+#endif	/* TIMER_SOLVER_H */
@@ -6,6 +6,11 @@
  */
 /* --------------- Section : Includes --------------- */
 #include "usart.h"
+#include "../Interrupt/MCAL_interrupt_manager.h"
+#include "../Interrupt/CRITICAL_section/MCAL_critical_section.h"
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+#include "../Interrupt/EVENT_queue/MCAL_event_queue.h"
+#endif
 /* --------------- Section : Global Variables --------------- */
 #if EUSART_TX_INTERRUPT_FEATURE==INTERRUPT_ENABLE
 static interrupt_handler_t USART_TX_Interrupt_Handler = NULL;
@@ -15,6 +20,11 @@ static interrupt_handler_t USART_RX_Interrupt_Handler = NULL;
 #endif
 static interrupt_handler_t USART_Framing_Error_Handler = NULL;
 static interrupt_handler_t USART_Overrun_Error_Handler = NULL;
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/* The byte of the event being delivered to the reception handler */
+static uint8_t usart_deferred_byte = ZERO_INIT;
+static uint8_t usart_deferred_byte_valid = STD_FALSE;
+#endif
 /*---------------  Section: Helper Functions Declarations --------------- */
 /**
  * A helper software interface initializes 
@@ -24,6 +34,15 @@ static interrupt_handler_t USART_Overrun_Error_Handler = NULL;
  */
 static void USART_ASYNC_BR_Init(const usart_t *usart_Obj);
 
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+/**
+ * The deferred part of the reception interrupt, called by
+ * event_dispatch() with the received byte and the errors bits.
+ * @param payload : (RCSTA errors bits << 8) | received byte.
+ */
+static void USART_RX_Deferred_Handler(uint16_t payload);
+#endif
+
 /**
  * A helper software interface initializes 
  * transmission mode with the specified configurations.
@@ -157,13 +176,31 @@ Std_ReturnType USART_ASYNC_Read_Byte_With_NoBlocking(uint8_t *byte_read)
     }
     else
     {
-        if(PIR1bits.RCIF)
-        { 
-            /* Read the RC register */
-            *byte_read = RCREG; 
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+        /* Inside the deferred handler the byte was already read by the ISR */
+        if(STD_TRUE == usart_deferred_byte_valid)
+        {
+            *byte_read = usart_deferred_byte;
+            usart_deferred_byte_valid = STD_FALSE;
         }
         else
-            { ret = E_NOT_OK; }        
+#endif
+        {
+#if EUSART_RX_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+            /* The reception ISR must not take the byte between the check and the read */
+            critical_state_t l_critical_state = Critical_Section_Mask_Source(INTERRUPT_SOURCE_EUSART_RX);
+#endif
+            if(PIR1bits.RCIF)
+            { 
+                /* Read the RC register */
+                *byte_read = RCREG; 
+            }
+            else
+                { ret = E_NOT_OK; }
+#if EUSART_RX_INTERRUPT_FEATURE==INTERRUPT_ENABLE
+            Critical_Section_Unmask_Source(INTERRUPT_SOURCE_EUSART_RX, l_critical_state);
+#endif
+        }
     }
     return ret;
 }
@@ -273,7 +310,6 @@ Std_ReturnType USART_ASYNC_Write_Number_With_Blocking(const sint32_t number_writ
     
     ret = USART_ASYNC_Write_String_With_Blocking(number_string);
     
-    free(number_string);
     return ret;
 }
 /**
@@ -296,7 +332,6 @@ Std_ReturnType USART_ASYNC_Write_Number_With_NoBlocking(const sint32_t number_wr
     
     ret = USART_ASYNC_Write_String_With_NoBlocking(number_string);
     
-    free(number_string);
     return ret;
 }
 /* ---------------  Section: Helper Functions Definitions --------------- */
@@ -371,8 +406,6 @@ static void USART_ASYNC_TX_Init(const usart_t* usart_Obj)
             switch (usart_Obj -> usart_tx_cfgs.usart_tx_interrupt_enable)
             {
                 case EUSART_ASYNC_INTERRUPT_TX_ENABLE : 
-                    /* Enable the Interrupts for the usart module */
-                    INTI_EUSART_TX_INTERRRUPT_ENABLE();
                     // Enable Global & Peripheral Interrupts
                     INTERRUPT_GIEH_ENABLE();    /* Enable Global Interrupts */
                     INTERRUPT_GIEL_ENABLE();    /* Enable Peripheral Interrupts */
@@ -393,6 +426,9 @@ static void USART_ASYNC_TX_Init(const usart_t* usart_Obj)
 #endif
                     // Assign the interrupt handler.
                     USART_TX_Interrupt_Handler = usart_Obj -> EUSART_TX_InterruptHandler;
+                    Interrupt_Manager_Register(INTERRUPT_SOURCE_EUSART_TX, USART_TX_ISR);
+                    /* Enable the Interrupts for the usart module, once routed */
+                    INTI_EUSART_TX_INTERRRUPT_ENABLE();
                     break;
                 
                 case EUSART_ASYNC_INTERRUPT_TX_DISABLE : 
@@ -446,8 +482,6 @@ switch (usart_Obj -> usart_rx_cfgs.usart_rx_enable)
             switch (usart_Obj -> usart_rx_cfgs.usart_rx_interrupt_enable)
             {
                 case EUSART_ASYNC_INTERRUPT_RX_ENABLE : 
-                    /* Enable the Interrupts for the usart module */
-                    INTI_EUSART_RX_INTERRRUPT_ENABLE();
                     // Enable Global & Peripheral Interrupts
                     INTERRUPT_GIEH_ENABLE();    /* Enable Global Interrupts */
                     INTERRUPT_GIEL_ENABLE();    /* Enable Peripheral Interrupts */
@@ -467,6 +501,12 @@ switch (usart_Obj -> usart_rx_cfgs.usart_rx_enable)
 #endif
                     // Assign the interrupt handler.
                     USART_RX_Interrupt_Handler = usart_Obj -> EUSART_RX_InterruptHandler;
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+                    event_register_handler(INTERRUPT_SOURCE_EUSART_RX, USART_RX_Deferred_Handler);
+#endif
+                    Interrupt_Manager_Register(INTERRUPT_SOURCE_EUSART_RX, USART_RX_ISR);
+                    /* Enable the Interrupts for the usart module, once routed */
+                    INTI_EUSART_RX_INTERRRUPT_ENABLE();
                     break;
                 case EUSART_ASYNC_INTERRUPT_RX_DISABLE : 
                     INTI_EUSART_RX_INTERRRUPT_DISABLE(); 
@@ -513,6 +553,12 @@ void USART_TX_ISR(void)
 
 void USART_RX_ISR(void)
 {    
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+    /* Reading RCREG clears the flag, the errors bits belong to this byte */
+    uint16_t l_payload = (uint16_t)((RCSTA & EUSART_RX_ERRORS_MASK) << 8);
+    l_payload |= RCREG;
+    event_post(INTERRUPT_SOURCE_EUSART_RX, l_payload);
+#else
     if(USART_RX_Interrupt_Handler)
         { USART_RX_Interrupt_Handler(); }
     else
@@ -527,4 +573,30 @@ void USART_RX_ISR(void)
         { USART_Overrun_Error_Handler(); }
     else
         { /* Nothing */ }
-}
\ No newline at end of file
+#endif
+}
+
+#if EUSART_RX_DEFERRED_FEATURE==INTERRUPT_ENABLE
+static void USART_RX_Deferred_Handler(uint16_t payload)
+{
+    /* 1. Hand the byte to USART_ASYNC_Read_Byte_With_NoBlocking() */
+    usart_deferred_byte = (uint8_t)payload;
+    usart_deferred_byte_valid = STD_TRUE;
+    if(USART_RX_Interrupt_Handler)
+        { USART_RX_Interrupt_Handler(); }
+    else
+        { /* Nothing */ }
+    usart_deferred_byte_valid = STD_FALSE;
+    
+    /* 2. Report the errors of this byte */
+    if((payload & (EUSART_RX_FERR_MASK << 8)) && USART_Framing_Error_Handler)
+        { USART_Framing_Error_Handler(); }
+    else
+        { /* Nothing */ }
+    
+    if((payload & (EUSART_RX_OERR_MASK << 8)) && USART_Overrun_Error_Handler)
+        { USART_Overrun_Error_Handler(); }
+    else
+        { /* Nothing */ }
+}
+#endif
\ No newline at end of file
@@ -21,6 +21,13 @@
  * The USART Module is disabled.
  */
 #define EUSART_DISABLE                      STD_DISABLE
+/*
+ * The reception errors bits in RCSTA.
+ * (FERR : RCSTA<2>, OERR : RCSTA<1>)
+ */
+#define EUSART_RX_FERR_MASK                 0x04
+#define EUSART_RX_OERR_MASK                 0x02
+#define EUSART_RX_ERRORS_MASK               (EUSART_RX_FERR_MASK | EUSART_RX_OERR_MASK)
 /*
  * EUSART Module Synchronous mode.
  */
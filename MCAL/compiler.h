@@ -9,13 +9,29 @@
 #define	COMPILER_H
 
 /* Includes */
+#if defined(HOST_SIM)
+#include "HOST_SIM/pic18f4620_sim.h"
+#else
 #include <xc.h>
+#endif
 
 /* Datatype Declarations: */
 
 /* Macros Declaration */
 
 /* Function Macros Declaration */
+/* A special function register from its address (the drivers register descriptors) */
+#if defined(HOST_SIM)
+#define SFR_AT(_ADDRESS_)               SIM_SFR_ACCESS(_ADDRESS_)
+#else
+#define SFR_AT(_ADDRESS_)               (*(volatile unsigned char *)(_ADDRESS_))
+#endif
+/* A special function register through a pointer (taken with &<register>) */
+#if defined(HOST_SIM)
+#define SFR_INDIRECT(_POINTER_)         SIM_SFR_INDIRECT(_POINTER_)
+#else
+#define SFR_INDIRECT(_POINTER_)         (*(_POINTER_))
+#endif
 
 /* Functions Prototypes */
 